@@ -0,0 +1,66 @@
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "benchmark.hpp"
+#include "../inc/appendBuffer.hpp"
+
+int main(int argc, char **argv)
+{
+    const int operations = benchmarkArgument(argc, argv, 1, 4000000);
+
+    for (int threadCount = 1; threadCount <= 16; threadCount *= 2)
+    {
+        const int perThread = operations / threadCount;
+        const std::string suffix = " x" + std::to_string(threadCount);
+
+        {
+            ArraySequence<int> sequence;
+            std::mutex mutex;
+            double seconds = measureSeconds([&]()
+                                            {
+                std::vector<std::thread> threads;
+                for (int t = 0; t < threadCount; t++)
+                {
+                    threads.push_back(std::thread([&sequence, &mutex, perThread, t]()
+                                                  {
+                        for (int i = 0; i < perThread; i++)
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            sequence.append(t);
+                        } }));
+                }
+                for (int t = 0; t < threadCount; t++)
+                {
+                    threads[t].join();
+                } });
+            reportBenchmark("mutex ArraySequence::append" + suffix, seconds, perThread * threadCount);
+        }
+
+        {
+            ArraySequence<int> sequence;
+            AppendBuffer<int> buffer;
+            double seconds = measureSeconds([&]()
+                                            {
+                std::vector<std::thread> threads;
+                for (int t = 0; t < threadCount; t++)
+                {
+                    threads.push_back(std::thread([&buffer, perThread, t]()
+                                                  {
+                        AppendBuffer<int>::Producer producer(buffer);
+                        for (int i = 0; i < perThread; i++)
+                        {
+                            producer.append(t);
+                        } }));
+                }
+                for (int t = 0; t < threadCount; t++)
+                {
+                    threads[t].join();
+                }
+                buffer.drainInto(sequence); });
+            reportBenchmark("AppendBuffer + drainInto" + suffix, seconds, perThread * threadCount);
+        }
+    }
+
+    return 0;
+}
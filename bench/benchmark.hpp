@@ -0,0 +1,29 @@
+#pragma once
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/// @brief Runs body once and returns the elapsed wall time in seconds.
+template <class Body>
+double measureSeconds(Body body)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    body();
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+inline int benchmarkArgument(int argc, char **argv, const int position, const int fallback)
+{
+    return argc > position ? std::atoi(argv[position]) : fallback;
+}
+
+inline void reportBenchmark(const std::string &name, const double seconds, const double operations)
+{
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(4) << seconds << " s"
+              << std::setw(16) << std::setprecision(2) << operations / seconds / 1e6 << " Mop/s"
+              << std::endl;
+}
@@ -0,0 +1,87 @@
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+
+bool equalByIndex(const Sequence<int> &left, const Sequence<int> &right)
+{
+    if (left.getLength() != right.getLength())
+    {
+        return false;
+    }
+    for (SequenceIndex i = 0; i < left.getLength(); i++)
+    {
+        if (left.get(i) != right.get(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+double compareRepeatedly(const Sequence<int> &left, const Sequence<int> &right, const int repeats, const bool byIndex, long long &checksum)
+{
+    return measureSeconds([&]()
+                          {
+        for (int i = 0; i < repeats; i++)
+        {
+            checksum += byIndex ? equalByIndex(left, right) : left.equals(right);
+        } });
+}
+
+double hashRepeatedly(const Sequence<int> &sequence, const int repeats, long long &checksum)
+{
+    return measureSeconds([&]()
+                          {
+        for (int i = 0; i < repeats; i++)
+        {
+            checksum += static_cast<long long>(sequence.hash() & 1);
+        } });
+}
+
+int main(int argc, char **argv)
+{
+    const int count = benchmarkArgument(argc, argv, 1, 4000000);
+    const int repeats = benchmarkArgument(argc, argv, 2, 20);
+    const int listCount = benchmarkArgument(argc, argv, 3, 5000);
+
+    ArraySequence<int> left;
+    for (int i = 0; i < count; i++)
+    {
+        left.append(i * 7);
+    }
+    ArraySequence<int> right(left);
+    ListSequence<int> leftList;
+    ArraySequence<int> listContents;
+    for (int i = 0; i < listCount; i++)
+    {
+        leftList.prepend(listCount - 1 - i);
+        listContents.append(i);
+    }
+    ListSequence<int> rightList(leftList);
+
+    long long checksum = 0;
+    const double compared = static_cast<double>(count) * repeats;
+    const double listCompared = static_cast<double>(listCount) * repeats;
+    const std::string size = " n=" + std::to_string(count);
+    const std::string listSize = " n=" + std::to_string(listCount);
+    reportBenchmark("array equals get loop" + size, compareRepeatedly(left, right, repeats, true, checksum), compared);
+    reportBenchmark("array equals memcmp" + size, compareRepeatedly(left, right, repeats, false, checksum), compared);
+    reportBenchmark("array compare" + size, measureSeconds([&]()
+                                                           {
+        for (int i = 0; i < repeats; i++)
+        {
+            checksum += left.compare(right);
+        } }),
+                    compared);
+    reportBenchmark("list equals get loop" + listSize, compareRepeatedly(leftList, rightList, repeats, true, checksum), listCompared);
+    reportBenchmark("list equals lockstep" + listSize, compareRepeatedly(leftList, rightList, repeats, false, checksum), listCompared);
+    reportBenchmark("list equals array" + listSize, compareRepeatedly(leftList, listContents, repeats, false, checksum), listCompared);
+
+    reportBenchmark("hash first call" + size, hashRepeatedly(left, 1, checksum), count);
+    reportBenchmark("hash cached" + size, hashRepeatedly(left, repeats, checksum), compared);
+
+    volatile long long sink = checksum;
+    (void)sink;
+    return 0;
+}
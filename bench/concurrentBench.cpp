@@ -0,0 +1,129 @@
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "benchmark.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/concurrentSequence.hpp"
+
+template <class Body>
+double runThreads(const int threadCount, Body body)
+{
+    return measureSeconds([&]()
+                          {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++)
+        {
+            threads.push_back(std::thread(body, t));
+        }
+        for (int t = 0; t < threadCount; t++)
+        {
+            threads[t].join();
+        } });
+}
+
+int main(int argc, char **argv)
+{
+    const int operations = benchmarkArgument(argc, argv, 1, 1000000);
+    const int batchSize = 64;
+
+    for (int threadCount = 1; threadCount <= 16; threadCount *= 2)
+    {
+        const int perThread = operations / threadCount;
+        const std::string suffix = " x" + std::to_string(threadCount);
+
+        {
+            ArraySequence<int> sequence;
+            std::mutex mutex;
+            double seconds = runThreads(threadCount, [&](int id)
+                                        {
+                for (int i = 0; i < perThread; i++)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    sequence.append(id);
+                } });
+            reportBenchmark("mutex append" + suffix, seconds, perThread * threadCount);
+        }
+
+        {
+            ConcurrentSequence<int> sequence(new ArraySequence<int>());
+            double seconds = runThreads(threadCount, [&](int id)
+                                        {
+                for (int i = 0; i < perThread; i++)
+                {
+                    sequence.append(id);
+                } });
+            reportBenchmark("ConcurrentSequence append" + suffix, seconds, perThread * threadCount);
+        }
+
+        {
+            ConcurrentSequence<int> sequence(new ArraySequence<int>());
+            double seconds = runThreads(threadCount, [&](int id)
+                                        {
+                int batch[batchSize];
+                for (int i = 0; i < batchSize; i++)
+                {
+                    batch[i] = id;
+                }
+                for (int i = 0; i < perThread; i += batchSize)
+                {
+                    sequence.appendAll(batch, batchSize);
+                } });
+            reportBenchmark("ConcurrentSequence appendAll(64)" + suffix, seconds, perThread * threadCount);
+        }
+
+        {
+            ArraySequence<int> sequence;
+            std::mutex mutex;
+            for (int i = 0; i < 1024; i++)
+            {
+                sequence.append(i);
+            }
+            double seconds = runThreads(threadCount, [&](int id)
+                                        {
+                long long sum = 0;
+                for (int i = 0; i < perThread; i++)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (i % 10 == 0)
+                    {
+                        sequence.set(i % 1024, id);
+                    }
+                    else
+                    {
+                        sum += sequence.get(i % 1024);
+                    }
+                }
+                volatile long long sink = sum;
+                (void)sink; });
+            reportBenchmark("mutex 90% get" + suffix, seconds, perThread * threadCount);
+        }
+
+        {
+            ConcurrentSequence<int> sequence(new ArraySequence<int>());
+            for (int i = 0; i < 1024; i++)
+            {
+                sequence.append(i);
+            }
+            double seconds = runThreads(threadCount, [&](int id)
+                                        {
+                long long sum = 0;
+                for (int i = 0; i < perThread; i++)
+                {
+                    if (i % 10 == 0)
+                    {
+                        sequence.set(i % 1024, id);
+                    }
+                    else
+                    {
+                        sum += sequence.get(i % 1024);
+                    }
+                }
+                volatile long long sink = sum;
+                (void)sink; });
+            reportBenchmark("ConcurrentSequence 90% get" + suffix, seconds, perThread * threadCount);
+        }
+    }
+
+    return 0;
+}
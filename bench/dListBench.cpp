@@ -0,0 +1,53 @@
+#include <random>
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/listSequence.hpp"
+#include "../inc/dListSequence.hpp"
+
+template <class List>
+double randomGets(const List &list, const int lookups, long long &checksum)
+{
+    std::mt19937 random(1);
+    return measureSeconds([&]()
+                          {
+        for (int i = 0; i < lookups; i++)
+        {
+            checksum += list.get(static_cast<int>(random() % list.getLength()));
+        } });
+}
+
+template <class List>
+double lastAccess(const List &list, const int lookups, long long &checksum)
+{
+    return measureSeconds([&]()
+                          {
+        for (int i = 0; i < lookups; i++)
+        {
+            checksum += list.getLast();
+        } });
+}
+
+int main(int argc, char **argv)
+{
+    const int count = benchmarkArgument(argc, argv, 1, 20000);
+    const int lookups = benchmarkArgument(argc, argv, 2, 5000);
+
+    ListSequence<int> single;
+    DListSequence<int> doubly;
+    for (int i = 0; i < count; i++)
+    {
+        single.prepend(i);
+        doubly.prepend(i);
+    }
+
+    long long checksum = 0;
+    const std::string size = " n=" + std::to_string(count);
+    reportBenchmark("random get ListSequence" + size, randomGets(single, lookups, checksum), lookups);
+    reportBenchmark("random get DListSequence" + size, randomGets(doubly, lookups, checksum), lookups);
+    reportBenchmark("getLast ListSequence" + size, lastAccess(single, lookups, checksum), lookups);
+    reportBenchmark("getLast DListSequence" + size, lastAccess(doubly, lookups, checksum), lookups);
+
+    volatile long long sink = checksum;
+    (void)sink;
+    return 0;
+}
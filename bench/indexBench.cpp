@@ -0,0 +1,58 @@
+#include <random>
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+
+template <class S>
+double lookups(const S &seq, const int count, const int queries, long long &checksum)
+{
+    std::mt19937 random(2);
+    return measureSeconds([&]()
+                          {
+        for (int i = 0; i < queries; i++)
+        {
+            checksum += seq.indexOf(static_cast<int>(random() % (2 * count)));
+        } });
+}
+
+template <class S>
+double appends(S &seq, const int count)
+{
+    return measureSeconds([&]()
+                          {
+        for (int i = 0; i < count; i++)
+        {
+            seq.append(i * 2);
+        } });
+}
+
+int main(int argc, char **argv)
+{
+    const int count = benchmarkArgument(argc, argv, 1, 20000);
+    const int scanQueries = benchmarkArgument(argc, argv, 2, 2000);
+    const int indexQueries = benchmarkArgument(argc, argv, 3, 2000000);
+
+    ArraySequence<int> array;
+    ArraySequence<int> indexedArray;
+    ListSequence<int> list;
+    ListSequence<int> indexedList;
+    indexedArray.attachIndex();
+    indexedList.attachIndex();
+
+    const std::string size = " n=" + std::to_string(count);
+    reportBenchmark("append ArraySequence" + size, appends(array, count), count);
+    reportBenchmark("append indexed ArraySequence" + size, appends(indexedArray, count), count);
+    reportBenchmark("append ListSequence" + size, appends(list, count), count);
+    reportBenchmark("append indexed ListSequence" + size, appends(indexedList, count), count);
+
+    long long checksum = 0;
+    reportBenchmark("indexOf scan ArraySequence" + size, lookups(array, count, scanQueries, checksum), scanQueries);
+    reportBenchmark("indexOf hash ArraySequence" + size, lookups(indexedArray, count, indexQueries, checksum), indexQueries);
+    reportBenchmark("indexOf scan ListSequence" + size, lookups(list, count, scanQueries, checksum), scanQueries);
+    reportBenchmark("indexOf hash ListSequence" + size, lookups(indexedList, count, indexQueries, checksum), indexQueries);
+
+    volatile long long sink = checksum;
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <cstdint>
+#include <random>
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/packedIntSequence.hpp"
+
+void reportBytes(const std::string &name, const double bytes, const SequenceIndex count)
+{
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2) << bytes / count << " bytes/element"
+              << std::setw(12) << std::setprecision(1) << count * sizeof(int) / bytes << "x"
+              << std::endl;
+}
+
+template <class S>
+double sequentialGets(const S &seq, long long &checksum)
+{
+    return measureSeconds([&]()
+                          {
+        SequenceIndex length = seq.getLength();
+        for (SequenceIndex i = 0; i < length; i++)
+        {
+            checksum += seq.get(i);
+        } });
+}
+
+template <class S>
+double randomGets(const S &seq, const int lookups, long long &checksum)
+{
+    std::mt19937 random(1);
+    return measureSeconds([&]()
+                          {
+        for (int i = 0; i < lookups; i++)
+        {
+            checksum += seq.get(static_cast<SequenceIndex>(random() % seq.getLength()));
+        } });
+}
+
+int main(int argc, char **argv)
+{
+    const int count = benchmarkArgument(argc, argv, 1, 10000000);
+    const int lookups = benchmarkArgument(argc, argv, 2, 1000000);
+    const int maxGap = benchmarkArgument(argc, argv, 3, 16);
+
+    std::mt19937 random(2);
+    ArraySequence<int> ids;
+    int id = 0;
+    for (int i = 0; i < count; i++)
+    {
+        id += 1 + static_cast<int>(random() % maxGap);
+        ids.append(id);
+    }
+
+    PackedIntSequence<int> packed;
+    const std::string size = " n=" + std::to_string(count);
+    reportBenchmark("append PackedIntSequence" + size, measureSeconds([&]()
+                                                                     {
+        for (int i = 0; i < count; i++)
+        {
+            packed.append(ids[i]);
+        } }),
+                    count);
+    reportBytes("ArraySequence<int>", static_cast<double>(count) * sizeof(int), count);
+    reportBytes("PackedIntSequence<int>", static_cast<double>(packed.getPackedBytes()), count);
+
+    long long checksum = 0;
+    DynamicArray<int> decoded(count);
+    reportBenchmark("decodeTo PackedIntSequence" + size, measureSeconds([&]()
+                                                                       { packed.decodeTo(decoded.getData()); }),
+                    count);
+    checksum += decoded[count - 1];
+    reportBenchmark("sequential get ArraySequence" + size, sequentialGets(ids, checksum), count);
+    reportBenchmark("sequential get PackedIntSequence" + size, sequentialGets(packed, checksum), count);
+    reportBenchmark("random get ArraySequence" + size, randomGets(ids, lookups, checksum), lookups);
+    reportBenchmark("random get PackedIntSequence" + size, randomGets(packed, lookups, checksum), lookups);
+
+    volatile long long sink = checksum;
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/listSequence.hpp"
+#include "../inc/poolListSequence.hpp"
+
+static std::size_t requestedBytes = 0;
+static std::size_t requestedBlocks = 0;
+
+/// @brief std::allocator that counts what the list asks the heap for.
+template <class T>
+struct MeasuringAllocator : std::allocator<T>
+{
+    template <class U>
+    struct rebind
+    {
+        typedef MeasuringAllocator<U> other;
+    };
+
+    MeasuringAllocator() {}
+    template <class U>
+    MeasuringAllocator(const MeasuringAllocator<U> &) {}
+
+    T *allocate(std::size_t count)
+    {
+        requestedBytes += count * sizeof(T);
+        requestedBlocks++;
+        return std::allocator<T>::allocate(count);
+    }
+};
+
+void reportBytes(const std::string &name, const double bytes, const int count)
+{
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2) << bytes / count << " bytes/element"
+              << std::endl;
+}
+
+template <class List>
+double sumAll(const List &list, long long &checksum)
+{
+    return measureSeconds([&]()
+                          {
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            checksum += *it;
+        } });
+}
+
+int main(int argc, char **argv)
+{
+    const int count = benchmarkArgument(argc, argv, 1, 1000000);
+    // glibc adds an 8-byte header and rounds each block up to 16 bytes.
+    const std::size_t mallocHeader = 8;
+
+    ListSequence<int, MeasuringAllocator<int>> list;
+    PoolListSequence<int> pool;
+    PoolListSequence<int, true> xorPool;
+
+    double listSeconds = measureSeconds([&]()
+                                        {
+        for (int i = 0; i < count; i++)
+        {
+            list.prepend(i);
+        } });
+    double poolSeconds = measureSeconds([&]()
+                                        {
+        for (int i = 0; i < count; i++)
+        {
+            pool.prepend(i);
+        } });
+    double xorSeconds = measureSeconds([&]()
+                                       {
+        for (int i = 0; i < count; i++)
+        {
+            xorPool.prepend(i);
+        } });
+
+    const std::string size = " n=" + std::to_string(count);
+    std::size_t blockBytes = requestedBytes / requestedBlocks + mallocHeader;
+    std::size_t heapBytes = requestedBlocks * ((blockBytes + 15) / 16 * 16);
+    reportBytes("ListSequence<int> requested" + size, static_cast<double>(requestedBytes), count);
+    reportBytes("ListSequence<int> with heap headers" + size, static_cast<double>(heapBytes), count);
+    reportBytes("PoolListSequence<int> pool" + size, static_cast<double>(pool.getPoolBytes()), count);
+    reportBytes("PoolListSequence<int, true> pool" + size, static_cast<double>(xorPool.getPoolBytes()), count);
+
+    reportBenchmark("prepend ListSequence" + size, listSeconds, count);
+    reportBenchmark("prepend PoolListSequence" + size, poolSeconds, count);
+    reportBenchmark("prepend PoolListSequence xor" + size, xorSeconds, count);
+
+    long long checksum = 0;
+    reportBenchmark("traverse ListSequence" + size, sumAll(list, checksum), count);
+    reportBenchmark("traverse PoolListSequence" + size, sumAll(pool, checksum), count);
+    reportBenchmark("traverse PoolListSequence xor" + size, sumAll(xorPool, checksum), count);
+    pool.compact();
+    reportBenchmark("traverse compacted pool" + size, sumAll(pool, checksum), count);
+
+    volatile long long sink = checksum;
+    (void)sink;
+    return 0;
+}
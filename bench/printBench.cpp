@@ -0,0 +1,49 @@
+#include <fstream>
+#include "benchmark.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+
+int main(int argc, char **argv)
+{
+    const int count = benchmarkArgument(argc, argv, 1, 10000000);
+
+    ArraySequence<int> array;
+    array.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        array[i] = i * 7 - count;
+    }
+
+    std::ofstream sink("/dev/null");
+
+    double legacy = measureSeconds([&]()
+                                   {
+        for (int i = 0; i < count; i++)
+        {
+            sink << "[" << array[i] << "]";
+            if (i < count - 1)
+            {
+                sink << ", ";
+            }
+        } });
+    reportBenchmark("ArraySequence per-element operator<<", legacy, count);
+
+    double buffered = measureSeconds([&]()
+                                     { array.writeTo(sink); });
+    reportBenchmark("ArraySequence writeTo", buffered, count);
+
+    double lines = measureSeconds([&]()
+                                  { array.writeTo(sink, SequenceFormat::lines()); });
+    reportBenchmark("ArraySequence writeTo (lines)", lines, count);
+
+    ListSequence<int> list;
+    for (int i = 0; i < count; i++)
+    {
+        list.prepend(i);
+    }
+    double listed = measureSeconds([&]()
+                                   { list.writeTo(sink); });
+    reportBenchmark("ListSequence writeTo", listed, count);
+
+    return 0;
+}
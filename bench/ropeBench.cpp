@@ -0,0 +1,63 @@
+#include <random>
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/ropeSequence.hpp"
+
+template <class Text>
+double assemble(Text &text, const int rounds, const int seed)
+{
+    std::mt19937 random(seed);
+    return measureSeconds([&]()
+                          {
+        for (int i = 0; i < rounds; i++)
+        {
+            int length = text.getLength();
+            int start = static_cast<int>(random() % (length / 2));
+            Sequence<char> *piece = text.getSubsequence(start, start + length / 4);
+            text.concat(piece);
+            delete piece;
+        } });
+}
+
+int main(int argc, char **argv)
+{
+    const int initial = benchmarkArgument(argc, argv, 1, 100000);
+    const int rounds = benchmarkArgument(argc, argv, 2, 12);
+
+    std::string source(initial, 'a');
+    for (int i = 0; i < initial; i++)
+    {
+        source[i] = static_cast<char>('a' + i % 26);
+    }
+
+    ArraySequence<char> array(source.data(), initial);
+    RopeSequence<char> rope(source.data(), initial);
+
+    double arraySeconds = assemble(array, rounds, 1);
+    reportBenchmark("slice+concat array n=" + std::to_string(array.getLength()), arraySeconds, rounds);
+
+    double ropeSeconds = assemble(rope, rounds, 1);
+    reportBenchmark("slice+concat rope n=" + std::to_string(rope.getLength()), ropeSeconds, rounds);
+
+    std::mt19937 random(2);
+    const int lookups = 1000000;
+    long long checksum = 0;
+    double lookupSeconds = measureSeconds([&]()
+                                          {
+        for (int i = 0; i < lookups; i++)
+        {
+            checksum += rope.get(static_cast<int>(random() % rope.getLength()));
+        } });
+    reportBenchmark("rope random get", lookupSeconds, lookups);
+
+    DynamicArray<char> *flat = nullptr;
+    double flattenSeconds = measureSeconds([&]()
+                                           { flat = rope.flatten(); });
+    reportBenchmark("rope flatten", flattenSeconds, rope.getLength());
+
+    volatile long long sink = checksum + (*flat)[0];
+    (void)sink;
+    delete flat;
+    return 0;
+}
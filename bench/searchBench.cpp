@@ -0,0 +1,48 @@
+#include <random>
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/sortedArraySequence.hpp"
+
+int main(int argc, char **argv)
+{
+    const int maxCount = benchmarkArgument(argc, argv, 1, 10000000);
+    const int queries = benchmarkArgument(argc, argv, 2, 2000000);
+    const SearchLayout layouts[] = {SearchLayout::Binary, SearchLayout::Branchless, SearchLayout::Eytzinger};
+    const char *names[] = {"binary", "branchless", "eytzinger"};
+
+    for (int count = 1000; count <= maxCount; count *= 10)
+    {
+        std::mt19937 random(1);
+        DynamicArray<int> items;
+        items.resize(count);
+        for (int i = 0; i < count; i++)
+        {
+            items[i] = static_cast<int>(random());
+        }
+        SortedArraySequence<int> sorted(items.getData(), count);
+
+        DynamicArray<int> keys;
+        keys.resize(queries);
+        for (int i = 0; i < queries; i++)
+        {
+            keys[i] = static_cast<int>(random());
+        }
+
+        for (int l = 0; l < 3; l++)
+        {
+            sorted.setSearchLayout(layouts[l]);
+            long long checksum = 0;
+            double seconds = measureSeconds([&]()
+                                            {
+                for (int i = 0; i < queries; i++)
+                {
+                    checksum += sorted.lowerBound(keys[i]);
+                } });
+            reportBenchmark(std::string("lowerBound ") + names[l] + " n=" + std::to_string(count), seconds, queries);
+            volatile long long sink = checksum;
+            (void)sink;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <ostream>
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/soaSequence.hpp"
+
+struct Record
+{
+    int id;
+    double price;
+    float qty;
+};
+
+std::ostream &operator<<(std::ostream &out, const Record &record)
+{
+    return out << record.id << ':' << record.price << 'x' << record.qty;
+}
+
+int main(int argc, char **argv)
+{
+    const int count = benchmarkArgument(argc, argv, 1, 2000000);
+    const int rounds = benchmarkArgument(argc, argv, 2, 20);
+
+    ArraySequence<Record> records;
+    SoASequence<int, double, float> columns;
+    for (int i = 0; i < count; i++)
+    {
+        Record record = {i, (i % 1000) * 0.01, static_cast<float>(i % 7)};
+        records.append(record);
+        columns.append(record.id, record.price, record.qty);
+    }
+
+    double checksum = 0;
+    double aosSeconds = measureSeconds([&]()
+                                       {
+        for (int r = 0; r < rounds; r++)
+        {
+            const Record *items = records.getData();
+            double total = 0;
+            for (int i = 0; i < count; i++)
+            {
+                total += items[i].price;
+            }
+            checksum += total;
+        } });
+    reportBenchmark("sum price AoS ArraySequence n=" + std::to_string(count), aosSeconds, static_cast<long long>(count) * rounds);
+
+    double soaSeconds = measureSeconds([&]()
+                                       {
+        for (int r = 0; r < rounds; r++)
+        {
+            double total = 0;
+            for (double price : columns.column<1>())
+            {
+                total += price;
+            }
+            checksum += total;
+        } });
+    reportBenchmark("sum price SoA column loop n=" + std::to_string(count), soaSeconds, static_cast<long long>(count) * rounds);
+
+    double kernelSeconds = measureSeconds([&]()
+                                          {
+        for (int r = 0; r < rounds; r++)
+        {
+            checksum += sumColumn(columns.column<1>());
+        } });
+    reportBenchmark("sum price SoA sumColumn n=" + std::to_string(count), kernelSeconds, static_cast<long long>(count) * rounds);
+
+    volatile double sink = checksum;
+    (void)sink;
+    return 0;
+}
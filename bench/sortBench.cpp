@@ -0,0 +1,65 @@
+#include <functional>
+#include <random>
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+
+static void fillRandom(ArraySequence<int> &sequence, const int count, const unsigned seed)
+{
+    std::mt19937 random(seed);
+    sequence.clear();
+    sequence.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        sequence[i] = static_cast<int>(random());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int maxCount = benchmarkArgument(argc, argv, 1, 4000000);
+
+    for (int count = 10000; count <= maxCount; count *= 10)
+    {
+        const std::string size = " n=" + std::to_string(count);
+        ArraySequence<int> sequence;
+
+        for (int threads = 1; threads <= 8; threads *= 2)
+        {
+            const std::string suffix = size + " t=" + std::to_string(threads);
+
+            fillRandom(sequence, count, 1);
+            double seconds = measureSeconds([&]()
+                                            { sequence.sort(std::less<int>(), threads); });
+            reportBenchmark("ArraySequence::sort" + suffix, seconds, count);
+
+            fillRandom(sequence, count, 1);
+            seconds = measureSeconds([&]()
+                                     { sequence.stableSort(std::less<int>(), threads); });
+            reportBenchmark("ArraySequence::stableSort" + suffix, seconds, count);
+        }
+
+        fillRandom(sequence, count, 2);
+        ListSequence<int> list;
+        for (int i = 0; i < count; i++)
+        {
+            list.prepend(sequence[i]);
+        }
+        double seconds = measureSeconds([&]()
+                                        { list.sort(); });
+        reportBenchmark("ListSequence::sort" + size, seconds, count);
+
+        ArraySequence<int> left;
+        ArraySequence<int> right;
+        fillRandom(left, count, 3);
+        fillRandom(right, count, 4);
+        left.sort();
+        right.sort();
+        seconds = measureSeconds([&]()
+                                 { left.merge(right); });
+        reportBenchmark("ArraySequence::merge" + size, seconds, 2.0 * count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/sequenceStream.hpp"
+
+#ifdef SEQUENCE_HAS_STREAMS
+Generator<int> doubled(Generator<int> source)
+{
+    for (int value : source)
+    {
+        co_yield value * 2;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int count = benchmarkArgument(argc, argv, 1, 2000000);
+    const int listCount = benchmarkArgument(argc, argv, 2, 20000);
+
+    std::ostringstream text;
+    for (int i = 0; i < count; i++)
+    {
+        text << i << ' ';
+    }
+    const std::string input = text.str();
+    long long checksum = 0;
+    const std::string size = " n=" + std::to_string(count);
+
+    reportBenchmark("parse + append per value" + size, measureSeconds([&]()
+                                                                      {
+        std::istringstream in(input);
+        ArraySequence<int> seq;
+        int value;
+        while (in >> value)
+        {
+            seq.append(value);
+        }
+        checksum += seq.getLength(); }),
+                    count);
+    reportBenchmark("readValues + appendFrom" + size, measureSeconds([&]()
+                                                                     {
+        std::istringstream in(input);
+        ArraySequence<int> seq;
+        checksum += appendFrom(seq, readValues<int>(in)); }),
+                    count);
+
+    std::istringstream sourceInput(input);
+    ArraySequence<int> source;
+    appendFrom(source, readValues<int>(sourceInput));
+    reportBenchmark("materialize then double" + size, measureSeconds([&]()
+                                                                     {
+        ArraySequence<int> copy(source);
+        for (SequenceIndex i = 0; i < copy.getLength(); i++)
+        {
+            copy[i] *= 2;
+        }
+        ArraySequence<int> result;
+        result.appendRange(copy.getData(), copy.getLength());
+        checksum += result.getLast(); }),
+                    count);
+    reportBenchmark("stream pipeline double" + size, measureSeconds([&]()
+                                                                    {
+        ArraySequence<int> result = collect<ArraySequence<int>>(doubled(stream(source)));
+        checksum += result.getLast(); }),
+                    count);
+
+    ListSequence<int> list;
+    for (int i = 0; i < listCount; i++)
+    {
+        list.prepend(i);
+    }
+    const std::string listSize = " n=" + std::to_string(listCount);
+    reportBenchmark("list sum by index" + listSize, measureSeconds([&]()
+                                                                   {
+        const Sequence<int> &view = list;
+        for (SequenceIndex i = 0; i < view.getLength(); i++)
+        {
+            checksum += view.get(i);
+        } }),
+                    listCount);
+    reportBenchmark("list sum by stream" + listSize, measureSeconds([&]()
+                                                                    {
+        for (int value : stream(list))
+        {
+            checksum += value;
+        } }),
+                    listCount);
+
+    volatile long long sink = checksum;
+    (void)sink;
+    return 0;
+}
+#else
+int main()
+{
+    std::cout << "streamBench needs a C++20 build (-DENABLE_CXX20=ON)" << std::endl;
+    return 0;
+}
+#endif
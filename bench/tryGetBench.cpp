@@ -0,0 +1,95 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "../inc/arraySequence.hpp"
+
+// Lookups where roughly one index in missEvery falls past the end.
+std::vector<SequenceIndex> lookupIndices(const int count, const int lookups, const int missEvery)
+{
+    std::vector<SequenceIndex> indices(lookups);
+    unsigned state = 12345;
+    for (int i = 0; i < lookups; i++)
+    {
+        state = state * 1103515245u + 12345u;
+        indices[i] = (state >> 8) % count;
+        if (missEvery > 0 && i % missEvery == 0)
+        {
+            indices[i] += count;
+        }
+    }
+    return indices;
+}
+
+template <class Lookup>
+double sumLookups(const std::vector<SequenceIndex> &indices, const int repeats, long long &checksum, Lookup lookup)
+{
+    return measureSeconds([&]()
+                          {
+        for (int r = 0; r < repeats; r++)
+        {
+            for (SequenceIndex index : indices)
+            {
+                checksum += lookup(index);
+            }
+        } });
+}
+
+int main(int argc, char **argv)
+{
+    const int count = benchmarkArgument(argc, argv, 1, 100000);
+    const int lookups = benchmarkArgument(argc, argv, 2, 1000000);
+    const int repeats = benchmarkArgument(argc, argv, 3, 20);
+    const int missEvery = benchmarkArgument(argc, argv, 4, 100);
+
+    DynamicArray<int> array;
+    for (int i = 0; i < count; i++)
+    {
+        array.append(i);
+    }
+    const ArraySequence<int> sequence(array);
+    const ArraySequence<int> decoy;
+    // Picked at run time so the virtual cases stay virtual.
+    volatile bool useDecoy = false;
+    const Sequence<int> &view = useDecoy ? decoy : sequence;
+    const std::vector<SequenceIndex> indices = lookupIndices(count, lookups, missEvery);
+
+    long long checksum = 0;
+    const double operations = static_cast<double>(lookups) * repeats;
+    const std::string size = " n=" + std::to_string(count);
+    reportBenchmark("array check + get" + size, sumLookups(indices, repeats, checksum, [&](const SequenceIndex index)
+                                                           { return index < array.getSize() ? array.get(index) : 0; }),
+                    operations);
+    reportBenchmark("array tryGet" + size, sumLookups(indices, repeats, checksum, [&](const SequenceIndex index)
+                                                      { return array.tryGet(index).valueOr(0); }),
+                    operations);
+    reportBenchmark("sequence check + get" + size, sumLookups(indices, repeats, checksum, [&](const SequenceIndex index)
+                                                              { return index < sequence.getLength() ? sequence.get(index) : 0; }),
+                    operations);
+    reportBenchmark("sequence tryGet" + size, sumLookups(indices, repeats, checksum, [&](const SequenceIndex index)
+                                                         { return sequence.tryGet(index).valueOr(0); }),
+                    operations);
+    reportBenchmark("virtual check + get" + size, sumLookups(indices, repeats, checksum, [&](const SequenceIndex index)
+                                                             { return index < view.getLength() ? view.get(index) : 0; }),
+                    operations);
+    reportBenchmark("virtual tryGet" + size, sumLookups(indices, repeats, checksum, [&](const SequenceIndex index)
+                                                        { return view.tryGet(index).valueOr(0); }),
+                    operations);
+#if SEQUENCE_EXCEPTIONS
+    reportBenchmark("array get, catching misses" + size, sumLookups(indices, repeats, checksum, [&](const SequenceIndex index)
+                                                                    {
+        try
+        {
+            return array.get(index);
+        }
+        catch (const std::out_of_range &)
+        {
+            return 0;
+        } }),
+                    operations);
+#endif
+
+    volatile long long sink = checksum;
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <random>
+#include <string>
+#include "benchmark.hpp"
+#include "../inc/arraySequence.hpp"
+
+double filterRanges(const ArraySequence<int> &seq, const int queries, const int width, const int range, long long &checksum)
+{
+    std::mt19937 random(4);
+    return measureSeconds([&]()
+                          {
+        for (int i = 0; i < queries; i++)
+        {
+            int low = static_cast<int>(random() % (range - width));
+            ArraySequence<int> *filtered = seq.filterRange(low, low + width);
+            checksum += filtered->getLength();
+            delete filtered;
+        } });
+}
+
+double containsQueries(const ArraySequence<int> &seq, const int queries, const int range, const bool absent, long long &checksum)
+{
+    std::mt19937 random(5);
+    return measureSeconds([&]()
+                          {
+        for (int i = 0; i < queries; i++)
+        {
+            int value = static_cast<int>(random() % range) * 2 + (absent ? 1 : 0);
+            checksum += seq.contains(value) ? 1 : 0;
+        } });
+}
+
+int main(int argc, char **argv)
+{
+    const int count = benchmarkArgument(argc, argv, 1, 16000000);
+    const int queries = benchmarkArgument(argc, argv, 2, 20);
+
+    std::mt19937 random(3);
+    ArraySequence<int> clustered;
+    ArraySequence<int> scattered;
+    for (int i = 0; i < count; i++)
+    {
+        clustered.append(i + static_cast<int>(random() % 1000));
+        scattered.append(static_cast<int>(random() % count) * 2);
+    }
+    ArraySequence<int> clusteredSummary(clustered);
+    ArraySequence<int> scatteredSummary(scattered);
+    clusteredSummary.attachSummary();
+    scatteredSummary.attachSummary();
+
+    long long checksum = 0;
+    const double scanned = static_cast<double>(count) * queries;
+    const std::string size = " n=" + std::to_string(count);
+    const int selective = count / 1000;
+    const int broad = count / 2;
+    reportBenchmark("filterRange 0.1% scan" + size, filterRanges(clustered, queries, selective, count, checksum), scanned);
+    reportBenchmark("filterRange 0.1% zone map" + size, filterRanges(clusteredSummary, queries, selective, count, checksum), scanned);
+    reportBenchmark("filterRange 50% scan" + size, filterRanges(clustered, queries, broad, count, checksum), scanned);
+    reportBenchmark("filterRange 50% zone map" + size, filterRanges(clusteredSummary, queries, broad, count, checksum), scanned);
+    reportBenchmark("filterRange 0.1% scattered scan" + size, filterRanges(scattered, queries, selective, 2 * count, checksum), scanned);
+    reportBenchmark("filterRange 0.1% scattered zone map" + size, filterRanges(scatteredSummary, queries, selective, 2 * count, checksum), scanned);
+
+    reportBenchmark("contains absent scan" + size, containsQueries(scattered, queries, count, true, checksum), scanned);
+    reportBenchmark("contains absent bloom" + size, containsQueries(scatteredSummary, queries, count, true, checksum), scanned);
+    reportBenchmark("contains present scan" + size, containsQueries(scattered, queries, count, false, checksum), scanned);
+    reportBenchmark("contains present bloom" + size, containsQueries(scatteredSummary, queries, count, false, checksum), scanned);
+
+    volatile long long sink = checksum;
+    (void)sink;
+    return 0;
+}
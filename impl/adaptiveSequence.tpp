@@ -0,0 +1,450 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "../inc/adaptiveSequence.hpp"
+#include "../inc/sequenceError.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/dListSequence.hpp"
+#include "../inc/ropeSequence.hpp"
+
+template <class T>
+class AdaptiveSequence<T>::Collector : public ChunkVisitor<T>
+{
+private:
+    T *output;
+
+public:
+    Collector(T *output) : output(output) {}
+
+    bool visit(const T *items, const SequenceIndex count, const SequenceIndex offset) override
+    {
+        std::copy(items, items + count, output + offset);
+        return true;
+    }
+};
+
+template <class T>
+AdaptiveSequence<T>::AdaptiveSequence(Sequence<T> *sequence, const SequenceRepresentation representation)
+    : sequence(sequence), representation(representation), mix(), sinceCheck(0), sinceDecay(0), migrations(0), pendingReads() {}
+
+template <class T>
+AdaptiveSequence<T>::AdaptiveSequence() : AdaptiveSequence(SequenceRepresentation::Contiguous) {}
+
+template <class T>
+AdaptiveSequence<T>::AdaptiveSequence(const SequenceRepresentation representation)
+    : AdaptiveSequence(create(representation, nullptr, 0), representation) {}
+
+template <class T>
+AdaptiveSequence<T>::AdaptiveSequence(const T *items, const SequenceIndex count, const SequenceRepresentation representation)
+    : AdaptiveSequence(create(representation, items, count), representation) {}
+
+template <class T>
+AdaptiveSequence<T>::AdaptiveSequence(const AdaptiveSequence<T> &other)
+    : sequence(other.sequence->clone()), representation(other.representation), mix(),
+      sinceCheck(other.sinceCheck), sinceDecay(other.sinceDecay), migrations(other.migrations), pendingReads()
+{
+    std::copy(other.mix, other.mix + KIND_COUNT, mix);
+    for (int kind = 0; kind < READ_KIND_COUNT; kind++)
+    {
+        pendingReads[kind].store(other.pendingReads[kind].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+AdaptiveSequence<T>::~AdaptiveSequence() {}
+
+template <class T>
+Sequence<T> *AdaptiveSequence<T>::create(const SequenceRepresentation representation, const T *items, const SequenceIndex count)
+{
+    if (count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Count cannot be negative");
+    }
+    if (count > 0 && !items)
+    {
+        sequenceThrow<std::invalid_argument>("Items cannot be null");
+    }
+    switch (representation)
+    {
+    case SequenceRepresentation::Linked:
+        return count > 0 ? new DListSequence<T>(items, count) : new DListSequence<T>();
+    case SequenceRepresentation::Chunked:
+        return count > 0 ? new RopeSequence<T>(items, count) : new RopeSequence<T>();
+    default:
+        return count > 0 ? new ArraySequence<T>(items, count) : new ArraySequence<T>();
+    }
+}
+
+/// Rough per-operation cost in nanoseconds, fitted to the workload driver on
+/// int sequences: a fixed part, a part per element shifted or walked, and a
+/// part per tree level.
+template <class T>
+double AdaptiveSequence<T>::operationCost(const SequenceRepresentation representation, const OperationKind kind, const SequenceIndex length)
+{
+    static const double fixed[REPRESENTATION_COUNT][KIND_COUNT] = {
+        {5, 5, 5, 5, 5},
+        {5, 5, 40, 40, 40},
+        {20, 0, 0, 0, 0}};
+    static const double perElement[REPRESENTATION_COUNT][KIND_COUNT] = {
+        {0, 0, 0, 0.1, 0.05},
+        {0, 0.8, 0, 0, 0.8},
+        {0, 0, 0, 0, 0}};
+    static const double perLevel[REPRESENTATION_COUNT][KIND_COUNT] = {
+        {0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0},
+        {0, 15, 40, 40, 120}};
+
+    int row = static_cast<int>(representation);
+    double levels = std::log2(static_cast<double>(length) + 2.0);
+    return fixed[row][kind] + perElement[row][kind] * static_cast<double>(length) + perLevel[row][kind] * levels;
+}
+
+template <class T>
+double AdaptiveSequence<T>::migrationCost(const SequenceRepresentation from, const SequenceRepresentation to, const SequenceIndex length)
+{
+    static const double read[REPRESENTATION_COUNT] = {1, 5, 2};
+    static const double write[REPRESENTATION_COUNT] = {2, 40, 4};
+    return (read[static_cast<int>(from)] + write[static_cast<int>(to)]) * static_cast<double>(length);
+}
+
+template <class T>
+typename AdaptiveSequence<T>::OperationKind AdaptiveSequence<T>::readKind(const SequenceIndex index) const
+{
+    SequenceIndex length = sequence->getLength();
+    return index <= 0 || index >= length - 1 ? EndRead : MiddleRead;
+}
+
+template <class T>
+void AdaptiveSequence<T>::recordRead(const OperationKind kind) const
+{
+    pendingReads[kind].fetch_add(1, std::memory_order_relaxed);
+}
+
+template <class T>
+SequenceIndex AdaptiveSequence<T>::collectPendingReads()
+{
+    SequenceIndex total = 0;
+    for (int kind = 0; kind < READ_KIND_COUNT; kind++)
+    {
+        SequenceIndex reads = pendingReads[kind].exchange(0, std::memory_order_relaxed);
+        mix[kind] += static_cast<double>(reads);
+        total += reads;
+    }
+    return total;
+}
+
+template <class T>
+void AdaptiveSequence<T>::observeInsert(const SequenceIndex index)
+{
+    SequenceIndex length = sequence->getLength();
+    if (index >= length)
+    {
+        observe(BackInsert);
+    }
+    else if (index <= 0)
+    {
+        observe(FrontInsert);
+    }
+    else
+    {
+        observe(MiddleInsert);
+    }
+}
+
+template <class T>
+void AdaptiveSequence<T>::observe(const OperationKind kind)
+{
+    mix[kind] += 1;
+    sinceCheck += 1 + collectPendingReads();
+    if (sinceCheck >= CHECK_INTERVAL)
+    {
+        SequenceIndex elapsed = sinceCheck;
+        sinceCheck = 0;
+        adapt(elapsed);
+    }
+}
+
+template <class T>
+void AdaptiveSequence<T>::adapt(const SequenceIndex elapsed)
+{
+    SequenceIndex length = sequence->getLength();
+    double costs[REPRESENTATION_COUNT];
+    int best = 0;
+    for (int candidate = 0; candidate < REPRESENTATION_COUNT; candidate++)
+    {
+        costs[candidate] = 0;
+        for (int kind = 0; kind < KIND_COUNT; kind++)
+        {
+            costs[candidate] += mix[kind] * operationCost(static_cast<SequenceRepresentation>(candidate), static_cast<OperationKind>(kind), length);
+        }
+        if (costs[candidate] < costs[best])
+        {
+            best = candidate;
+        }
+    }
+
+    SequenceRepresentation target = static_cast<SequenceRepresentation>(best);
+    if (target != representation &&
+        costs[static_cast<int>(representation)] - costs[best] > 2 * migrationCost(representation, target, length))
+    {
+        migrate(target);
+    }
+
+    // The mix halves once per sequence length of operations (at least
+    // DECAY_INTERVAL), so a migration's cost is weighed against recent history.
+    sinceDecay += elapsed;
+    if (sinceDecay >= std::max<SequenceIndex>(DECAY_INTERVAL, length))
+    {
+        sinceDecay = 0;
+        for (int kind = 0; kind < KIND_COUNT; kind++)
+        {
+            mix[kind] /= 2;
+        }
+    }
+}
+
+template <class T>
+void AdaptiveSequence<T>::migrate(const SequenceRepresentation target)
+{
+    SequenceIndex length = sequence->getLength();
+    Sequence<T> *next;
+    if (length == 0)
+    {
+        next = create(target, nullptr, 0);
+    }
+    else
+    {
+        DynamicArray<T> items(length);
+        Collector collector(items.getData());
+        sequence->visitChunks(collector);
+        next = target == SequenceRepresentation::Contiguous ? new ArraySequence<T>(std::move(items))
+                                                            : create(target, items.getData(), length);
+    }
+    sequence.reset(next);
+    representation = target;
+    migrations++;
+}
+
+template <class T>
+const Sequence<T> &AdaptiveSequence<T>::view() const
+{
+    return *sequence;
+}
+
+template <class T>
+T &AdaptiveSequence<T>::getFirst()
+{
+    observe(EndRead);
+    return sequence->getFirst();
+}
+
+template <class T>
+const T &AdaptiveSequence<T>::getFirst() const
+{
+    recordRead(EndRead);
+    return view().getFirst();
+}
+
+template <class T>
+T &AdaptiveSequence<T>::getLast()
+{
+    observe(EndRead);
+    return sequence->getLast();
+}
+
+template <class T>
+const T &AdaptiveSequence<T>::getLast() const
+{
+    recordRead(EndRead);
+    return view().getLast();
+}
+
+template <class T>
+T &AdaptiveSequence<T>::get(const SequenceIndex index)
+{
+    observe(readKind(index));
+    return sequence->get(index);
+}
+
+template <class T>
+const T &AdaptiveSequence<T>::get(const SequenceIndex index) const
+{
+    recordRead(readKind(index));
+    return view().get(index);
+}
+
+template <class T>
+SequenceIndex AdaptiveSequence<T>::getLength() const
+{
+    return sequence->getLength();
+}
+
+template <class T>
+void AdaptiveSequence<T>::visitChunks(ChunkVisitor<T> &visitor) const
+{
+    sequence->visitChunks(visitor);
+}
+
+template <class T>
+const T *AdaptiveSequence<T>::getContiguousData() const
+{
+    return sequence->getContiguousData();
+}
+
+template <class T>
+void AdaptiveSequence<T>::append(const T &item)
+{
+    observe(BackInsert);
+    sequence->append(item);
+}
+
+template <class T>
+void AdaptiveSequence<T>::prepend(const T &item)
+{
+    observe(sequence->getLength() > 0 ? FrontInsert : BackInsert);
+    sequence->prepend(item);
+}
+
+template <class T>
+void AdaptiveSequence<T>::insertAt(const T &item, const SequenceIndex index)
+{
+    observeInsert(index);
+    sequence->insertAt(item, index);
+}
+
+template <class T>
+void AdaptiveSequence<T>::set(const SequenceIndex index, const T &data)
+{
+    observe(readKind(index));
+    sequence->set(index, data);
+}
+
+template <class T>
+void AdaptiveSequence<T>::concat(const Sequence<T> *other)
+{
+    insertRange(getLength(), other);
+}
+
+template <class T>
+void AdaptiveSequence<T>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    observeInsert(index);
+    sequence->insertRange(index, items, count);
+}
+
+template <class T>
+void AdaptiveSequence<T>::insertRange(const SequenceIndex index, const Sequence<T> *other)
+{
+    observeInsert(index);
+    if (other == this || other == sequence.get())
+    {
+        std::unique_ptr<Sequence<T>> copy(sequence->clone());
+        sequence->insertRange(index, copy.get());
+        return;
+    }
+    sequence->insertRange(index, other);
+}
+
+template <class T>
+Sequence<T> *AdaptiveSequence<T>::getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const
+{
+    return new AdaptiveSequence<T>(sequence->getSubsequence(startIndex, endIndex), representation);
+}
+
+template <class T>
+Sequence<T> *AdaptiveSequence<T>::appendImmutable(const T &item) const
+{
+    std::unique_ptr<AdaptiveSequence<T>> newSequence(new AdaptiveSequence<T>(*this));
+    newSequence->append(item);
+    return newSequence.release();
+}
+
+template <class T>
+Sequence<T> *AdaptiveSequence<T>::prependImmutable(const T &item) const
+{
+    std::unique_ptr<AdaptiveSequence<T>> newSequence(new AdaptiveSequence<T>(*this));
+    newSequence->prepend(item);
+    return newSequence.release();
+}
+
+template <class T>
+Sequence<T> *AdaptiveSequence<T>::insertAtImmutable(const T &item, const SequenceIndex index) const
+{
+    std::unique_ptr<AdaptiveSequence<T>> newSequence(new AdaptiveSequence<T>(*this));
+    newSequence->insertAt(item, index);
+    return newSequence.release();
+}
+
+template <class T>
+Sequence<T> *AdaptiveSequence<T>::setImmutable(const SequenceIndex index, const T &data) const
+{
+    std::unique_ptr<AdaptiveSequence<T>> newSequence(new AdaptiveSequence<T>(*this));
+    newSequence->set(index, data);
+    return newSequence.release();
+}
+
+template <class T>
+Sequence<T> *AdaptiveSequence<T>::concatImmutable(const Sequence<T> *other) const
+{
+    std::unique_ptr<AdaptiveSequence<T>> newSequence(new AdaptiveSequence<T>(*this));
+    newSequence->insertRange(newSequence->getLength(), other == this ? sequence.get() : other);
+    return newSequence.release();
+}
+
+template <class T>
+Sequence<T> *AdaptiveSequence<T>::clone() const
+{
+    return new AdaptiveSequence<T>(*this);
+}
+
+template <class T>
+void AdaptiveSequence<T>::writeTo(std::ostream &out, const SequenceFormat &format) const
+{
+    sequence->writeTo(out, format);
+}
+
+template <class T>
+void AdaptiveSequence<T>::print() const
+{
+    sequence->print();
+}
+
+template <class T>
+SequenceRepresentation AdaptiveSequence<T>::getRepresentation() const
+{
+    return representation;
+}
+
+template <class T>
+SequenceIndex AdaptiveSequence<T>::getMigrationCount() const
+{
+    return migrations;
+}
+
+template <class T>
+void AdaptiveSequence<T>::migrateTo(const SequenceRepresentation target)
+{
+    if (target != representation)
+    {
+        migrate(target);
+    }
+}
+
+template <class T>
+AdaptiveSequence<T> &AdaptiveSequence<T>::operator=(const AdaptiveSequence<T> &other)
+{
+    if (this != &other)
+    {
+        sequence.reset(other.sequence->clone());
+        representation = other.representation;
+        std::copy(other.mix, other.mix + KIND_COUNT, mix);
+        sinceCheck = other.sinceCheck;
+        sinceDecay = other.sinceDecay;
+        migrations = other.migrations;
+        for (int kind = 0; kind < READ_KIND_COUNT; kind++)
+        {
+            pendingReads[kind].store(other.pendingReads[kind].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+    return *this;
+}
@@ -0,0 +1,206 @@
+#include <stdexcept>
+#include "../inc/appendBuffer.hpp"
+#include "../inc/sequenceError.hpp"
+
+//* Producer {
+
+template <class T>
+AppendBuffer<T>::Producer::Producer(AppendBuffer<T> &buffer) : buffer(buffer), current(nullptr) {}
+
+template <class T>
+AppendBuffer<T>::Producer::~Producer()
+{
+    flush();
+}
+
+template <class T>
+void AppendBuffer<T>::Producer::append(const T &item)
+{
+    if (!current)
+    {
+        current = new Chunk(buffer.chunkSize);
+    }
+
+    current->items[current->count] = item;
+    current->count++;
+
+    if (current->count == buffer.chunkSize)
+    {
+        buffer.publish(current);
+        current = nullptr;
+    }
+}
+
+template <class T>
+void AppendBuffer<T>::Producer::flush()
+{
+    if (current)
+    {
+        buffer.publish(current);
+        current = nullptr;
+    }
+}
+
+//* } End of Producer section
+
+template <class T>
+AppendBuffer<T>::AppendBuffer(const SequenceIndex chunkSize) : published(nullptr), chunkSize(chunkSize)
+{
+    if (chunkSize <= 0)
+    {
+        sequenceThrow<std::invalid_argument>("Chunk size must be greater than 0");
+    }
+}
+
+template <class T>
+AppendBuffer<T>::~AppendBuffer()
+{
+    Chunk *chunk = takeAll();
+    while (chunk)
+    {
+        Chunk *next = chunk->next;
+        delete chunk;
+        chunk = next;
+    }
+}
+
+template <class T>
+void AppendBuffer<T>::publish(Chunk *chunk)
+{
+    Chunk *head = published.load(std::memory_order_relaxed);
+    do
+    {
+        chunk->next = head;
+    } while (!published.compare_exchange_weak(head, chunk, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <class T>
+typename AppendBuffer<T>::Chunk *AppendBuffer<T>::takeAll()
+{
+    Chunk *chunk = published.exchange(nullptr, std::memory_order_acquire);
+
+    Chunk *ordered = nullptr;
+    while (chunk)
+    {
+        Chunk *next = chunk->next;
+        chunk->next = ordered;
+        ordered = chunk;
+        chunk = next;
+    }
+    return ordered;
+}
+
+template <class T>
+void AppendBuffer<T>::restore(Chunk *ordered)
+{
+    // Everything published since takeAll is newer than the restored chunks, so
+    // it is taken over and chained above them; the stack is only put back
+    // once nothing newer is left to sit on top of it.
+    Chunk *stack = nullptr;
+    while (ordered)
+    {
+        Chunk *next = ordered->next;
+        ordered->next = stack;
+        stack = ordered;
+        ordered = next;
+    }
+
+    Chunk *expected = nullptr;
+    while (!published.compare_exchange_weak(expected, stack, std::memory_order_release, std::memory_order_relaxed))
+    {
+        Chunk *newer = published.exchange(nullptr, std::memory_order_acquire);
+        if (newer)
+        {
+            Chunk *last = newer;
+            while (last->next)
+            {
+                last = last->next;
+            }
+            last->next = stack;
+            stack = newer;
+        }
+        expected = nullptr;
+    }
+}
+
+template <class T>
+template <class Target>
+SequenceIndex AppendBuffer<T>::drain(Target &target)
+{
+    Chunk *chunks = takeAll();
+    if (!chunks)
+    {
+        return 0;
+    }
+
+    SequenceIndex total = 0;
+    for (Chunk *chunk = chunks; chunk; chunk = chunk->next)
+    {
+        total += chunk->count;
+    }
+
+    SequenceIndex offset = target.getLength();
+    SEQUENCE_TRY
+    {
+        target.resize(offset + total);
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        restore(chunks);
+        SEQUENCE_RETHROW;
+    }
+    T *data = target.getData();
+
+    while (chunks)
+    {
+        for (SequenceIndex i = 0; i < chunks->count; i++)
+        {
+            data[offset + i] = chunks->items[i];
+        }
+        offset += chunks->count;
+
+        Chunk *next = chunks->next;
+        delete chunks;
+        chunks = next;
+    }
+    return total;
+}
+
+template <class T>
+SequenceIndex AppendBuffer<T>::getChunkSize() const
+{
+    return chunkSize;
+}
+
+template <class T>
+bool AppendBuffer<T>::isEmpty() const
+{
+    return published.load(std::memory_order_acquire) == nullptr;
+}
+
+template <class T>
+template <class Allocator>
+SequenceIndex AppendBuffer<T>::drainInto(DynamicArray<T, Allocator> &array)
+{
+    struct ArrayTarget
+    {
+        DynamicArray<T, Allocator> &array;
+        SequenceIndex getLength() const { return array.getSize(); }
+        void resize(const SequenceIndex newSize) { array.resize(newSize); }
+        T *getData() { return array.getData(); }
+    } target = {array};
+    return drain(target);
+}
+
+template <class T>
+template <class Allocator>
+SequenceIndex AppendBuffer<T>::drainInto(ArraySequence<T, Allocator> &sequence)
+{
+    // The items are written through getData, past an attached index or zone map.
+    SequenceIndex drained = drain(sequence);
+    if (drained > 0)
+    {
+        sequence.rebuildIndex();
+    }
+    return drained;
+}
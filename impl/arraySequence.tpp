@@ -1,212 +1,603 @@
+#include <algorithm>
 #include "../inc/arraySequence.hpp"
+#include "../inc/sequenceError.hpp"
 
-template <class T>
-ArraySequence<T>::ArraySequence() : array() {}
+template <class T, class Allocator>
+ArraySequence<T, Allocator>::ArraySequence() : array() {}
 
-template <class T>
-ArraySequence<T>::ArraySequence(const T *items, const int count) : array(items, count)
+template <class T, class Allocator>
+ArraySequence<T, Allocator>::ArraySequence(const Allocator &allocator) : array(allocator) {}
+
+template <class T, class Allocator>
+ArraySequence<T, Allocator>::ArraySequence(const T *items, const SequenceIndex count, const Allocator &allocator) : array(items, count, allocator)
 {
     if (items == nullptr && count > 0)
     {
-        throw std::invalid_argument("Null array with non-zero count");
+        sequenceThrow<std::invalid_argument>("Null array with non-zero count");
     }
     if (count < 0)
     {
-        throw std::invalid_argument("Negative count");
+        sequenceThrow<std::invalid_argument>("Negative count");
     }
 }
 
-template <class T>
-ArraySequence<T>::ArraySequence(const int count) : array(count) {}
+template <class T, class Allocator>
+ArraySequence<T, Allocator>::ArraySequence(const SequenceIndex count, const Allocator &allocator) : array(count, allocator) {}
+
+template <class T, class Allocator>
+ArraySequence<T, Allocator>::ArraySequence(const DynamicArray<T, Allocator> &array) : array(array) {}
+
+template <class T, class Allocator>
+ArraySequence<T, Allocator>::ArraySequence(DynamicArray<T, Allocator> &&array) : array(std::move(array)) {}
+
+template <class T, class Allocator>
+ArraySequence<T, Allocator>::ArraySequence(const ArraySequence<T, Allocator> &other)
+    : array(other.array), valueIndex(other.valueIndex ? other.valueIndex->clone() : nullptr),
+      summary(other.summary ? other.summary->clone() : nullptr), hashCache(other.hashCache) {}
+
+template <class T, class Allocator>
+ArraySequence<T, Allocator>::ArraySequence(ArraySequence<T, Allocator> &&other) noexcept
+    : array(std::move(other.array)), valueIndex(std::move(other.valueIndex)), summary(std::move(other.summary)),
+      hashCache(other.hashCache)
+{
+    other.hashCache.clear();
+}
 
-template <class T>
-ArraySequence<T>::ArraySequence(const DynamicArray<T> &array) : array(array) {}
+template <class T, class Allocator>
+ArraySequence<T, Allocator>::~ArraySequence() {}
 
-template <class T>
-ArraySequence<T>::~ArraySequence() {}
+template <class T, class Allocator>
+Allocator ArraySequence<T, Allocator>::getAllocator() const
+{
+    return array.getAllocator();
+}
 
-template <class T>
-T &ArraySequence<T>::getFirst()
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::swap(ArraySequence<T, Allocator> &other)
 {
+    array.swap(other.array);
+    valueIndex.swap(other.valueIndex);
+    summary.swap(other.summary);
+    std::swap(hashCache, other.hashCache);
+}
+
+template <class T, class Allocator>
+T &ArraySequence<T, Allocator>::getFirst()
+{
+    hashCache.clear();
     return array.getFirst();
 }
 
-template <class T>
-const T &ArraySequence<T>::getFirst() const
+template <class T, class Allocator>
+const T &ArraySequence<T, Allocator>::getFirst() const
 {
     return array.getFirst();
 }
 
-template <class T>
-T &ArraySequence<T>::getLast()
+template <class T, class Allocator>
+T &ArraySequence<T, Allocator>::getLast()
 {
+    hashCache.clear();
     return array.getLast();
 }
 
-template <class T>
-const T &ArraySequence<T>::getLast() const
+template <class T, class Allocator>
+const T &ArraySequence<T, Allocator>::getLast() const
 {
     return array.getLast();
 }
 
-template <class T>
-T &ArraySequence<T>::get(const int index)
+template <class T, class Allocator>
+T &ArraySequence<T, Allocator>::get(const SequenceIndex index)
 {
+    hashCache.clear();
     return array.get(index);
 }
 
-template <class T>
-const T &ArraySequence<T>::get(const int index) const
+template <class T, class Allocator>
+const T &ArraySequence<T, Allocator>::get(const SequenceIndex index) const
 {
     return array.get(index);
 }
 
-template <class T>
-int ArraySequence<T>::getLength() const
+template <class T, class Allocator>
+SequenceResult<T> ArraySequence<T, Allocator>::tryGet(const SequenceIndex index)
+{
+    hashCache.clear();
+    return array.tryGet(index);
+}
+
+template <class T, class Allocator>
+SequenceResult<const T> ArraySequence<T, Allocator>::tryGet(const SequenceIndex index) const
+{
+    return array.tryGet(index);
+}
+
+template <class T, class Allocator>
+SequenceIndex ArraySequence<T, Allocator>::getLength() const
 {
     return array.getSize();
 }
 
-template <class T>
-Sequence<T> *ArraySequence<T>::getSubsequence(const int startIndex, const int endIndex) const
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::visitChunks(ChunkVisitor<T> &visitor) const
+{
+    const T *probe = visitor.getProbe();
+    if (!summary || !probe)
+    {
+        if (array.getSize() > 0)
+        {
+            visitor.visit(array.getData(), array.getSize(), 0);
+        }
+        return;
+    }
+
+    const T *data = array.getData();
+    SequenceIndex size = array.getSize();
+    for (SequenceIndex start = 0, chunk = 0; start < size; start += ChunkSummary<T>::CHUNK_SIZE, chunk++)
+    {
+        if (!summary->mayContain(chunk, *probe))
+        {
+            continue;
+        }
+        SequenceIndex count = std::min<SequenceIndex>(ChunkSummary<T>::CHUNK_SIZE, size - start);
+        if (!visitor.visit(data + start, count, start))
+        {
+            return;
+        }
+    }
+}
+
+template <class T, class Allocator>
+const ValueIndex<T> *ArraySequence<T, Allocator>::getValueIndex() const
+{
+    return valueIndex.get();
+}
+
+template <class T, class Allocator>
+const T *ArraySequence<T, Allocator>::getContiguousData() const
+{
+    return array.getData();
+}
+
+template <class T, class Allocator>
+SequenceHashCache *ArraySequence<T, Allocator>::getHashCache() const
+{
+    return &hashCache;
+}
+
+template <class T, class Allocator>
+template <class Hash, class Equal>
+void ArraySequence<T, Allocator>::attachIndex(const Hash &hash, const Equal &equal)
+{
+    std::unique_ptr<ValueIndex<T>> built(new HashIndex<T, Hash, Equal>(hash, equal));
+    built->rebuild(*this);
+    valueIndex = std::move(built);
+}
+
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::detachIndex()
+{
+    valueIndex.reset();
+}
+
+template <class T, class Allocator>
+bool ArraySequence<T, Allocator>::hasIndex() const
+{
+    return valueIndex != nullptr;
+}
+
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::rebuildIndex()
+{
+    reindex();
+}
+
+template <class T, class Allocator>
+template <class Hash>
+void ArraySequence<T, Allocator>::attachSummary(const Hash &hash)
+{
+    std::unique_ptr<ChunkSummary<T>> built(new ZoneMap<T, Hash>(hash));
+    built->rebuild(array.getData(), array.getSize());
+    summary = std::move(built);
+}
+
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::detachSummary()
+{
+    summary.reset();
+}
+
+template <class T, class Allocator>
+bool ArraySequence<T, Allocator>::hasSummary() const
+{
+    return summary != nullptr;
+}
+
+template <class T, class Allocator>
+ArraySequence<T, Allocator> *ArraySequence<T, Allocator>::filterRange(const T &low, const T &high) const
+{
+    ArraySequence<T, Allocator> *result = new ArraySequence<T, Allocator>(getAllocator());
+    const T *data = array.getData();
+    SequenceIndex size = array.getSize();
+    SequenceIndex step = summary ? ChunkSummary<T>::CHUNK_SIZE : size;
+    SEQUENCE_TRY
+    {
+        for (SequenceIndex start = 0, chunk = 0; start < size; start += step, chunk++)
+        {
+            SequenceIndex count = std::min(step, size - start);
+            RangeOverlap overlap = summary ? summary->overlap(chunk, low, high) : RangeOverlap::Partial;
+            if (overlap == RangeOverlap::Full)
+            {
+                result->array.appendRange(data + start, count);
+                continue;
+            }
+            for (SequenceIndex i = start; overlap == RangeOverlap::Partial && i < start + count; i++)
+            {
+                if (!(data[i] < low) && !(high < data[i]))
+                {
+                    result->array.append(data[i]);
+                }
+            }
+        }
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        delete result;
+        SEQUENCE_RETHROW;
+    }
+    return result;
+}
+
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::indexAdded(const SequenceIndex start, const SequenceIndex count)
+{
+    if ((!valueIndex && !summary) || count == 0)
+    {
+        return;
+    }
+    if (start + count != array.getSize())
+    {
+        reindex();
+        return;
+    }
+    for (SequenceIndex i = start; i < start + count; i++)
+    {
+        if (valueIndex)
+        {
+            valueIndex->add(array[i], i);
+        }
+        if (summary)
+        {
+            summary->add(array[i], i);
+        }
+    }
+}
+
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::reindex()
+{
+    if (valueIndex)
+    {
+        valueIndex->rebuild(*this);
+    }
+    if (summary)
+    {
+        summary->rebuild(array.getData(), array.getSize());
+    }
+}
+
+template <class T, class Allocator>
+T *ArraySequence<T, Allocator>::getData()
+{
+    hashCache.clear();
+    return array.getData();
+}
+
+template <class T, class Allocator>
+const T *ArraySequence<T, Allocator>::getData() const
+{
+    return array.getData();
+}
+
+template <class T, class Allocator>
+Sequence<T> *ArraySequence<T, Allocator>::getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const
 {
     if (startIndex < 0 || endIndex >= this->getLength() || startIndex > endIndex)
     {
-        throw std::out_of_range("Invalid subsequence range");
+        sequenceThrow<std::out_of_range>("Invalid subsequence range");
     }
 
-    ArraySequence<T> *newSequence = new ArraySequence<T>();
-    for (int i = startIndex; i <= endIndex; i++)
+    ArraySequence<T, Allocator> *newSequence = new ArraySequence<T, Allocator>(getAllocator());
+    for (SequenceIndex i = startIndex; i <= endIndex; i++)
     {
         newSequence->append(this->get(i));
     }
     return newSequence;
 }
 
-template <class T>
-void ArraySequence<T>::append(const T &item)
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::append(const T &item)
 {
+    hashCache.clear();
     array.append(item);
+    indexAdded(array.getSize() - 1, 1);
 }
 
-template <class T>
-void ArraySequence<T>::prepend(const T &item)
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::prepend(const T &item)
 {
+    hashCache.clear();
     array.prepend(item);
+    if (valueIndex)
+    {
+        valueIndex->shift(0, 1);
+        valueIndex->add(array[0], 0);
+    }
+    if (summary)
+    {
+        summary->rebuild(array.getData(), array.getSize());
+    }
 }
 
-template <class T>
-void ArraySequence<T>::insertAt(const T &item, const int index)
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::insertAt(const T &item, const SequenceIndex index)
 {
+    hashCache.clear();
     if (index < 0 || index > getLength())
     {
-        throw std::out_of_range("Invalid index for insertion");
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
     }
     array.insertAt(item, index);
+    if (valueIndex)
+    {
+        if (index < array.getSize() - 1)
+        {
+            valueIndex->shift(index, 1);
+        }
+        valueIndex->add(array[index], index);
+    }
+    if (summary && index == array.getSize() - 1)
+    {
+        summary->add(array[index], index);
+    }
+    else if (summary)
+    {
+        summary->rebuild(array.getData(), array.getSize());
+    }
 }
 
-template <class T>
-void ArraySequence<T>::set(const int index, const T &data)
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::set(const SequenceIndex index, const T &data)
 {
+    hashCache.clear();
     if (index < 0 || index >= getLength())
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    if (summary)
+    {
+        summary->add(data, index);
     }
+    if (!valueIndex)
+    {
+        array[index] = data;
+        return;
+    }
+
+    T previous = array[index];
     array[index] = data;
+    valueIndex->remove(previous, index, *this);
+    valueIndex->add(array[index], index);
 }
 
-template <class T>
-void ArraySequence<T>::concat(const Sequence<T> *other)
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::concat(const Sequence<T> *other)
 {
     if (!other)
     {
         return;
     }
 
-    for (int i = 0; i < other->getLength(); i++)
+    insertRange(getLength(), other);
+}
+
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    hashCache.clear();
+    if (index < 0 || index > getLength())
     {
-        array.append(other->get(i));
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
     }
+    array.insertRange(index, items, count);
+    indexAdded(index, count);
 }
 
-template <class T>
-Sequence<T> *ArraySequence<T>::setImmutable(const int index, const T &data) const
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::insertRange(const SequenceIndex index, const Sequence<T> *other)
 {
-    ArraySequence<T> *newSequence = new ArraySequence<T>(*this);
+    hashCache.clear();
+    if (index < 0 || index > getLength())
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    if (!other)
+    {
+        return;
+    }
+    if (other == this)
+    {
+        SequenceIndex count = array.getSize();
+        array.insertRange(index, array.getData(), count);
+        indexAdded(index, count);
+        return;
+    }
+
+    SequenceIndex count = other->getLength();
+    SequenceIndex oldSize = array.getSize();
+    array.resize(oldSize + count);
+
+    T *data = array.getData();
+    for (SequenceIndex i = oldSize - 1; i >= index; i--)
+    {
+        data[i + count] = std::move(data[i]);
+    }
+    PrefixCopier<T> copier(data + index, count);
+    other->visitChunks(copier);
+    indexAdded(index, count);
+}
+
+template <class T, class Allocator>
+Sequence<T> *ArraySequence<T, Allocator>::setImmutable(const SequenceIndex index, const T &data) const
+{
+    ArraySequence<T, Allocator> *newSequence = new ArraySequence<T, Allocator>(*this);
     newSequence->set(index, data);
     return newSequence;
 }
 
-template <class T>
-Sequence<T> *ArraySequence<T>::appendImmutable(const T &item) const
+template <class T, class Allocator>
+Sequence<T> *ArraySequence<T, Allocator>::appendImmutable(const T &item) const
 {
-    ArraySequence<T> *newSequence = new ArraySequence<T>(*this);
+    ArraySequence<T, Allocator> *newSequence = new ArraySequence<T, Allocator>(*this);
     newSequence->append(item);
     return newSequence;
 }
 
-template <class T>
-Sequence<T> *ArraySequence<T>::prependImmutable(const T &item) const
+template <class T, class Allocator>
+Sequence<T> *ArraySequence<T, Allocator>::prependImmutable(const T &item) const
 {
-    ArraySequence<T> *newSequence = new ArraySequence<T>(*this);
+    ArraySequence<T, Allocator> *newSequence = new ArraySequence<T, Allocator>(*this);
     newSequence->prepend(item);
     return newSequence;
 }
 
-template <class T>
-Sequence<T> *ArraySequence<T>::insertAtImmutable(const T &item, const int index) const
+template <class T, class Allocator>
+Sequence<T> *ArraySequence<T, Allocator>::insertAtImmutable(const T &item, const SequenceIndex index) const
 {
-    ArraySequence<T> *newSequence = new ArraySequence<T>(*this);
+    ArraySequence<T, Allocator> *newSequence = new ArraySequence<T, Allocator>(*this);
     newSequence->insertAt(item, index);
     return newSequence;
 }
 
-template <class T>
-Sequence<T> *ArraySequence<T>::concatImmutable(const Sequence<T> *other) const
+template <class T, class Allocator>
+Sequence<T> *ArraySequence<T, Allocator>::concatImmutable(const Sequence<T> *other) const
 {
-    ArraySequence<T> *newSequence = new ArraySequence<T>(*this);
+    ArraySequence<T, Allocator> *newSequence = new ArraySequence<T, Allocator>(*this);
     newSequence->concat(other);
     return newSequence;
 }
 
-template <class T>
-void ArraySequence<T>::print() const
+template <class T, class Allocator>
+Sequence<T> *ArraySequence<T, Allocator>::clone() const
+{
+    return new ArraySequence<T, Allocator>(*this);
+}
+
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::writeTo(std::ostream &out, const SequenceFormat &format) const
+{
+    array.writeTo(out, format);
+}
+
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::print() const
 {
     array.print();
 }
 
-template <class T>
-T &ArraySequence<T>::operator[](const int index)
+template <class T, class Allocator>
+T &ArraySequence<T, Allocator>::operator[](const SequenceIndex index)
 {
+    hashCache.clear();
     if (index < 0 || index >= getLength())
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
     return array[index];
 }
 
-template <class T>
-const T &ArraySequence<T>::operator[](const int index) const
+template <class T, class Allocator>
+const T &ArraySequence<T, Allocator>::operator[](const SequenceIndex index) const
 {
     if (index < 0 || index >= getLength())
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
     return array[index];
 }
 
-template <class T>
-void ArraySequence<T>::clear()
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::resize(const SequenceIndex newSize)
 {
+    hashCache.clear();
+    SequenceIndex oldSize = array.getSize();
+    array.resize(newSize);
+    if (newSize < oldSize)
+    {
+        reindex();
+        return;
+    }
+    indexAdded(oldSize, newSize - oldSize);
+}
+
+template <class T, class Allocator>
+template <class Compare>
+void ArraySequence<T, Allocator>::sort(Compare compare, const int threads)
+{
+    hashCache.clear();
+    array.sort(compare, threads);
+    reindex();
+}
+
+template <class T, class Allocator>
+template <class Compare>
+void ArraySequence<T, Allocator>::stableSort(Compare compare, const int threads)
+{
+    hashCache.clear();
+    array.stableSort(compare, threads);
+    reindex();
+}
+
+template <class T, class Allocator>
+template <class Compare>
+void ArraySequence<T, Allocator>::merge(const ArraySequence<T, Allocator> &other, Compare compare)
+{
+    hashCache.clear();
+    array.merge(other.array, compare);
+    reindex();
+}
+
+template <class T, class Allocator>
+void ArraySequence<T, Allocator>::clear()
+{
+    hashCache.clear();
     array.clear();
+    reindex();
 }
 
-template <class T>
-ArraySequence<T> &ArraySequence<T>::operator=(const ArraySequence &other)
+template <class T, class Allocator>
+ArraySequence<T, Allocator> &ArraySequence<T, Allocator>::operator=(const ArraySequence<T, Allocator> &other)
 {
     if (this != &other)
     {
+        std::unique_ptr<ValueIndex<T>> copied(other.valueIndex ? other.valueIndex->clone() : nullptr);
+        std::unique_ptr<ChunkSummary<T>> copiedSummary(other.summary ? other.summary->clone() : nullptr);
         array = other.array;
+        valueIndex = std::move(copied);
+        summary = std::move(copiedSummary);
+        hashCache = other.hashCache;
     }
     return *this;
+}
+
+template <class T, class Allocator>
+ArraySequence<T, Allocator> &ArraySequence<T, Allocator>::operator=(ArraySequence<T, Allocator> &&other)
+{
+    array = std::move(other.array);
+    valueIndex = std::move(other.valueIndex);
+    summary = std::move(other.summary);
+    hashCache = other.hashCache;
+    other.hashCache.clear();
+    return *this;
 }
\ No newline at end of file
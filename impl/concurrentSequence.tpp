@@ -0,0 +1,107 @@
+#include <memory>
+#include <stdexcept>
+#include "../inc/concurrentSequence.hpp"
+#include "../inc/sequenceError.hpp"
+
+template <class T>
+ConcurrentSequence<T>::ConcurrentSequence(Sequence<T> *sequence) : sequence(sequence)
+{
+    if (!sequence)
+    {
+        sequenceThrow<std::invalid_argument>("Sequence cannot be null");
+    }
+}
+
+template <class T>
+ConcurrentSequence<T>::~ConcurrentSequence()
+{
+    delete sequence;
+}
+
+template <class T>
+T ConcurrentSequence<T>::getFirst() const
+{
+    ReadLock lock(mutex);
+    return static_cast<const Sequence<T> *>(sequence)->getFirst();
+}
+
+template <class T>
+T ConcurrentSequence<T>::getLast() const
+{
+    ReadLock lock(mutex);
+    return static_cast<const Sequence<T> *>(sequence)->getLast();
+}
+
+template <class T>
+T ConcurrentSequence<T>::get(const SequenceIndex index) const
+{
+    ReadLock lock(mutex);
+    return static_cast<const Sequence<T> *>(sequence)->get(index);
+}
+
+template <class T>
+SequenceIndex ConcurrentSequence<T>::getLength() const
+{
+    ReadLock lock(mutex);
+    return sequence->getLength();
+}
+
+template <class T>
+void ConcurrentSequence<T>::append(const T &item)
+{
+    WriteLock lock(mutex);
+    sequence->append(item);
+}
+
+template <class T>
+void ConcurrentSequence<T>::prepend(const T &item)
+{
+    WriteLock lock(mutex);
+    sequence->prepend(item);
+}
+
+template <class T>
+void ConcurrentSequence<T>::insertAt(const T &item, const SequenceIndex index)
+{
+    WriteLock lock(mutex);
+    sequence->insertAt(item, index);
+}
+
+template <class T>
+void ConcurrentSequence<T>::set(const SequenceIndex index, const T &data)
+{
+    WriteLock lock(mutex);
+    sequence->set(index, data);
+}
+
+template <class T>
+void ConcurrentSequence<T>::concat(const Sequence<T> *other)
+{
+    WriteLock lock(mutex);
+    sequence->concat(other);
+}
+
+template <class T>
+void ConcurrentSequence<T>::appendAll(const T *items, const SequenceIndex count)
+{
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+
+    WriteLock lock(mutex);
+    sequence->appendRange(items, count);
+}
+
+template <class T>
+void ConcurrentSequence<T>::appendAll(const Sequence<T> &items)
+{
+    WriteLock lock(mutex);
+    if (&items == sequence)
+    {
+        std::unique_ptr<Sequence<T>> copy(sequence->clone());
+        sequence->appendRange(copy.get());
+        return;
+    }
+    sequence->appendRange(&items);
+}
@@ -0,0 +1,167 @@
+#include <cstdlib>
+#include <typeinfo>
+#if defined(__GNUC__) || defined(__clang__)
+#include <cxxabi.h>
+#endif
+#include "../inc/containerStats.hpp"
+
+inline StatsSnapshot::StatsSnapshot()
+    : allocations(0), frees(0), bytesAllocated(0), bytesCopied(0),
+      reallocations(0), elementCopies(0), elementMoves(0), traversalSteps(0) {}
+
+inline ContainerStats::ContainerStats()
+    : allocations(0), frees(0), bytesAllocated(0), bytesCopied(0),
+      reallocations(0), elementCopies(0), elementMoves(0), traversalSteps(0) {}
+
+inline void ContainerStats::add(std::atomic<unsigned long long> &counter, const unsigned long long amount)
+{
+    counter.fetch_add(amount, std::memory_order_relaxed);
+}
+
+inline void ContainerStats::recordAllocation(const std::size_t bytes)
+{
+    add(allocations, 1);
+    add(bytesAllocated, bytes);
+}
+
+inline void ContainerStats::recordFree()
+{
+    add(frees, 1);
+}
+
+inline void ContainerStats::recordCopies(const std::size_t count, const std::size_t bytes)
+{
+    add(elementCopies, count);
+    add(bytesCopied, bytes);
+}
+
+inline StatsSnapshot ContainerStats::snapshot() const
+{
+    StatsSnapshot result;
+    result.allocations = allocations.load(std::memory_order_relaxed);
+    result.frees = frees.load(std::memory_order_relaxed);
+    result.bytesAllocated = bytesAllocated.load(std::memory_order_relaxed);
+    result.bytesCopied = bytesCopied.load(std::memory_order_relaxed);
+    result.reallocations = reallocations.load(std::memory_order_relaxed);
+    result.elementCopies = elementCopies.load(std::memory_order_relaxed);
+    result.elementMoves = elementMoves.load(std::memory_order_relaxed);
+    result.traversalSteps = traversalSteps.load(std::memory_order_relaxed);
+    return result;
+}
+
+inline void ContainerStats::reset()
+{
+    allocations.store(0, std::memory_order_relaxed);
+    frees.store(0, std::memory_order_relaxed);
+    bytesAllocated.store(0, std::memory_order_relaxed);
+    bytesCopied.store(0, std::memory_order_relaxed);
+    reallocations.store(0, std::memory_order_relaxed);
+    elementCopies.store(0, std::memory_order_relaxed);
+    elementMoves.store(0, std::memory_order_relaxed);
+    traversalSteps.store(0, std::memory_order_relaxed);
+}
+
+inline StatsRegistry::StatsRegistry() {}
+
+inline StatsRegistry &StatsRegistry::instance()
+{
+    static StatsRegistry registry;
+    return registry;
+}
+
+inline void StatsRegistry::add(const std::string &name, ContainerStats *stats)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Entry entry;
+    entry.name = name;
+    entry.stats = stats;
+    entries.push_back(entry);
+}
+
+inline void StatsRegistry::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        entries[i].stats->reset();
+    }
+}
+
+inline void StatsRegistry::writeJson(std::ostream &out) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "{";
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        StatsSnapshot stats = entries[i].stats->snapshot();
+        out << (i > 0 ? ",\n  \"" : "\n  \"");
+        for (size_t c = 0; c < entries[i].name.size(); c++)
+        {
+            char symbol = entries[i].name[c];
+            if (symbol == '"' || symbol == '\\')
+            {
+                out << '\\';
+            }
+            out << symbol;
+        }
+        out << "\": {"
+            << "\"allocations\": " << stats.allocations
+            << ", \"frees\": " << stats.frees
+            << ", \"bytesAllocated\": " << stats.bytesAllocated
+            << ", \"bytesCopied\": " << stats.bytesCopied
+            << ", \"reallocations\": " << stats.reallocations
+            << ", \"elementCopies\": " << stats.elementCopies
+            << ", \"elementMoves\": " << stats.elementMoves
+            << ", \"traversalSteps\": " << stats.traversalSteps
+            << "}";
+    }
+    out << (entries.empty() ? "}" : "\n}") << "\n";
+}
+
+template <class Container>
+std::string statsName()
+{
+    const char *name = typeid(Container).name();
+#if defined(__GNUC__) || defined(__clang__)
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status == 0 && demangled)
+    {
+        std::string result(demangled);
+        std::free(demangled);
+        return result;
+    }
+#endif
+    return name;
+}
+
+template <class Container>
+ContainerStats &statsFor()
+{
+    static ContainerStats stats;
+    static bool registered = (StatsRegistry::instance().add(statsName<Container>(), &stats), true);
+    (void)registered;
+    return stats;
+}
+
+template <class Container>
+StatsSnapshot snapshotStats()
+{
+    return statsFor<Container>().snapshot();
+}
+
+template <class Container>
+void resetStats()
+{
+    statsFor<Container>().reset();
+}
+
+inline void resetAllStats()
+{
+    StatsRegistry::instance().reset();
+}
+
+inline void writeStatsJson(std::ostream &out)
+{
+    StatsRegistry::instance().writeJson(out);
+}
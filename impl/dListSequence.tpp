@@ -0,0 +1,294 @@
+#include "../inc/dListSequence.hpp"
+#include "../inc/sequenceError.hpp"
+
+// Appends every visited run to a chain in order.
+template <class T, class Allocator>
+class ChainAppender : public ChunkVisitor<T>
+{
+private:
+    DoublyLinkedList<T, Allocator> &chain;
+
+public:
+    ChainAppender(DoublyLinkedList<T, Allocator> &chain) : chain(chain) {}
+
+    bool visit(const T *items, const SequenceIndex count, const SequenceIndex) override
+    {
+        chain.appendRange(items, count);
+        return true;
+    }
+};
+
+template <class T, class Allocator>
+DListSequence<T, Allocator>::DListSequence() : list() {}
+
+template <class T, class Allocator>
+DListSequence<T, Allocator>::DListSequence(const Allocator &allocator) : list(allocator) {}
+
+template <class T, class Allocator>
+DListSequence<T, Allocator>::DListSequence(const T *items, const SequenceIndex count, const Allocator &allocator) : list(items, count, allocator) {}
+
+template <class T, class Allocator>
+DListSequence<T, Allocator>::DListSequence(const SequenceIndex count, const Allocator &allocator) : list(count, allocator) {}
+
+template <class T, class Allocator>
+DListSequence<T, Allocator>::DListSequence(const DoublyLinkedList<T, Allocator> &list) : list(list) {}
+
+template <class T, class Allocator>
+DListSequence<T, Allocator>::DListSequence(DoublyLinkedList<T, Allocator> &&list) : list(std::move(list)) {}
+
+template <class T, class Allocator>
+DListSequence<T, Allocator>::DListSequence(const DListSequence<T, Allocator> &other) : list(other.list) {}
+
+template <class T, class Allocator>
+DListSequence<T, Allocator>::DListSequence(DListSequence<T, Allocator> &&other) noexcept : list(std::move(other.list)) {}
+
+template <class T, class Allocator>
+DListSequence<T, Allocator>::~DListSequence() {}
+
+template <class T, class Allocator>
+Allocator DListSequence<T, Allocator>::getAllocator() const
+{
+    return list.getAllocator();
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::swap(DListSequence<T, Allocator> &other)
+{
+    list.swap(other.list);
+}
+
+template <class T, class Allocator>
+T &DListSequence<T, Allocator>::getFirst()
+{
+    return list.getFirst();
+}
+
+template <class T, class Allocator>
+const T &DListSequence<T, Allocator>::getFirst() const
+{
+    return list.getFirst();
+}
+
+template <class T, class Allocator>
+T &DListSequence<T, Allocator>::getLast()
+{
+    return list.getLast();
+}
+
+template <class T, class Allocator>
+const T &DListSequence<T, Allocator>::getLast() const
+{
+    return list.getLast();
+}
+
+template <class T, class Allocator>
+T &DListSequence<T, Allocator>::get(SequenceIndex index)
+{
+    return list.get(index);
+}
+
+template <class T, class Allocator>
+const T &DListSequence<T, Allocator>::get(const SequenceIndex index) const
+{
+    return list.get(index);
+}
+
+template <class T, class Allocator>
+SequenceIndex DListSequence<T, Allocator>::getLength() const
+{
+    return list.getLength();
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::visitChunks(ChunkVisitor<T> &visitor) const
+{
+    SequenceIndex position = 0;
+    for (typename DoublyLinkedList<T, Allocator>::ConstIterator it = list.begin(); it != list.end(); ++it)
+    {
+        if (!visitor.visit(&*it, 1, position++))
+        {
+            return;
+        }
+    }
+}
+
+template <class T, class Allocator>
+Sequence<T> *DListSequence<T, Allocator>::getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const
+{
+    DoublyLinkedList<T, Allocator> *subDoublyLinkedList = list.getSubList(startIndex, endIndex);
+    DListSequence<T, Allocator> *subList = new DListSequence<T, Allocator>(std::move(*subDoublyLinkedList));
+    delete subDoublyLinkedList;
+    return subList;
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::append(const T &item)
+{
+    list.append(item);
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::prepend(const T &item)
+{
+    list.prepend(item);
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::insertAt(const T &item, const SequenceIndex index)
+{
+    if (index < 0 || index > getLength())
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+
+    list.insertAt(item, index);
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::concat(const Sequence<T> *other)
+{
+    insertRange(getLength(), other);
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    if (index < 0 || index > getLength())
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    list.insertRange(index, items, count);
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::insertRange(const SequenceIndex index, const Sequence<T> *other)
+{
+    if (index < 0 || index > getLength())
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    if (!other)
+    {
+        return;
+    }
+
+    DoublyLinkedList<T, Allocator> chain(list.getAllocator());
+    ChainAppender<T, Allocator> appender(chain);
+    other->visitChunks(appender);
+    list.splice(index, chain);
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::set(const SequenceIndex index, const T &data)
+{
+    if (index < 0 || index >= getLength())
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    this->get(index) = data;
+}
+
+template <class T, class Allocator>
+Sequence<T> *DListSequence<T, Allocator>::setImmutable(const SequenceIndex index, const T &data) const
+{
+    DListSequence<T, Allocator> *newSequence = new DListSequence<T, Allocator>(*this);
+    newSequence->set(index, data);
+    return newSequence;
+}
+
+template <class T, class Allocator>
+Sequence<T> *DListSequence<T, Allocator>::appendImmutable(const T &item) const
+{
+    DListSequence<T, Allocator> *newSequence = new DListSequence<T, Allocator>(*this);
+    newSequence->append(item);
+    return newSequence;
+}
+
+template <class T, class Allocator>
+Sequence<T> *DListSequence<T, Allocator>::prependImmutable(const T &item) const
+{
+    DListSequence<T, Allocator> *newSequence = new DListSequence<T, Allocator>(*this);
+    newSequence->prepend(item);
+    return newSequence;
+}
+
+template <class T, class Allocator>
+Sequence<T> *DListSequence<T, Allocator>::insertAtImmutable(const T &item, const SequenceIndex index) const
+{
+    DListSequence<T, Allocator> *newSequence = new DListSequence<T, Allocator>(*this);
+    newSequence->insertAt(item, index);
+    return newSequence;
+}
+
+template <class T, class Allocator>
+Sequence<T> *DListSequence<T, Allocator>::concatImmutable(const Sequence<T> *list) const
+{
+    DListSequence<T, Allocator> *newSequence = new DListSequence<T, Allocator>(*this);
+    newSequence->concat(list);
+    return newSequence;
+}
+
+template <class T, class Allocator>
+Sequence<T> *DListSequence<T, Allocator>::clone() const
+{
+    return new DListSequence<T, Allocator>(*this);
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::writeTo(std::ostream &out, const SequenceFormat &format) const
+{
+    list.writeTo(out, format);
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::print() const
+{
+    list.print();
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::reverse()
+{
+    list.reverse();
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::removeFirst()
+{
+    list.removeFirst();
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::removeLast()
+{
+    list.removeLast();
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::removeAt(const SequenceIndex index)
+{
+    list.removeAt(index);
+}
+
+template <class T, class Allocator>
+void DListSequence<T, Allocator>::clear()
+{
+    list.clear();
+}
+
+template <class T, class Allocator>
+DListSequence<T, Allocator> &DListSequence<T, Allocator>::operator=(const DListSequence<T, Allocator> &other)
+{
+    if (this != &other)
+    {
+        list = other.list;
+    }
+    return *this;
+}
+
+template <class T, class Allocator>
+DListSequence<T, Allocator> &DListSequence<T, Allocator>::operator=(DListSequence<T, Allocator> &&other)
+{
+    list = std::move(other.list);
+    return *this;
+}
@@ -0,0 +1,769 @@
+#include <iostream>
+#include <stdexcept>
+#include "../inc/doublyLinkedList.hpp"
+#include "../inc/sequenceError.hpp"
+
+//* Iterator {
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::Iterator::Iterator(Node *nodePtr, const DoublyLinkedList<T, Allocator> *owner)
+    : current(nodePtr), owner(owner) {}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator &DoublyLinkedList<T, Allocator>::Iterator::operator++()
+{
+    if (current)
+    {
+        current = current->next;
+    }
+    return *this;
+}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::Iterator::operator++(int)
+{
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator &DoublyLinkedList<T, Allocator>::Iterator::operator--()
+{
+    current = current ? current->prev : owner->tail;
+    return *this;
+}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::Iterator::operator--(int)
+{
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+template <typename T, class Allocator>
+T &DoublyLinkedList<T, Allocator>::Iterator::operator*() const
+{
+    if (!current)
+    {
+        sequenceThrow<std::runtime_error>("Invalid iterator");
+    }
+    return current->value;
+}
+
+template <typename T, class Allocator>
+T *DoublyLinkedList<T, Allocator>::Iterator::operator->() const
+{
+    return &**this;
+}
+
+template <typename T, class Allocator>
+bool DoublyLinkedList<T, Allocator>::Iterator::operator==(const Iterator &other) const
+{
+    return current == other.current;
+}
+
+template <typename T, class Allocator>
+bool DoublyLinkedList<T, Allocator>::Iterator::operator!=(const Iterator &other) const
+{
+    return !(*this == other);
+}
+
+template <typename T, class Allocator>
+bool DoublyLinkedList<T, Allocator>::Iterator::notEnd() const
+{
+    return current != nullptr;
+}
+
+//* } End of Iterator section
+
+//* ConstIterator {
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(const Node *nodePtr, const DoublyLinkedList<T, Allocator> *owner)
+    : current(nodePtr), owner(owner) {}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(const Iterator &other)
+    : current(other.current), owner(other.owner) {}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator &DoublyLinkedList<T, Allocator>::ConstIterator::operator++()
+{
+    if (current)
+    {
+        current = current->next;
+    }
+    return *this;
+}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::ConstIterator::operator++(int)
+{
+    ConstIterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator &DoublyLinkedList<T, Allocator>::ConstIterator::operator--()
+{
+    current = current ? current->prev : owner->tail;
+    return *this;
+}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::ConstIterator::operator--(int)
+{
+    ConstIterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+template <typename T, class Allocator>
+const T &DoublyLinkedList<T, Allocator>::ConstIterator::operator*() const
+{
+    if (!current)
+    {
+        sequenceThrow<std::runtime_error>("Dereferencing invalid iterator");
+    }
+    return current->value;
+}
+
+template <typename T, class Allocator>
+const T *DoublyLinkedList<T, Allocator>::ConstIterator::operator->() const
+{
+    return &**this;
+}
+
+template <typename T, class Allocator>
+bool DoublyLinkedList<T, Allocator>::ConstIterator::operator==(const ConstIterator &other) const
+{
+    return current == other.current;
+}
+
+template <typename T, class Allocator>
+bool DoublyLinkedList<T, Allocator>::ConstIterator::operator!=(const ConstIterator &other) const
+{
+    return !(*this == other);
+}
+
+template <typename T, class Allocator>
+bool DoublyLinkedList<T, Allocator>::ConstIterator::notEnd() const
+{
+    return current != nullptr;
+}
+
+//* } end of ConstIterator section
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::Node *DoublyLinkedList<T, Allocator>::createNode(const T &value)
+{
+    Node *node = NodeTraits::allocate(allocator, 1);
+    SEQUENCE_TRY
+    {
+        NodeTraits::construct(allocator, node, value);
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        NodeTraits::deallocate(allocator, node, 1);
+        SEQUENCE_RETHROW;
+    }
+    SEQUENCE_STATS_ALLOCATE(DoublyLinkedList, sizeof(Node));
+    SEQUENCE_STATS_COPY(DoublyLinkedList, 1, sizeof(T));
+    return node;
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::destroyNode(Node *node)
+{
+    NodeTraits::destroy(allocator, node);
+    NodeTraits::deallocate(allocator, node, 1);
+    SEQUENCE_STATS_FREE(DoublyLinkedList);
+}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::Node *DoublyLinkedList<T, Allocator>::nodeAt(const SequenceIndex index) const
+{
+    if (index < 0 || index >= length)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+
+    Node *node = nullptr;
+    if (index < length / 2)
+    {
+        node = head;
+        for (SequenceIndex i = 0; i < index; i++)
+        {
+            node = node->next;
+        }
+        SEQUENCE_STATS_ADD(DoublyLinkedList, traversalSteps, index);
+    }
+    else
+    {
+        node = tail;
+        for (SequenceIndex i = length - 1; i > index; i--)
+        {
+            node = node->prev;
+        }
+        SEQUENCE_STATS_ADD(DoublyLinkedList, traversalSteps, length - 1 - index);
+    }
+    return node;
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::linkBefore(Node *position, Node *node)
+{
+    node->next = position;
+    node->prev = position ? position->prev : tail;
+    if (node->prev)
+    {
+        node->prev->next = node;
+    }
+    else
+    {
+        head = node;
+    }
+    if (position)
+    {
+        position->prev = node;
+    }
+    else
+    {
+        tail = node;
+    }
+    length++;
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::unlink(Node *node)
+{
+    if (node->prev)
+    {
+        node->prev->next = node->next;
+    }
+    else
+    {
+        head = node->next;
+    }
+    if (node->next)
+    {
+        node->next->prev = node->prev;
+    }
+    else
+    {
+        tail = node->prev;
+    }
+    length--;
+    destroyNode(node);
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::copyNodes(const DoublyLinkedList<T, Allocator> &list)
+{
+    SEQUENCE_TRY
+    {
+        for (ConstIterator it = list.begin(); it != list.end(); ++it)
+        {
+            linkBefore(nullptr, createNode(*it));
+        }
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        clear();
+        SEQUENCE_RETHROW;
+    }
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::checkAllocator(const DoublyLinkedList<T, Allocator> &other) const
+{
+    if (!(allocator == other.allocator))
+    {
+        sequenceThrow<std::invalid_argument>("Lists use different allocators");
+    }
+}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList() : allocator(), head(nullptr), tail(nullptr), length(0) {}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const Allocator &allocator)
+    : allocator(allocator), head(nullptr), tail(nullptr), length(0) {}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const SequenceIndex count, const Allocator &allocator)
+    : allocator(allocator), head(nullptr), tail(nullptr), length(0)
+{
+    if (count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Count cannot be negative");
+    }
+
+    T defaultValue = T();
+    SEQUENCE_TRY
+    {
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            append(defaultValue);
+        }
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        clear();
+        SEQUENCE_RETHROW;
+    }
+}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const T *items, const SequenceIndex count, const Allocator &allocator)
+    : allocator(allocator), head(nullptr), tail(nullptr), length(0)
+{
+    if (!items || count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+
+    SEQUENCE_TRY
+    {
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            append(items[i]);
+        }
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        clear();
+        SEQUENCE_RETHROW;
+    }
+}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const DoublyLinkedList<T, Allocator> &list)
+    : allocator(NodeTraits::select_on_container_copy_construction(list.allocator)), head(nullptr), tail(nullptr), length(0)
+{
+    copyNodes(list);
+}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const DoublyLinkedList<T, Allocator> &list, const Allocator &allocator)
+    : allocator(allocator), head(nullptr), tail(nullptr), length(0)
+{
+    copyNodes(list);
+}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(DoublyLinkedList<T, Allocator> &&list) noexcept
+    : allocator(std::move(list.allocator)), head(list.head), tail(list.tail), length(list.length)
+{
+    list.head = nullptr;
+    list.tail = nullptr;
+    list.length = 0;
+}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator>::~DoublyLinkedList()
+{
+    clear();
+}
+
+template <typename T, class Allocator>
+Allocator DoublyLinkedList<T, Allocator>::getAllocator() const
+{
+    return Allocator(allocator);
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::swap(DoublyLinkedList<T, Allocator> &other)
+{
+    if (NodeTraits::propagate_on_container_swap::value)
+    {
+        std::swap(allocator, other.allocator);
+    }
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(length, other.length);
+}
+
+template <typename T, class Allocator>
+void swap(DoublyLinkedList<T, Allocator> &first, DoublyLinkedList<T, Allocator> &second)
+{
+    first.swap(second);
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::clear()
+{
+    Node *current = head;
+    while (current != nullptr)
+    {
+        Node *next = current->next;
+        destroyNode(current);
+        current = next;
+    }
+    head = nullptr;
+    tail = nullptr;
+    length = 0;
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::append(const T &item)
+{
+    linkBefore(nullptr, createNode(item));
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::prepend(const T &item)
+{
+    linkBefore(head, createNode(item));
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::removeFirst()
+{
+    if (!head)
+    {
+        sequenceThrow<std::out_of_range>("List is empty");
+    }
+    unlink(head);
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::removeLast()
+{
+    if (!tail)
+    {
+        sequenceThrow<std::out_of_range>("List is empty");
+    }
+    unlink(tail);
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::removeAt(const SequenceIndex index)
+{
+    unlink(nodeAt(index));
+}
+
+template <typename T, class Allocator>
+T &DoublyLinkedList<T, Allocator>::getFirst()
+{
+    if (!head)
+    {
+        sequenceThrow<std::out_of_range>("List is empty");
+    }
+    return head->value;
+}
+
+template <typename T, class Allocator>
+const T &DoublyLinkedList<T, Allocator>::getFirst() const
+{
+    if (!head)
+    {
+        sequenceThrow<std::out_of_range>("List is empty");
+    }
+    return head->value;
+}
+
+template <typename T, class Allocator>
+T &DoublyLinkedList<T, Allocator>::getLast()
+{
+    if (!tail)
+    {
+        sequenceThrow<std::out_of_range>("List is empty");
+    }
+    return tail->value;
+}
+
+template <typename T, class Allocator>
+const T &DoublyLinkedList<T, Allocator>::getLast() const
+{
+    if (!tail)
+    {
+        sequenceThrow<std::out_of_range>("List is empty");
+    }
+    return tail->value;
+}
+
+template <typename T, class Allocator>
+T &DoublyLinkedList<T, Allocator>::get(const SequenceIndex index)
+{
+    return nodeAt(index)->value;
+}
+
+template <typename T, class Allocator>
+const T &DoublyLinkedList<T, Allocator>::get(const SequenceIndex index) const
+{
+    return nodeAt(index)->value;
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::set(const SequenceIndex index, const T &value)
+{
+    nodeAt(index)->value = value;
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::insertAt(const T &value, const SequenceIndex index)
+{
+    if (index < 0 || index > length)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+
+    Node *position = index == length ? nullptr : nodeAt(index);
+    linkBefore(position, createNode(value));
+}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::insert(Iterator position, const T &value)
+{
+    if (position.owner != this)
+    {
+        sequenceThrow<std::invalid_argument>("Iterator belongs to another list");
+    }
+
+    Node *node = createNode(value);
+    linkBefore(position.current, node);
+    return Iterator(node, this);
+}
+
+template <typename T, class Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::erase(Iterator position)
+{
+    if (position.owner != this)
+    {
+        sequenceThrow<std::invalid_argument>("Iterator belongs to another list");
+    }
+    if (!position.current)
+    {
+        sequenceThrow<std::out_of_range>("Cannot erase end iterator");
+    }
+
+    Node *next = position.current->next;
+    unlink(position.current);
+    return Iterator(next, this);
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    if (index < 0 || index > length)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+
+    DoublyLinkedList<T, Allocator> chain(getAllocator());
+    for (SequenceIndex i = 0; i < count; i++)
+    {
+        chain.append(items[i]);
+    }
+    splice(index, chain);
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::appendRange(const T *items, const SequenceIndex count)
+{
+    insertRange(length, items, count);
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::prependRange(const T *items, const SequenceIndex count)
+{
+    insertRange(0, items, count);
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::splice(const SequenceIndex index, DoublyLinkedList<T, Allocator> &other)
+{
+    if (&other == this)
+    {
+        sequenceThrow<std::invalid_argument>("Cannot splice with itself");
+    }
+    checkAllocator(other);
+    if (index < 0 || index > length)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    if (!other.head)
+    {
+        return;
+    }
+
+    Node *position = index == length ? nullptr : nodeAt(index);
+    Node *before = position ? position->prev : tail;
+
+    other.head->prev = before;
+    other.tail->next = position;
+    if (before)
+    {
+        before->next = other.head;
+    }
+    else
+    {
+        head = other.head;
+    }
+    if (position)
+    {
+        position->prev = other.tail;
+    }
+    else
+    {
+        tail = other.tail;
+    }
+
+    length += other.length;
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.length = 0;
+}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator> *DoublyLinkedList<T, Allocator>::getSubList(const SequenceIndex startIndex, const SequenceIndex endIndex) const
+{
+    if (startIndex < 0 || startIndex >= length ||
+        endIndex < 0 || endIndex >= length ||
+        startIndex > endIndex)
+    {
+        sequenceThrow<std::out_of_range>("Invalid index range");
+    }
+
+    DoublyLinkedList<T, Allocator> *subList = new DoublyLinkedList<T, Allocator>(getAllocator());
+    SEQUENCE_TRY
+    {
+        const Node *node = nodeAt(startIndex);
+        for (SequenceIndex i = startIndex; i <= endIndex; i++)
+        {
+            subList->append(node->value);
+            node = node->next;
+        }
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        delete subList;
+        SEQUENCE_RETHROW;
+    }
+    return subList;
+}
+
+template <typename T, class Allocator>
+SequenceIndex DoublyLinkedList<T, Allocator>::getLength() const
+{
+    return length;
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::writeTo(std::ostream &out, const SequenceFormat &format) const
+{
+    writeRange(out, begin(), end(), format);
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::print() const
+{
+    writeTo(std::cout, SequenceFormat::spaced());
+}
+
+template <typename T, class Allocator>
+std::ostream &operator<<(std::ostream &out, const DoublyLinkedList<T, Allocator> &list)
+{
+    list.writeTo(out);
+    return out;
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::concat(const DoublyLinkedList<T, Allocator> &list)
+{
+    if (&list == this)
+    {
+        sequenceThrow<std::invalid_argument>("Cannot concatenate with itself");
+    }
+
+    DoublyLinkedList<T, Allocator> chain(list, getAllocator());
+    splice(length, chain);
+}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator> *DoublyLinkedList<T, Allocator>::concatImmutable(const DoublyLinkedList<T, Allocator> &list) const
+{
+    if (&list == this)
+    {
+        sequenceThrow<std::invalid_argument>("Cannot concatenate with itself");
+    }
+
+    DoublyLinkedList<T, Allocator> *result = new DoublyLinkedList<T, Allocator>(*this);
+    SEQUENCE_TRY
+    {
+        result->concat(list);
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        delete result;
+        SEQUENCE_RETHROW;
+    }
+    return result;
+}
+
+template <typename T, class Allocator>
+void DoublyLinkedList<T, Allocator>::reverse()
+{
+    Node *current = head;
+    while (current)
+    {
+        std::swap(current->prev, current->next);
+        current = current->prev;
+    }
+    std::swap(head, tail);
+}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator> &DoublyLinkedList<T, Allocator>::operator=(const DoublyLinkedList<T, Allocator> &other)
+{
+    if (&other == this)
+    {
+        return *this;
+    }
+
+    clear();
+    if (NodeTraits::propagate_on_container_copy_assignment::value)
+    {
+        allocator = other.allocator;
+    }
+    copyNodes(other);
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+DoublyLinkedList<T, Allocator> &DoublyLinkedList<T, Allocator>::operator=(DoublyLinkedList<T, Allocator> &&other)
+{
+    if (&other == this)
+    {
+        return *this;
+    }
+
+    clear();
+    if (NodeTraits::propagate_on_container_move_assignment::value || allocator == other.allocator)
+    {
+        if (NodeTraits::propagate_on_container_move_assignment::value)
+        {
+            allocator = std::move(other.allocator);
+        }
+        head = other.head;
+        tail = other.tail;
+        length = other.length;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.length = 0;
+        return *this;
+    }
+
+    copyNodes(other);
+    other.clear();
+    return *this;
+}
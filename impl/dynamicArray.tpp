@@ -1,118 +1,228 @@
 #include <iostream>
 #include "../inc/dynamicArray.hpp"
 
-template <typename T>
-DynamicArray<T>::DynamicArray() : data(new T[1]), size(0), capacity(1) {}
+template <typename T, class Allocator>
+T *DynamicArray<T, Allocator>::allocate(const SequenceIndex count)
+{
+    if (count > maxElements(allocator))
+    {
+        sequenceThrow<std::length_error>("Requested size exceeds maximum capacity");
+    }
 
-template <typename T>
-DynamicArray<T>::DynamicArray(const int size) : data(new T[(size > 0 ? size : 1)]), size(size > 0 ? size : 0), capacity((size > 0 ? size : 1))
+    T *items = AllocatorTraits::allocate(allocator, static_cast<typename AllocatorTraits::size_type>(count));
+    SequenceIndex constructed = 0;
+    SEQUENCE_TRY
+    {
+        for (; constructed < count; constructed++)
+        {
+            AllocatorTraits::construct(allocator, items + constructed);
+        }
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        for (SequenceIndex i = 0; i < constructed; i++)
+        {
+            AllocatorTraits::destroy(allocator, items + i);
+        }
+        AllocatorTraits::deallocate(allocator, items, count);
+        SEQUENCE_RETHROW;
+    }
+    SEQUENCE_STATS_ALLOCATE(DynamicArray, sizeof(T) * count);
+    return items;
+}
+
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::release(T *items, const SequenceIndex count)
 {
-    for (int i = 0; i < size; ++i)
+    if (!items)
+    {
+        return;
+    }
+    for (SequenceIndex i = 0; i < count; i++)
     {
-        data[i] = T();
+        AllocatorTraits::destroy(allocator, items + i);
     }
+    AllocatorTraits::deallocate(allocator, items, count > 0 ? count : 1);
+    SEQUENCE_STATS_FREE(DynamicArray);
+}
+
+template <typename T, class Allocator>
+DynamicArray<T, Allocator>::DynamicArray() : allocator(), data(allocate(1)), size(0), capacity(1) {}
+
+template <typename T, class Allocator>
+DynamicArray<T, Allocator>::DynamicArray(const Allocator &allocator) : allocator(allocator), data(nullptr), size(0), capacity(1)
+{
+    data = allocate(1);
 }
 
-template <typename T>
-DynamicArray<T>::DynamicArray(const T *items, const int count) : data(new T[(count > 0 ? count : 1)]), size(count), capacity(count)
+template <typename T, class Allocator>
+DynamicArray<T, Allocator>::DynamicArray(const SequenceIndex size, const Allocator &allocator)
+    : allocator(allocator), data(nullptr), size(size > 0 ? size : 0), capacity((size > 0 ? size : 1))
+{
+    data = allocate(capacity);
+}
+
+template <typename T, class Allocator>
+DynamicArray<T, Allocator>::DynamicArray(const T *items, const SequenceIndex count, const Allocator &allocator)
+    : allocator(allocator), data(nullptr), size(count > 0 ? count : 0), capacity(count > 0 ? count : 1)
 {
     if (!items)
     {
-        throw std::invalid_argument("Count must be greater than 0");
+        sequenceThrow<std::invalid_argument>("Count must be greater than 0");
     }
-    for (int i = 0; i < count; ++i)
+    data = allocate(capacity);
+    for (SequenceIndex i = 0; i < size; ++i)
     {
         data[i] = items[i];
     }
+    SEQUENCE_STATS_COPY(DynamicArray, size, sizeof(T) * size);
 }
 
-template <typename T>
-DynamicArray<T>::DynamicArray(const DynamicArray<T> &dynamicArray) : data(new T[dynamicArray.capacity]), size(dynamicArray.size), capacity(dynamicArray.capacity)
+template <typename T, class Allocator>
+DynamicArray<T, Allocator>::DynamicArray(const DynamicArray<T, Allocator> &dynamicArray)
+    : DynamicArray(dynamicArray, AllocatorTraits::select_on_container_copy_construction(dynamicArray.allocator)) {}
+
+template <typename T, class Allocator>
+DynamicArray<T, Allocator>::DynamicArray(const DynamicArray<T, Allocator> &dynamicArray, const Allocator &allocator)
+    : allocator(allocator), data(nullptr), size(dynamicArray.size), capacity(dynamicArray.capacity > 0 ? dynamicArray.capacity : 1)
 {
-    for (int i = 0; i < size; ++i)
+    data = allocate(capacity);
+    for (SequenceIndex i = 0; i < size; ++i)
     {
         data[i] = dynamicArray.data[i];
     }
+    SEQUENCE_STATS_COPY(DynamicArray, size, sizeof(T) * size);
 }
 
-template <typename T>
-DynamicArray<T>::~DynamicArray()
+template <typename T, class Allocator>
+DynamicArray<T, Allocator>::DynamicArray(DynamicArray<T, Allocator> &&dynamicArray) noexcept
+    : allocator(std::move(dynamicArray.allocator)), data(dynamicArray.data), size(dynamicArray.size), capacity(dynamicArray.capacity)
 {
-    delete[] data;
+    dynamicArray.data = nullptr;
+    dynamicArray.size = 0;
+    dynamicArray.capacity = 0;
 }
 
-template <typename T>
-T &DynamicArray<T>::get(const int index)
+template <typename T, class Allocator>
+DynamicArray<T, Allocator>::~DynamicArray()
+{
+    release(data, capacity);
+}
+
+template <typename T, class Allocator>
+Allocator DynamicArray<T, Allocator>::getAllocator() const
+{
+    return allocator;
+}
+
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::swap(DynamicArray<T, Allocator> &other)
+{
+    if (AllocatorTraits::propagate_on_container_swap::value)
+    {
+        std::swap(allocator, other.allocator);
+    }
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    std::swap(capacity, other.capacity);
+}
+
+template <typename T, class Allocator>
+void swap(DynamicArray<T, Allocator> &first, DynamicArray<T, Allocator> &second)
+{
+    first.swap(second);
+}
+
+template <typename T, class Allocator>
+T &DynamicArray<T, Allocator>::get(const SequenceIndex index)
 {
     if (index < 0 || index >= size)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
     return data[index];
 }
 
-template <typename T>
-const T &DynamicArray<T>::get(const int index) const
+template <typename T, class Allocator>
+const T &DynamicArray<T, Allocator>::get(const SequenceIndex index) const
 {
     if (index < 0 || index >= size)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
     return data[index];
 }
 
-template <typename T>
-T &DynamicArray<T>::getFirst()
+template <typename T, class Allocator>
+T &DynamicArray<T, Allocator>::getFirst()
 {
     if (size == 0)
     {
-        throw std::out_of_range("Array is empty");
+        sequenceThrow<std::out_of_range>("Array is empty");
     }
 
     return data[0];
 }
 
-template <typename T>
-const T &DynamicArray<T>::getFirst() const
+template <typename T, class Allocator>
+const T &DynamicArray<T, Allocator>::getFirst() const
 {
     if (size == 0)
     {
-        throw std::out_of_range("Array is empty");
+        sequenceThrow<std::out_of_range>("Array is empty");
     }
 
     return data[0];
 }
 
-template <typename T>
-T &DynamicArray<T>::getLast()
+template <typename T, class Allocator>
+T &DynamicArray<T, Allocator>::getLast()
 {
     if (size == 0)
     {
-        throw std::out_of_range("List is empty");
+        sequenceThrow<std::out_of_range>("List is empty");
     }
 
     return data[size - 1];
 }
 
-template <typename T>
-const T &DynamicArray<T>::getLast() const
+template <typename T, class Allocator>
+const T &DynamicArray<T, Allocator>::getLast() const
 {
     if (size == 0)
     {
-        throw std::out_of_range("List is empty");
+        sequenceThrow<std::out_of_range>("List is empty");
     }
 
     return data[size - 1];
 }
 
-template <typename T>
-int DynamicArray<T>::getSize() const
+template <typename T, class Allocator>
+SequenceIndex DynamicArray<T, Allocator>::getSize() const
 {
     return size;
 }
 
-template <class T>
-void DynamicArray<T>::append(const T &item)
+template <typename T, class Allocator>
+SequenceIndex DynamicArray<T, Allocator>::getCapacity() const
+{
+    return capacity;
+}
+
+template <typename T, class Allocator>
+T *DynamicArray<T, Allocator>::getData()
+{
+    return data;
+}
+
+template <typename T, class Allocator>
+const T *DynamicArray<T, Allocator>::getData() const
+{
+    return data;
+}
+
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::append(const T &item)
 {
     if (size >= capacity)
     {
@@ -125,8 +235,8 @@ void DynamicArray<T>::append(const T &item)
     data[size - 1] = item;
 }
 
-template <class T>
-void DynamicArray<T>::prepend(const T &item)
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::prepend(const T &item)
 {
     if (size >= capacity)
     {
@@ -137,31 +247,32 @@ void DynamicArray<T>::prepend(const T &item)
         size++;
     }
 
-    for (int i = size - 1; i > 0; i--)
+    for (SequenceIndex i = size - 1; i > 0; i--)
     {
         data[i] = data[i - 1];
     }
+    SEQUENCE_STATS_ADD(DynamicArray, elementMoves, size - 1);
 
     data[0] = item;
 }
 
-template <typename T>
-void DynamicArray<T>::set(const int index, const T &value)
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::set(const SequenceIndex index, const T &value)
 {
     if (index < 0 || index >= size)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
     data[index] = value;
 }
 
-template <class T>
-void DynamicArray<T>::insertAt(const T &item, int index)
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::insertAt(const T &item, SequenceIndex index)
 {
 
     if (index < 0 || index > size)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
 
     if (index == size)
@@ -185,38 +296,134 @@ void DynamicArray<T>::insertAt(const T &item, int index)
         size++;
     }
 
-    for (int i = size - 1; i > index; i--)
+    for (SequenceIndex i = size - 1; i > index; i--)
     {
         data[i] = data[i - 1];
     }
+    SEQUENCE_STATS_ADD(DynamicArray, elementMoves, size - 1 - index);
 
     data[index] = item;
 }
 
-template <typename T>
-void DynamicArray<T>::resize(const int newSize)
+template <typename T, class Allocator>
+SequenceResult<T> DynamicArray<T, Allocator>::tryGet(const SequenceIndex index)
+{
+    if (index < 0 || index >= size)
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    return data[index];
+}
+
+template <typename T, class Allocator>
+SequenceResult<const T> DynamicArray<T, Allocator>::tryGet(const SequenceIndex index) const
+{
+    if (index < 0 || index >= size)
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    return data[index];
+}
+
+template <typename T, class Allocator>
+SequenceStatus DynamicArray<T, Allocator>::trySet(const SequenceIndex index, const T &value)
+{
+    if (index < 0 || index >= size)
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    set(index, value);
+    return SequenceStatus::Ok;
+}
+
+template <typename T, class Allocator>
+SequenceStatus DynamicArray<T, Allocator>::tryInsertAt(const T &item, const SequenceIndex index)
+{
+    if (index < 0 || index > size)
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    insertAt(item, index);
+    return SequenceStatus::Ok;
+}
+
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    if (index < 0 || index > size)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+    if (count == 0)
+    {
+        return;
+    }
+
+    std::less<const T *> before;
+    if (!before(items, data) && before(items, data + size))
+    {
+        DynamicArray<T, Allocator> copy(items, count, allocator);
+        insertRange(index, copy.data, count);
+        return;
+    }
+
+    if (count > maxElements(allocator) - size)
+    {
+        sequenceThrow<std::length_error>("Requested size exceeds maximum capacity");
+    }
+
+    SequenceIndex oldSize = size;
+    resize(size + count);
+
+    for (SequenceIndex i = oldSize - 1; i >= index; i--)
+    {
+        data[i + count] = std::move(data[i]);
+    }
+    for (SequenceIndex i = 0; i < count; i++)
+    {
+        data[index + i] = items[i];
+    }
+    SEQUENCE_STATS_ADD(DynamicArray, elementMoves, oldSize - index);
+    SEQUENCE_STATS_COPY(DynamicArray, count, sizeof(T) * count);
+}
+
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::appendRange(const T *items, const SequenceIndex count)
+{
+    insertRange(size, items, count);
+}
+
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::prependRange(const T *items, const SequenceIndex count)
+{
+    insertRange(0, items, count);
+}
+
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::resize(const SequenceIndex newSize)
 {
     if (newSize < 0)
     {
-        throw std::invalid_argument("Invalid size");
+        sequenceThrow<std::invalid_argument>("Invalid size");
     }
 
     if (newSize > capacity)
     {
-        int newCapacity = capacity * 2;
-        while (newCapacity < newSize)
-        {
-            newCapacity *= 2;
-        }
-
-        T *newData = new T[newCapacity];
+        SequenceIndex newCapacity = growCapacity(capacity, newSize, maxElements(allocator));
+        T *newData = allocate(newCapacity);
 
-        for (int i = 0; i < size; ++i)
+        for (SequenceIndex i = 0; i < size; ++i)
         {
             newData[i] = data[i];
         }
+        SEQUENCE_STATS_ADD(DynamicArray, reallocations, 1);
+        SEQUENCE_STATS_COPY(DynamicArray, size, sizeof(T) * size);
 
-        delete[] data;
+        release(data, capacity);
         data = newData;
         capacity = newCapacity;
     }
@@ -224,123 +431,229 @@ void DynamicArray<T>::resize(const int newSize)
     size = newSize;
 }
 
-template <typename T>
-DynamicArray<T> *DynamicArray<T>::getSubArray(const int startIndex, const int endIndex)
+template <typename T, class Allocator>
+DynamicArray<T, Allocator> *DynamicArray<T, Allocator>::getSubArray(const SequenceIndex startIndex, const SequenceIndex endIndex)
 {
     if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
     {
-        throw std::out_of_range("Invalid index range");
+        sequenceThrow<std::out_of_range>("Invalid index range");
     }
 
-    int subLength = endIndex - startIndex + 1;
+    SequenceIndex subLength = endIndex - startIndex + 1;
 
-    DynamicArray<T> *result = new DynamicArray<T>(subLength);
+    DynamicArray<T, Allocator> *result = new DynamicArray<T, Allocator>(subLength, AllocatorTraits::select_on_container_copy_construction(allocator));
     result->size = subLength;
     result->capacity = subLength;
 
-    for (int i = startIndex; i <= endIndex; i++)
+    for (SequenceIndex i = startIndex; i <= endIndex; i++)
     {
         result->data[i - startIndex] = data[i];
     }
+    SEQUENCE_STATS_COPY(DynamicArray, subLength, sizeof(T) * subLength);
 
     return result;
 }
 
-template <typename T>
-void DynamicArray<T>::print() const
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::writeTo(std::ostream &out, const SequenceFormat &format) const
 {
-    for (int i = 0; i < size; i++)
-    {
+    writeItems(out, data, size, format);
+}
 
-        std::cout << "[" << data[i] << "]";
-        if (i < size - 1)
-        {
-            std::cout << ", ";
-        }
-    }
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::print() const
+{
+    writeTo(std::cout);
+}
+
+template <typename T, class Allocator>
+std::ostream &operator<<(std::ostream &out, const DynamicArray<T, Allocator> &dynamicArray)
+{
+    dynamicArray.writeTo(out);
+    return out;
 }
 
-template <class T>
-void DynamicArray<T>::clear()
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::clear()
 {
-    T *newData = new T[1];
-    delete[] data;
+    T *newData = allocate(1);
+    release(data, capacity);
     data = newData;
     size = 0;
     capacity = 1;
 }
 
-template <typename T>
-DynamicArray<T> *DynamicArray<T>::concatImmutable(DynamicArray<T> *dynamicArray)
+template <typename T, class Allocator>
+template <class Compare>
+void DynamicArray<T, Allocator>::sort(Compare compare, const int threads)
+{
+    parallelSort(data, size, compare, threads, false);
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+void DynamicArray<T, Allocator>::stableSort(Compare compare, const int threads)
+{
+    parallelSort(data, size, compare, threads, true);
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+void DynamicArray<T, Allocator>::merge(const DynamicArray<T, Allocator> &other, Compare compare)
+{
+    if (&other == this)
+    {
+        sequenceThrow<std::invalid_argument>("Cannot merge with itself");
+    }
+
+    SequenceIndex i = size - 1;
+    SequenceIndex j = other.size - 1;
+    resize(size + other.size);
+
+    for (SequenceIndex k = size - 1; j >= 0; k--)
+    {
+        if (i >= 0 && compare(other.data[j], data[i]))
+        {
+            data[k] = std::move(data[i--]);
+            SEQUENCE_STATS_ADD(DynamicArray, elementMoves, 1);
+        }
+        else
+        {
+            data[k] = other.data[j--];
+        }
+    }
+    SEQUENCE_STATS_COPY(DynamicArray, other.size, sizeof(T) * other.size);
+}
+
+template <typename T, class Allocator>
+DynamicArray<T, Allocator> *DynamicArray<T, Allocator>::concatImmutable(DynamicArray<T, Allocator> *dynamicArray)
 {
     if (!dynamicArray)
     {
-        DynamicArray<T> *result = new DynamicArray<T>(*this);
+        DynamicArray<T, Allocator> *result = new DynamicArray<T, Allocator>(*this);
         return result;
     }
-    DynamicArray<T> *result = new DynamicArray<T>(*this);
+    DynamicArray<T, Allocator> *result = new DynamicArray<T, Allocator>(*this);
     result->concat(dynamicArray);
     return result;
 }
 
-template <typename T>
-void DynamicArray<T>::concat(DynamicArray<T> *dynamicArray)
+template <typename T, class Allocator>
+void DynamicArray<T, Allocator>::concat(DynamicArray<T, Allocator> *dynamicArray)
 {
     if (!dynamicArray)
     {
         return;
     }
 
-    int oldSize = size;
+    SequenceIndex oldSize = size;
     resize(size + dynamicArray->size);
 
-    for (int i = 0; i < dynamicArray->size; i++)
+    for (SequenceIndex i = 0; i < dynamicArray->size; i++)
     {
         data[oldSize + i] = dynamicArray->data[i];
     }
+    SEQUENCE_STATS_COPY(DynamicArray, dynamicArray->size, sizeof(T) * dynamicArray->size);
 }
 
-template <typename T>
-DynamicArray<T> &DynamicArray<T>::operator=(const DynamicArray<T> &other)
+template <typename T, class Allocator>
+DynamicArray<T, Allocator> &DynamicArray<T, Allocator>::operator=(const DynamicArray<T, Allocator> &other)
 {
     if (this == &other)
     {
         return *this;
     }
 
-    if (size != other.size)
+    if (AllocatorTraits::propagate_on_container_copy_assignment::value)
     {
-        delete[] data;
-        data = new T[other.size];
-        size = other.size;
+        if (allocator != other.allocator)
+        {
+            release(data, capacity);
+            data = nullptr;
+            size = 0;
+            capacity = 0;
+        }
+        allocator = other.allocator;
     }
 
-    capacity = other.capacity;
+    if (!data || other.size > capacity)
+    {
+        SequenceIndex newCapacity = other.size > 0 ? other.size : 1;
+        T *newData = allocate(newCapacity);
+        release(data, capacity);
+        data = newData;
+        capacity = newCapacity;
+    }
 
-    for (int i = 0; i < size; i++)
+    size = other.size;
+    for (SequenceIndex i = 0; i < size; i++)
     {
         data[i] = other.data[i];
     }
+    SEQUENCE_STATS_COPY(DynamicArray, size, sizeof(T) * size);
+
+    return *this;
+}
 
+template <typename T, class Allocator>
+DynamicArray<T, Allocator> &DynamicArray<T, Allocator>::operator=(DynamicArray<T, Allocator> &&other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    if (AllocatorTraits::propagate_on_container_move_assignment::value || allocator == other.allocator)
+    {
+        release(data, capacity);
+        if (AllocatorTraits::propagate_on_container_move_assignment::value)
+        {
+            allocator = std::move(other.allocator);
+        }
+        data = other.data;
+        size = other.size;
+        capacity = other.capacity;
+        other.data = nullptr;
+        other.size = 0;
+        other.capacity = 0;
+        return *this;
+    }
+
+    if (!data || other.size > capacity)
+    {
+        SequenceIndex newCapacity = other.size > 0 ? other.size : 1;
+        T *newData = allocate(newCapacity);
+        release(data, capacity);
+        data = newData;
+        capacity = newCapacity;
+    }
+
+    size = other.size;
+    for (SequenceIndex i = 0; i < size; i++)
+    {
+        data[i] = std::move(other.data[i]);
+    }
+    SEQUENCE_STATS_ADD(DynamicArray, elementMoves, size);
+    other.size = 0;
     return *this;
 }
 
-template <typename T>
-T &DynamicArray<T>::operator[](int index)
+template <typename T, class Allocator>
+T &DynamicArray<T, Allocator>::operator[](SequenceIndex index)
 {
     if (index < 0 || index >= size)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
     return data[index];
 }
 
-template <typename T>
-const T &DynamicArray<T>::operator[](int index) const
+template <typename T, class Allocator>
+const T &DynamicArray<T, Allocator>::operator[](SequenceIndex index) const
 {
     if (index < 0 || index >= size)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
     return data[index];
 }
@@ -0,0 +1,276 @@
+#include <stdexcept>
+#include "../inc/hashIndex.hpp"
+#include "../inc/sequenceError.hpp"
+
+template <class T, class Hash, class Equal>
+class HashIndex<T, Hash, Equal>::Scanner : public ChunkVisitor<T>
+{
+private:
+    HashIndex<T, Hash, Equal> &owner;
+    Slot *target;
+
+public:
+    bool seen;
+
+    Scanner(HashIndex<T, Hash, Equal> &owner, Slot *target) : owner(owner), target(target), seen(false) {}
+
+    bool visit(const T *items, const SequenceIndex count, const SequenceIndex offset) override
+    {
+        if (!target)
+        {
+            for (SequenceIndex i = 0; i < count; i++)
+            {
+                owner.add(items[i], offset + i);
+            }
+            return true;
+        }
+
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            if (owner.equal(items[i], target->key))
+            {
+                SequenceIndex position = offset + i - owner.origin;
+                if (!seen)
+                {
+                    target->first = position;
+                    seen = true;
+                }
+                target->last = position;
+            }
+        }
+        return true;
+    }
+};
+
+template <class T, class Hash, class Equal>
+HashIndex<T, Hash, Equal>::HashIndex(const Hash &hash, const Equal &equal)
+    : slots(), bits(0), used(0), removed(0), origin(0), hash(hash), equal(equal)
+{
+    rehash(MIN_CAPACITY);
+}
+
+template <class T, class Hash, class Equal>
+ValueIndex<T> *HashIndex<T, Hash, Equal>::clone() const
+{
+    return new HashIndex<T, Hash, Equal>(*this);
+}
+
+template <class T, class Hash, class Equal>
+std::size_t HashIndex<T, Hash, Equal>::home(const T &value) const
+{
+    std::uint64_t mixed = static_cast<std::uint64_t>(hash(value)) * 11400714819323198485ull;
+    return static_cast<std::size_t>(mixed >> (64 - bits));
+}
+
+template <class T, class Hash, class Equal>
+SequenceIndex HashIndex<T, Hash, Equal>::locate(const T &value) const
+{
+    std::size_t mask = static_cast<std::size_t>(slots.getSize()) - 1;
+    for (std::size_t i = home(value);; i = (i + 1) & mask)
+    {
+        const Slot &slot = slots[i];
+        if (slot.state == Empty)
+        {
+            return -1;
+        }
+        if (slot.state == Full && equal(slot.key, value))
+        {
+            return i;
+        }
+    }
+}
+
+template <class T, class Hash, class Equal>
+void HashIndex<T, Hash, Equal>::reserveSlot()
+{
+    SequenceIndex capacity = slots.getSize();
+    if ((used + removed + 1) * 2 <= capacity)
+    {
+        return;
+    }
+    while ((used + 1) * 4 > capacity)
+    {
+        capacity *= 2;
+    }
+    rehash(capacity);
+}
+
+template <class T, class Hash, class Equal>
+void HashIndex<T, Hash, Equal>::rehash(const SequenceIndex capacity)
+{
+    DynamicArray<Slot> old(capacity);
+    old.swap(slots);
+    bits = 0;
+    while ((SequenceIndex(1) << bits) < capacity)
+    {
+        bits++;
+    }
+
+    std::size_t mask = static_cast<std::size_t>(capacity) - 1;
+    for (SequenceIndex i = 0; i < old.getSize(); i++)
+    {
+        if (old[i].state != Full)
+        {
+            continue;
+        }
+        std::size_t j = home(old[i].key);
+        while (slots[j].state == Full)
+        {
+            j = (j + 1) & mask;
+        }
+        slots[j] = old[i];
+    }
+    removed = 0;
+}
+
+template <class T, class Hash, class Equal>
+void HashIndex<T, Hash, Equal>::rebuild(const Sequence<T> &source)
+{
+    clear();
+    Scanner scanner(*this, nullptr);
+    source.visitChunks(scanner);
+}
+
+template <class T, class Hash, class Equal>
+void HashIndex<T, Hash, Equal>::add(const T &value, const SequenceIndex position)
+{
+    SequenceIndex stored = position - origin;
+    SequenceIndex found = locate(value);
+    if (found >= 0)
+    {
+        Slot &slot = slots[found];
+        if (stored < slot.first)
+        {
+            slot.first = stored;
+        }
+        if (stored > slot.last)
+        {
+            slot.last = stored;
+        }
+        slot.count++;
+        return;
+    }
+
+    reserveSlot();
+    std::size_t mask = static_cast<std::size_t>(slots.getSize()) - 1;
+    std::size_t i = home(value);
+    while (slots[i].state == Full)
+    {
+        i = (i + 1) & mask;
+    }
+    if (slots[i].state == Removed)
+    {
+        removed--;
+    }
+    Slot &slot = slots[i];
+    slot.key = value;
+    slot.first = stored;
+    slot.last = stored;
+    slot.count = 1;
+    slot.state = Full;
+    used++;
+}
+
+template <class T, class Hash, class Equal>
+void HashIndex<T, Hash, Equal>::remove(const T &value, const SequenceIndex position, const Sequence<T> &source)
+{
+    SequenceIndex found = locate(value);
+    if (found < 0)
+    {
+        return;
+    }
+
+    Slot &slot = slots[found];
+    SequenceIndex stored = position - origin;
+    if (--slot.count == 0)
+    {
+        slot.key = T();
+        slot.state = Removed;
+        used--;
+        removed++;
+        return;
+    }
+    if (stored != slot.first && stored != slot.last)
+    {
+        return;
+    }
+
+    Scanner scanner(*this, &slot);
+    source.visitChunks(scanner);
+    if (!scanner.seen)
+    {
+        sequenceThrow<std::logic_error>("Index out of sync with sequence");
+    }
+}
+
+template <class T, class Hash, class Equal>
+void HashIndex<T, Hash, Equal>::shift(const SequenceIndex from, const SequenceIndex delta)
+{
+    if (from <= 0)
+    {
+        origin += delta;
+        return;
+    }
+
+    SequenceIndex stored = from - origin;
+    for (SequenceIndex i = 0; i < slots.getSize(); i++)
+    {
+        Slot &slot = slots[i];
+        if (slot.state != Full)
+        {
+            continue;
+        }
+        if (slot.first >= stored)
+        {
+            slot.first += delta;
+        }
+        if (slot.last >= stored)
+        {
+            slot.last += delta;
+        }
+    }
+}
+
+template <class T, class Hash, class Equal>
+SequenceIndex HashIndex<T, Hash, Equal>::first(const T &value) const
+{
+    SequenceIndex found = locate(value);
+    return found < 0 ? -1 : slots[found].first + origin;
+}
+
+template <class T, class Hash, class Equal>
+SequenceIndex HashIndex<T, Hash, Equal>::last(const T &value) const
+{
+    SequenceIndex found = locate(value);
+    return found < 0 ? -1 : slots[found].last + origin;
+}
+
+template <class T, class Hash, class Equal>
+SequenceIndex HashIndex<T, Hash, Equal>::count(const T &value) const
+{
+    SequenceIndex found = locate(value);
+    return found < 0 ? 0 : slots[found].count;
+}
+
+template <class T, class Hash, class Equal>
+SequenceIndex HashIndex<T, Hash, Equal>::getDistinct() const
+{
+    return used;
+}
+
+template <class T, class Hash, class Equal>
+SequenceIndex HashIndex<T, Hash, Equal>::getCapacity() const
+{
+    return slots.getSize();
+}
+
+template <class T, class Hash, class Equal>
+void HashIndex<T, Hash, Equal>::clear()
+{
+    DynamicArray<Slot> empty(MIN_CAPACITY);
+    slots.swap(empty);
+    used = 0;
+    removed = 0;
+    origin = 0;
+    rehash(MIN_CAPACITY);
+}
@@ -3,11 +3,11 @@
 
 //* Iterator {
 
-template <typename T>
-LinkedList<T>::Iterator::Iterator(Node *nodePtr) : current(nodePtr) {}
+template <typename T, class Allocator>
+LinkedList<T, Allocator>::Iterator::Iterator(Node *nodePtr) : current(nodePtr) {}
 
-template <typename T>
-typename LinkedList<T>::Iterator &LinkedList<T>::Iterator::operator++()
+template <typename T, class Allocator>
+typename LinkedList<T, Allocator>::Iterator &LinkedList<T, Allocator>::Iterator::operator++()
 {
     if (current)
     {
@@ -16,50 +16,50 @@ typename LinkedList<T>::Iterator &LinkedList<T>::Iterator::operator++()
     return *this;
 }
 
-template <typename T>
-typename LinkedList<T>::Iterator LinkedList<T>::Iterator::operator++(int)
+template <typename T, class Allocator>
+typename LinkedList<T, Allocator>::Iterator LinkedList<T, Allocator>::Iterator::operator++(int)
 {
     Iterator temp = *this;
     ++(*this);
     return temp;
 }
 
-template <typename T>
-T &LinkedList<T>::Iterator::operator*() const
+template <typename T, class Allocator>
+T &LinkedList<T, Allocator>::Iterator::operator*() const
 {
     if (!current)
     {
-        throw std::runtime_error("Invalid iterator");
+        sequenceThrow<std::runtime_error>("Invalid iterator");
     }
     return current->value;
 }
 
-template <typename T>
-bool LinkedList<T>::Iterator::operator==(const Iterator &other) const
+template <typename T, class Allocator>
+bool LinkedList<T, Allocator>::Iterator::operator==(const Iterator &other) const
 {
     return current == other.current;
 }
 
-template <typename T>
-bool LinkedList<T>::Iterator::operator!=(const Iterator &other) const
+template <typename T, class Allocator>
+bool LinkedList<T, Allocator>::Iterator::operator!=(const Iterator &other) const
 {
     return !(*this == other);
 }
 
-template <typename T>
-void LinkedList<T>::Iterator::insert(const T &item)
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::Iterator::insert(const T &item)
 {
-    throw std::runtime_error("Insert operation not supported directly through iterator");
+    sequenceThrow<std::runtime_error>("Insert operation not supported directly through iterator");
 }
 
-template <typename T>
-void LinkedList<T>::Iterator::erase()
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::Iterator::erase()
 {
-    throw std::runtime_error("Erase operation not supported directly through iterator");
+    sequenceThrow<std::runtime_error>("Erase operation not supported directly through iterator");
 }
 
-template <typename T>
-bool LinkedList<T>::Iterator::notEnd()
+template <typename T, class Allocator>
+bool LinkedList<T, Allocator>::Iterator::notEnd()
 {
     return current != nullptr;
 }
@@ -68,11 +68,11 @@ bool LinkedList<T>::Iterator::notEnd()
 
 //* ConstIterator {
 
-template <typename T>
-LinkedList<T>::ConstIterator::ConstIterator(const Node *nodePtr) : current(nodePtr) {}
+template <typename T, class Allocator>
+LinkedList<T, Allocator>::ConstIterator::ConstIterator(const Node *nodePtr) : current(nodePtr) {}
 
-template <typename T>
-typename LinkedList<T>::ConstIterator &LinkedList<T>::ConstIterator::operator++()
+template <typename T, class Allocator>
+typename LinkedList<T, Allocator>::ConstIterator &LinkedList<T, Allocator>::ConstIterator::operator++()
 {
     if (current)
     {
@@ -81,109 +81,219 @@ typename LinkedList<T>::ConstIterator &LinkedList<T>::ConstIterator::operator++(
     return *this;
 }
 
-template <typename T>
-typename LinkedList<T>::ConstIterator LinkedList<T>::ConstIterator::operator++(int)
+template <typename T, class Allocator>
+typename LinkedList<T, Allocator>::ConstIterator LinkedList<T, Allocator>::ConstIterator::operator++(int)
 {
     ConstIterator temp = *this;
     ++(*this);
     return temp;
 }
 
-template <typename T>
-const T &LinkedList<T>::ConstIterator::operator*() const
+template <typename T, class Allocator>
+const T &LinkedList<T, Allocator>::ConstIterator::operator*() const
 {
     if (!current)
     {
-        throw std::runtime_error("Dereferencing invalid iterator");
+        sequenceThrow<std::runtime_error>("Dereferencing invalid iterator");
     }
     return current->value;
 }
 
-template <typename T>
-bool LinkedList<T>::ConstIterator::operator==(const ConstIterator &other) const
+template <typename T, class Allocator>
+bool LinkedList<T, Allocator>::ConstIterator::operator==(const ConstIterator &other) const
 {
     return current == other.current;
 }
 
-template <typename T>
-bool LinkedList<T>::ConstIterator::operator!=(const ConstIterator &other) const
+template <typename T, class Allocator>
+bool LinkedList<T, Allocator>::ConstIterator::operator!=(const ConstIterator &other) const
 {
     return !(*this == other);
 }
 
-template <typename T>
-bool LinkedList<T>::ConstIterator::notEnd() const
+template <typename T, class Allocator>
+bool LinkedList<T, Allocator>::ConstIterator::notEnd() const
 {
     return current != nullptr;
 }
 
 //* } end of ConstIterator section
 
-template <typename T>
-LinkedList<T>::LinkedList() : head(nullptr), length(0) {}
+template <typename T, class Allocator>
+typename LinkedList<T, Allocator>::Node *LinkedList<T, Allocator>::createNode(const T &value)
+{
+    Node *node = NodeTraits::allocate(allocator, 1);
+    SEQUENCE_TRY
+    {
+        NodeTraits::construct(allocator, node, value);
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        NodeTraits::deallocate(allocator, node, 1);
+        SEQUENCE_RETHROW;
+    }
+    SEQUENCE_STATS_ALLOCATE(LinkedList, sizeof(Node));
+    SEQUENCE_STATS_COPY(LinkedList, 1, sizeof(T));
+    return node;
+}
+
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::destroyNode(Node *node)
+{
+    NodeTraits::destroy(allocator, node);
+    NodeTraits::deallocate(allocator, node, 1);
+    SEQUENCE_STATS_FREE(LinkedList);
+}
+
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::copyNodes(const LinkedList<T, Allocator> &list)
+{
+    Node **tail = &head;
+    SEQUENCE_TRY
+    {
+        for (ConstIterator it = list.begin(); it != list.end(); ++it)
+        {
+            *tail = createNode(*it);
+            tail = &(*tail)->next;
+            length++;
+        }
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        clear();
+        SEQUENCE_RETHROW;
+    }
+}
+
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::checkAllocator(const LinkedList<T, Allocator> &other) const
+{
+    if (!(allocator == other.allocator))
+    {
+        sequenceThrow<std::invalid_argument>("Lists use different allocators");
+    }
+}
+
+template <typename T, class Allocator>
+LinkedList<T, Allocator>::LinkedList() : allocator(), head(nullptr), length(0) {}
+
+template <typename T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(const Allocator &allocator) : allocator(allocator), head(nullptr), length(0) {}
 
-template <class T>
-LinkedList<T>::LinkedList(const int count) : head(nullptr), length(0)
+template <typename T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(const SequenceIndex count, const Allocator &allocator) : allocator(allocator), head(nullptr), length(0)
 {
     if (count < 0)
     {
-        throw std::invalid_argument("Count cannot be negative");
+        sequenceThrow<std::invalid_argument>("Count cannot be negative");
     }
 
     T defaultValue = T();
-    for (int i = 0; i < count; i++)
+    SEQUENCE_TRY
     {
-        append(defaultValue);
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            prepend(defaultValue);
+        }
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        clear();
+        SEQUENCE_RETHROW;
     }
 }
 
-template <typename T>
-LinkedList<T>::LinkedList(const T *items, const int count) : head(nullptr), length(0)
+template <typename T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(const T *items, const SequenceIndex count, const Allocator &allocator) : allocator(allocator), head(nullptr), length(0)
 {
     if (!items)
     {
-        throw std::invalid_argument("Count must be greater than 0");
+        sequenceThrow<std::invalid_argument>("Count must be greater than 0");
     }
 
-    for (int i = 0; i < count; i++)
+    SEQUENCE_TRY
+    {
+        for (SequenceIndex i = count - 1; i >= 0; i--)
+        {
+            prepend(items[i]);
+        }
+    }
+    SEQUENCE_CATCH_ALL
     {
-        append(items[i]);
+        clear();
+        SEQUENCE_RETHROW;
     }
 }
 
-template <typename T>
-LinkedList<T>::LinkedList(const LinkedList<T> &list) : head(nullptr), length(0)
+template <typename T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(const LinkedList<T, Allocator> &list)
+    : allocator(NodeTraits::select_on_container_copy_construction(list.allocator)), head(nullptr), length(0)
 {
-    for (ConstIterator it = list.begin(); it != list.end(); ++it)
+    copyNodes(list);
+}
+
+template <typename T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(const LinkedList<T, Allocator> &list, const Allocator &allocator)
+    : allocator(allocator), head(nullptr), length(0)
+{
+    copyNodes(list);
+}
+
+template <typename T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(LinkedList<T, Allocator> &&list) noexcept
+    : allocator(std::move(list.allocator)), head(list.head), length(list.length)
+{
+    list.head = nullptr;
+    list.length = 0;
+}
+
+template <typename T, class Allocator>
+LinkedList<T, Allocator>::~LinkedList()
+{
+    clear();
+}
+
+template <typename T, class Allocator>
+Allocator LinkedList<T, Allocator>::getAllocator() const
+{
+    return Allocator(allocator);
+}
+
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::swap(LinkedList<T, Allocator> &other)
+{
+    if (NodeTraits::propagate_on_container_swap::value)
     {
-        append(*it);
+        std::swap(allocator, other.allocator);
     }
+    std::swap(head, other.head);
+    std::swap(length, other.length);
 }
 
-template <typename T>
-LinkedList<T>::~LinkedList()
+template <typename T, class Allocator>
+void swap(LinkedList<T, Allocator> &first, LinkedList<T, Allocator> &second)
 {
-    clear();
+    first.swap(second);
 }
 
-template <typename T>
-void LinkedList<T>::clear()
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::clear()
 {
     Node *current = head;
     while (current != nullptr)
     {
         Node *next = current->next;
-        delete current;
+        destroyNode(current);
         current = next;
     }
     head = nullptr;
     length = 0;
 }
 
-template <typename T>
-void LinkedList<T>::append(const T &item)
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::append(const T &item)
 {
-    Node *newNode = new Node(item);
+    Node *newNode = createNode(item);
 
     if (!head)
     {
@@ -196,47 +306,48 @@ void LinkedList<T>::append(const T &item)
         {
             ++it;
         }
+        SEQUENCE_STATS_ADD(LinkedList, traversalSteps, length - 1);
         it.current->next = newNode;
     }
 
     length++;
 }
 
-template <typename T>
-void LinkedList<T>::prepend(const T &item)
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::prepend(const T &item)
 {
-    Node *newNode = new Node(item);
+    Node *newNode = createNode(item);
     newNode->next = head;
     head = newNode;
     length++;
 }
 
-template <typename T>
-T &LinkedList<T>::getFirst()
+template <typename T, class Allocator>
+T &LinkedList<T, Allocator>::getFirst()
 {
     if (!head)
     {
-        throw std::out_of_range("List is empty");
+        sequenceThrow<std::out_of_range>("List is empty");
     }
     return head->value;
 }
 
-template <typename T>
-const T &LinkedList<T>::getFirst() const
+template <typename T, class Allocator>
+const T &LinkedList<T, Allocator>::getFirst() const
 {
     if (!head)
     {
-        throw std::out_of_range("List is empty");
+        sequenceThrow<std::out_of_range>("List is empty");
     }
     return head->value;
 }
 
-template <typename T>
-T &LinkedList<T>::getLast()
+template <typename T, class Allocator>
+T &LinkedList<T, Allocator>::getLast()
 {
     if (!head)
     {
-        throw std::out_of_range("List is empty");
+        sequenceThrow<std::out_of_range>("List is empty");
     }
 
     Iterator it = begin();
@@ -244,15 +355,16 @@ T &LinkedList<T>::getLast()
     {
         ++it;
     }
+    SEQUENCE_STATS_ADD(LinkedList, traversalSteps, length - 1);
     return *it;
 }
 
-template <typename T>
-const T &LinkedList<T>::getLast() const
+template <typename T, class Allocator>
+const T &LinkedList<T, Allocator>::getLast() const
 {
     if (!head)
     {
-        throw std::out_of_range("List is empty");
+        sequenceThrow<std::out_of_range>("List is empty");
     }
 
     ConstIterator it = begin();
@@ -260,63 +372,67 @@ const T &LinkedList<T>::getLast() const
     {
         ++it;
     }
+    SEQUENCE_STATS_ADD(LinkedList, traversalSteps, length - 1);
     return *it;
 }
 
-template <typename T>
-T &LinkedList<T>::get(const int index)
+template <typename T, class Allocator>
+T &LinkedList<T, Allocator>::get(const SequenceIndex index)
 {
     if (index < 0 || index >= length)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
 
     Iterator it = begin();
-    for (int i = 0; i < index; i++)
+    for (SequenceIndex i = 0; i < index; i++)
     {
         ++it;
     }
+    SEQUENCE_STATS_ADD(LinkedList, traversalSteps, index);
     return *it;
 }
 
-template <typename T>
-const T &LinkedList<T>::get(const int index) const
+template <typename T, class Allocator>
+const T &LinkedList<T, Allocator>::get(const SequenceIndex index) const
 {
     if (index < 0 || index >= length)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
 
     ConstIterator it = begin();
-    for (int i = 0; i < index; i++)
+    for (SequenceIndex i = 0; i < index; i++)
     {
         ++it;
     }
+    SEQUENCE_STATS_ADD(LinkedList, traversalSteps, index);
     return *it;
 }
 
-template <typename T>
-void LinkedList<T>::set(const int index, const T &value)
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::set(const SequenceIndex index, const T &value)
 {
     if (index < 0 || index >= length)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
 
     Iterator it = begin();
-    for (int i = 0; i < index; i++)
+    for (SequenceIndex i = 0; i < index; i++)
     {
         ++it;
     }
+    SEQUENCE_STATS_ADD(LinkedList, traversalSteps, index);
     it.current->value = value;
 }
 
-template <typename T>
-void LinkedList<T>::insertAt(const T &value, const int index)
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::insertAt(const T &value, const SequenceIndex index)
 {
     if (index < 0 || index > length)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
 
     if (index == 0)
@@ -332,37 +448,156 @@ void LinkedList<T>::insertAt(const T &value, const int index)
     }
 
     Iterator it = begin();
-    for (int i = 0; i < index - 1; i++)
+    for (SequenceIndex i = 0; i < index - 1; i++)
     {
         ++it;
     }
+    SEQUENCE_STATS_ADD(LinkedList, traversalSteps, index - 1);
 
-    Node *newNode = new Node(value);
+    Node *newNode = createNode(value);
     newNode->next = it.current->next;
     it.current->next = newNode;
     length++;
 }
 
-template <typename T>
-LinkedList<T> *LinkedList<T>::getSubList(const int startIndex, const int endIndex) const
+template <typename T, class Allocator>
+SequenceResult<T> LinkedList<T, Allocator>::tryGet(const SequenceIndex index)
+{
+    if (index < 0 || index >= length)
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    return get(index);
+}
+
+template <typename T, class Allocator>
+SequenceResult<const T> LinkedList<T, Allocator>::tryGet(const SequenceIndex index) const
+{
+    if (index < 0 || index >= length)
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    return get(index);
+}
+
+template <typename T, class Allocator>
+SequenceStatus LinkedList<T, Allocator>::trySet(const SequenceIndex index, const T &value)
+{
+    if (index < 0 || index >= length)
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    set(index, value);
+    return SequenceStatus::Ok;
+}
+
+template <typename T, class Allocator>
+SequenceStatus LinkedList<T, Allocator>::tryInsertAt(const T &value, const SequenceIndex index)
+{
+    if (index < 0 || index > length)
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    insertAt(value, index);
+    return SequenceStatus::Ok;
+}
+
+template <typename T, class Allocator>
+typename LinkedList<T, Allocator>::Node **LinkedList<T, Allocator>::linkAt(const SequenceIndex index)
+{
+    Node **link = &head;
+    for (SequenceIndex i = 0; i < index; i++)
+    {
+        link = &(*link)->next;
+    }
+    SEQUENCE_STATS_ADD(LinkedList, traversalSteps, index);
+    return link;
+}
+
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    if (index < 0 || index > length)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+
+    LinkedList<T, Allocator> chain(getAllocator());
+    for (SequenceIndex i = count - 1; i >= 0; i--)
+    {
+        chain.prepend(items[i]);
+    }
+    splice(index, chain);
+}
+
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::appendRange(const T *items, const SequenceIndex count)
+{
+    insertRange(length, items, count);
+}
+
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::prependRange(const T *items, const SequenceIndex count)
+{
+    insertRange(0, items, count);
+}
+
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::splice(const SequenceIndex index, LinkedList<T, Allocator> &other)
+{
+    if (&other == this)
+    {
+        sequenceThrow<std::invalid_argument>("Cannot splice with itself");
+    }
+    checkAllocator(other);
+    if (index < 0 || index > length)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    if (!other.head)
+    {
+        return;
+    }
+
+    Node *last = other.head;
+    while (last->next)
+    {
+        last = last->next;
+    }
+
+    Node **link = linkAt(index);
+    last->next = *link;
+    *link = other.head;
+    length += other.length;
+    other.head = nullptr;
+    other.length = 0;
+}
+
+template <typename T, class Allocator>
+LinkedList<T, Allocator> *LinkedList<T, Allocator>::getSubList(const SequenceIndex startIndex, const SequenceIndex endIndex) const
 {
-    int size = getLength();
+    SequenceIndex size = getLength();
     if (startIndex < 0 || startIndex >= size ||
         endIndex < 0 || endIndex >= size ||
         startIndex > endIndex)
     {
-        throw std::out_of_range("Invalid index range");
+        sequenceThrow<std::out_of_range>("Invalid index range");
     }
 
-    LinkedList<T> *subList = new LinkedList<T>();
+    LinkedList<T, Allocator> *subList = new LinkedList<T, Allocator>(getAllocator());
 
     ConstIterator it = begin();
-    for (int i = 0; i < startIndex; i++)
+    for (SequenceIndex i = 0; i < startIndex; i++)
     {
         ++it;
     }
+    SEQUENCE_STATS_ADD(LinkedList, traversalSteps, endIndex);
 
-    for (int i = startIndex; i <= endIndex; i++)
+    for (SequenceIndex i = startIndex; i <= endIndex; i++)
     {
         subList->append(*it);
         ++it;
@@ -371,56 +606,164 @@ LinkedList<T> *LinkedList<T>::getSubList(const int startIndex, const int endInde
     return subList;
 }
 
-template <typename T>
-int LinkedList<T>::getLength() const
+template <typename T, class Allocator>
+SequenceIndex LinkedList<T, Allocator>::getLength() const
 {
     return length;
 }
 
-template <typename T>
-void LinkedList<T>::print() const
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::writeTo(std::ostream &out, const SequenceFormat &format) const
 {
-    if (length == 0)
-    {
-        std::cout << "Empty list";
-        return;
-    }
+    writeRange(out, begin(), end(), format);
+}
 
-    for (ConstIterator it = begin(); it != end(); ++it)
-    {
-        std::cout << *it << " ";
-    }
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::print() const
+{
+    writeTo(std::cout, SequenceFormat::spaced());
 }
 
-template <typename T>
-LinkedList<T> *LinkedList<T>::concatImmutable(const LinkedList<T> &list) const
+template <typename T, class Allocator>
+std::ostream &operator<<(std::ostream &out, const LinkedList<T, Allocator> &list)
+{
+    list.writeTo(out);
+    return out;
+}
+
+template <typename T, class Allocator>
+LinkedList<T, Allocator> *LinkedList<T, Allocator>::concatImmutable(const LinkedList<T, Allocator> &list) const
 {
     if (&list == this)
     {
-        throw std::invalid_argument("Cannot concatenate with itself");
+        sequenceThrow<std::invalid_argument>("Cannot concatenate with itself");
     }
 
-    LinkedList<T> *result = new LinkedList<T>(*this);
+    LinkedList<T, Allocator> *result = new LinkedList<T, Allocator>(*this);
     result->concat(list);
     return result;
 }
 
-template <typename T>
-void LinkedList<T>::concat(const LinkedList<T> &list)
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::concat(const LinkedList<T, Allocator> &list)
 {
     if (&list == this)
     {
-        throw std::invalid_argument("Cannot concatenate with itself");
+        sequenceThrow<std::invalid_argument>("Cannot concatenate with itself");
     }
 
+    LinkedList<T, Allocator> chain(getAllocator());
     for (ConstIterator it = list.begin(); it != list.end(); ++it)
     {
-        append(*it);
+        chain.prepend(*it);
     }
+    chain.reverse();
+    splice(length, chain);
 }
 
-template <typename T>
-LinkedList<T> &LinkedList<T>::operator=(const LinkedList<T> &other)
+template <typename T, class Allocator>
+void LinkedList<T, Allocator>::reverse()
+{
+    Node *reversed = nullptr;
+    while (head)
+    {
+        Node *next = head->next;
+        head->next = reversed;
+        reversed = head;
+        head = next;
+    }
+    head = reversed;
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+typename LinkedList<T, Allocator>::Node *LinkedList<T, Allocator>::runEnd(Node *node, Compare compare)
+{
+    while (node->next && !compare(node->next->value, node->value))
+    {
+        node = node->next;
+    }
+    return node;
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+typename LinkedList<T, Allocator>::Node **LinkedList<T, Allocator>::mergeNodes(Node *first, Node *second, Node **tail, Compare compare)
+{
+    while (first && second)
+    {
+        if (compare(second->value, first->value))
+        {
+            *tail = second;
+            second = second->next;
+        }
+        else
+        {
+            *tail = first;
+            first = first->next;
+        }
+        tail = &(*tail)->next;
+    }
+
+    *tail = first ? first : second;
+    while (*tail)
+    {
+        tail = &(*tail)->next;
+    }
+    return tail;
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+void LinkedList<T, Allocator>::sort(Compare compare)
+{
+    int pairs = 0;
+    do
+    {
+        Node *remaining = head;
+        Node **tail = &head;
+        pairs = 0;
+
+        while (remaining)
+        {
+            Node *first = remaining;
+            Node *firstEnd = runEnd(first, compare);
+            remaining = firstEnd->next;
+            firstEnd->next = nullptr;
+
+            Node *second = nullptr;
+            if (remaining)
+            {
+                second = remaining;
+                Node *secondEnd = runEnd(second, compare);
+                remaining = secondEnd->next;
+                secondEnd->next = nullptr;
+            }
+
+            tail = mergeNodes(first, second, tail, compare);
+            pairs++;
+        }
+    } while (pairs > 1);
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+void LinkedList<T, Allocator>::merge(LinkedList<T, Allocator> &other, Compare compare)
+{
+    if (&other == this)
+    {
+        sequenceThrow<std::invalid_argument>("Cannot merge with itself");
+    }
+    checkAllocator(other);
+
+    mergeNodes(head, other.head, &head, compare);
+    length += other.length;
+    other.head = nullptr;
+    other.length = 0;
+}
+
+template <typename T, class Allocator>
+LinkedList<T, Allocator> &LinkedList<T, Allocator>::operator=(const LinkedList<T, Allocator> &other)
 {
     if (&other == this)
     {
@@ -428,11 +771,38 @@ LinkedList<T> &LinkedList<T>::operator=(const LinkedList<T> &other)
     }
 
     clear();
+    if (NodeTraits::propagate_on_container_copy_assignment::value)
+    {
+        allocator = other.allocator;
+    }
+    copyNodes(other);
+
+    return *this;
+}
 
-    for (ConstIterator it = other.begin(); it != other.end(); ++it)
+template <typename T, class Allocator>
+LinkedList<T, Allocator> &LinkedList<T, Allocator>::operator=(LinkedList<T, Allocator> &&other)
+{
+    if (&other == this)
+    {
+        return *this;
+    }
+
+    clear();
+    if (NodeTraits::propagate_on_container_move_assignment::value || allocator == other.allocator)
     {
-        append(*it);
+        if (NodeTraits::propagate_on_container_move_assignment::value)
+        {
+            allocator = std::move(other.allocator);
+        }
+        head = other.head;
+        length = other.length;
+        other.head = nullptr;
+        other.length = 0;
+        return *this;
     }
 
+    copyNodes(other);
+    other.clear();
     return *this;
 }
\ No newline at end of file
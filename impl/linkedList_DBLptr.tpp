@@ -1,5 +1,6 @@
 #include <iostream>
 #include "../inc/linkedList_DBLptr.hpp"
+#include "../inc/sequenceError.hpp"
 
 //* Iterator {
 
@@ -29,7 +30,7 @@ T &LinkedList<T>::Iterator::operator*() const
 {
     if (!current || !*current)
     {
-        throw std::runtime_error("Invalid iterator");
+        sequenceThrow<std::runtime_error>("Invalid iterator");
     }
     return (*current)->value;
 }
@@ -111,7 +112,7 @@ const T &LinkedList<T>::ConstIterator::operator*() const
 {
     if (!current || !*current)
     {
-        throw std::runtime_error("Dereferencing invalid iterator");
+        sequenceThrow<std::runtime_error>("Dereferencing invalid iterator");
     }
     return (*current)->value;
 }
@@ -154,7 +155,7 @@ LinkedList<T>::LinkedList(const int count) : head(nullptr), length(0)
 {
     if (count < 0)
     {
-        throw std::invalid_argument("Count cannot be negative");
+        sequenceThrow<std::invalid_argument>("Count cannot be negative");
     }
 
     T defaultValue = T();
@@ -169,7 +170,7 @@ LinkedList<T>::LinkedList(const T *items, const int count) : head(nullptr), leng
 {
     if (!items)
     {
-        throw std::invalid_argument("Count must be greater than 0");
+        sequenceThrow<std::invalid_argument>("Count must be greater than 0");
     }
 
     for (int i = 0; i < count; i++)
@@ -236,7 +237,7 @@ T &LinkedList<T>::getFirst()
 {
     if (!head)
     {
-        throw std::out_of_range("List is empty");
+        sequenceThrow<std::out_of_range>("List is empty");
     }
     return head->value;
 }
@@ -246,7 +247,7 @@ const T &LinkedList<T>::getFirst() const
 {
     if (!head)
     {
-        throw std::out_of_range("List is empty");
+        sequenceThrow<std::out_of_range>("List is empty");
     }
 
     ConstIterator it(&head);
@@ -259,7 +260,7 @@ T &LinkedList<T>::getLast()
 {
     if (!head)
     {
-        throw std::out_of_range("List is empty");
+        sequenceThrow<std::out_of_range>("List is empty");
     }
 
     Node *current = head;
@@ -275,7 +276,7 @@ const T &LinkedList<T>::getLast() const
 {
     if (!head)
     {
-        throw std::out_of_range("List is empty");
+        sequenceThrow<std::out_of_range>("List is empty");
     }
 
     const Node *current = head;
@@ -291,7 +292,7 @@ T &LinkedList<T>::get(const int index)
 {
     if (index < 0 || index >= length)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
 
     Node *current = head;
@@ -307,7 +308,7 @@ const T &LinkedList<T>::get(const int index) const
 {
     if (index < 0 || index >= length)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
 
     const Node *current = head;
@@ -323,7 +324,7 @@ void LinkedList<T>::set(const int index, const T &value)
 {
     if (index < 0 || index >= length)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
 
     Iterator it(&head);
@@ -340,7 +341,7 @@ void LinkedList<T>::insertAt(const T &value, const int index)
 {
     if (index < 0 || index > length)
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
 
     Iterator it(&head);
@@ -362,7 +363,7 @@ LinkedList<T> *LinkedList<T>::getSubList(const int startIndex, const int endInde
         endIndex < 0 || endIndex >= size ||
         startIndex > endIndex)
     {
-        throw std::out_of_range("Invalid index range");
+        sequenceThrow<std::out_of_range>("Invalid index range");
     }
 
     LinkedList<T> *subList = new LinkedList<T>();
@@ -408,7 +409,7 @@ LinkedList<T> *LinkedList<T>::concatImmutable(const LinkedList<T> &list) const
 {
     if (&list == this)
     {
-        throw std::invalid_argument("Cannot concatenate with itself");
+        sequenceThrow<std::invalid_argument>("Cannot concatenate with itself");
     }
 
     LinkedList<T> *result = new LinkedList<T>(*this);
@@ -421,7 +422,7 @@ void LinkedList<T>::concat(const LinkedList<T> &list)
 {
     if (&list == this)
     {
-        throw std::invalid_argument("Cannot concatenate with itself");
+        sequenceThrow<std::invalid_argument>("Cannot concatenate with itself");
     }
 
     for (ConstIterator it = list.begin(); it != list.end(); ++it)
@@ -1,174 +1,462 @@
 #include "../inc/listSequence.hpp"
+#include "../inc/sequenceError.hpp"
 
-template <class T>
-ListSequence<T>::ListSequence() : list() {}
+// Prepends every visited element to a chain, which ends up in reverse order.
+template <class T, class Allocator>
+class ChainPrepender : public ChunkVisitor<T>
+{
+private:
+    LinkedList<T, Allocator> &chain;
+
+public:
+    ChainPrepender(LinkedList<T, Allocator> &chain) : chain(chain) {}
+
+    bool visit(const T *items, const SequenceIndex count, const SequenceIndex) override
+    {
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            chain.prepend(items[i]);
+        }
+        return true;
+    }
+};
+
+template <class T, class Allocator>
+ListSequence<T, Allocator>::ListSequence() : list() {}
+
+template <class T, class Allocator>
+ListSequence<T, Allocator>::ListSequence(const Allocator &allocator) : list(allocator) {}
+
+template <class T, class Allocator>
+ListSequence<T, Allocator>::ListSequence(const T *items, const SequenceIndex count, const Allocator &allocator) : list(items, count, allocator) {}
 
-template <class T>
-ListSequence<T>::ListSequence(const T *items, const int count) : list(items, count) {}
+template <class T, class Allocator>
+ListSequence<T, Allocator>::ListSequence(const SequenceIndex count, const Allocator &allocator) : list(count, allocator) {}
 
-template <class T>
-ListSequence<T>::ListSequence(const int count) : list(count) {}
+template <class T, class Allocator>
+ListSequence<T, Allocator>::ListSequence(const LinkedList<T, Allocator> &list) : list(list) {}
 
-template <class T>
-ListSequence<T>::ListSequence(const LinkedList<T> &list) : list(list) {}
+template <class T, class Allocator>
+ListSequence<T, Allocator>::ListSequence(LinkedList<T, Allocator> &&list) : list(std::move(list)) {}
 
-template <class T>
-ListSequence<T>::~ListSequence() {}
+template <class T, class Allocator>
+ListSequence<T, Allocator>::ListSequence(const ListSequence<T, Allocator> &other)
+    : list(other.list), valueIndex(other.valueIndex ? other.valueIndex->clone() : nullptr), hashCache(other.hashCache) {}
+
+template <class T, class Allocator>
+ListSequence<T, Allocator>::ListSequence(ListSequence<T, Allocator> &&other) noexcept
+    : list(std::move(other.list)), valueIndex(std::move(other.valueIndex)), hashCache(other.hashCache)
+{
+    other.hashCache.clear();
+}
+
+template <class T, class Allocator>
+ListSequence<T, Allocator>::~ListSequence() {}
+
+template <class T, class Allocator>
+Allocator ListSequence<T, Allocator>::getAllocator() const
+{
+    return list.getAllocator();
+}
 
-template <class T>
-T &ListSequence<T>::getFirst()
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::swap(ListSequence<T, Allocator> &other)
 {
+    list.swap(other.list);
+    valueIndex.swap(other.valueIndex);
+    std::swap(hashCache, other.hashCache);
+}
+
+template <class T, class Allocator>
+T &ListSequence<T, Allocator>::getFirst()
+{
+    hashCache.clear();
     return list.getFirst();
 }
 
-template <class T>
-const T &ListSequence<T>::getFirst() const
+template <class T, class Allocator>
+const T &ListSequence<T, Allocator>::getFirst() const
 {
     return list.getFirst();
 }
 
-template <class T>
-T &ListSequence<T>::getLast()
+template <class T, class Allocator>
+T &ListSequence<T, Allocator>::getLast()
 {
+    hashCache.clear();
     return list.getLast();
 }
 
-template <class T>
-const T &ListSequence<T>::getLast() const
+template <class T, class Allocator>
+const T &ListSequence<T, Allocator>::getLast() const
 {
     return list.getLast();
 }
 
-template <class T>
-T &ListSequence<T>::get(int index)
+template <class T, class Allocator>
+T &ListSequence<T, Allocator>::get(SequenceIndex index)
 {
+    hashCache.clear();
     return list.get(index);
 }
 
-template <class T>
-const T &ListSequence<T>::get(const int index) const
+template <class T, class Allocator>
+const T &ListSequence<T, Allocator>::get(const SequenceIndex index) const
 {
     return list.get(index);
 }
 
-template <class T>
-int ListSequence<T>::getLength() const
+template <class T, class Allocator>
+SequenceResult<T> ListSequence<T, Allocator>::tryGet(const SequenceIndex index)
+{
+    hashCache.clear();
+    return list.tryGet(index);
+}
+
+template <class T, class Allocator>
+SequenceResult<const T> ListSequence<T, Allocator>::tryGet(const SequenceIndex index) const
+{
+    return list.tryGet(index);
+}
+
+template <class T, class Allocator>
+SequenceIndex ListSequence<T, Allocator>::getLength() const
 {
     return list.getLength();
 }
 
-template <class T>
-Sequence<T> *ListSequence<T>::getSubsequence(const int startIndex, const int endIndex) const
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::visitChunks(ChunkVisitor<T> &visitor) const
+{
+    SequenceIndex position = 0;
+    for (typename LinkedList<T, Allocator>::ConstIterator it = begin(); it != end(); ++it)
+    {
+        if (!visitor.visit(&*it, 1, position++))
+        {
+            return;
+        }
+    }
+}
+
+template <class T, class Allocator>
+const ValueIndex<T> *ListSequence<T, Allocator>::getValueIndex() const
 {
-    LinkedList<T> *subLinkedList = list.getSubList(startIndex, endIndex);
-    ListSequence<T> *subList = new ListSequence<T>(*subLinkedList);
+    return valueIndex.get();
+}
+
+template <class T, class Allocator>
+int ListSequence<T, Allocator>::compareElements(const Sequence<T> &other, typename Sequence<T>::ElementOrder order) const
+{
+    const ListSequence<T, Allocator> *otherList = dynamic_cast<const ListSequence<T, Allocator> *>(&other);
+    if (!otherList)
+    {
+        return Sequence<T>::compareElements(other, order);
+    }
+
+    typename LinkedList<T, Allocator>::ConstIterator mine = begin();
+    typename LinkedList<T, Allocator>::ConstIterator theirs = otherList->begin();
+    for (; mine != end() && theirs != otherList->end(); ++mine, ++theirs)
+    {
+        int result = order(*mine, *theirs);
+        if (result != 0)
+        {
+            return result;
+        }
+    }
+    return 0;
+}
+
+template <class T, class Allocator>
+SequenceHashCache *ListSequence<T, Allocator>::getHashCache() const
+{
+    return &hashCache;
+}
+
+template <class T, class Allocator>
+template <class Hash, class Equal>
+void ListSequence<T, Allocator>::attachIndex(const Hash &hash, const Equal &equal)
+{
+    std::unique_ptr<ValueIndex<T>> built(new HashIndex<T, Hash, Equal>(hash, equal));
+    built->rebuild(*this);
+    valueIndex = std::move(built);
+}
+
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::detachIndex()
+{
+    valueIndex.reset();
+}
+
+template <class T, class Allocator>
+bool ListSequence<T, Allocator>::hasIndex() const
+{
+    return valueIndex != nullptr;
+}
+
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::rebuildIndex()
+{
+    reindex();
+}
+
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::indexAdded(const SequenceIndex start, const SequenceIndex count)
+{
+    if (!valueIndex || count == 0)
+    {
+        return;
+    }
+    if (start + count != list.getLength())
+    {
+        reindex();
+        return;
+    }
+
+    SequenceIndex position = 0;
+    for (typename LinkedList<T, Allocator>::ConstIterator it = begin(); it != end(); ++it, position++)
+    {
+        if (position >= start)
+        {
+            valueIndex->add(*it, position);
+        }
+    }
+}
+
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::reindex()
+{
+    if (valueIndex)
+    {
+        valueIndex->rebuild(*this);
+    }
+}
+
+template <class T, class Allocator>
+Sequence<T> *ListSequence<T, Allocator>::getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const
+{
+    LinkedList<T, Allocator> *subLinkedList = list.getSubList(startIndex, endIndex);
+    ListSequence<T, Allocator> *subList = new ListSequence<T, Allocator>(std::move(*subLinkedList));
     delete subLinkedList;
     return subList;
 }
 
-template <class T>
-void ListSequence<T>::append(const T &item)
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::append(const T &item)
 {
+    hashCache.clear();
     list.append(item);
+    if (valueIndex)
+    {
+        valueIndex->add(item, list.getLength() - 1);
+    }
 }
 
-template <class T>
-void ListSequence<T>::prepend(const T &item)
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::prepend(const T &item)
 {
+    hashCache.clear();
     list.prepend(item);
+    if (valueIndex)
+    {
+        valueIndex->shift(0, 1);
+        valueIndex->add(list.getFirst(), 0);
+    }
 }
 
-template <class T>
-void ListSequence<T>::insertAt(const T &item, const int index)
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::insertAt(const T &item, const SequenceIndex index)
 {
+    hashCache.clear();
     if (index < 0 || index > getLength())
     {
-        throw std::out_of_range("Invalid index for insertion");
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
     }
 
     list.insertAt(item, index);
+    if (valueIndex)
+    {
+        if (index < list.getLength() - 1)
+        {
+            valueIndex->shift(index, 1);
+        }
+        valueIndex->add(list.get(index), index);
+    }
+}
+
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::concat(const Sequence<T> *other)
+{
+    insertRange(getLength(), other);
+}
+
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    hashCache.clear();
+    if (index < 0 || index > getLength())
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    list.insertRange(index, items, count);
+    indexAdded(index, count);
 }
 
-template <class T>
-void ListSequence<T>::concat(const Sequence<T> *other)
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::insertRange(const SequenceIndex index, const Sequence<T> *other)
 {
-    for (int i = 0; i < other->getLength(); i++)
+    hashCache.clear();
+    if (index < 0 || index > getLength())
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    if (!other)
     {
-        list.append(other->get(i));
+        return;
     }
+
+    LinkedList<T, Allocator> chain(list.getAllocator());
+    ChainPrepender<T, Allocator> prepender(chain);
+    other->visitChunks(prepender);
+    chain.reverse();
+    SequenceIndex count = chain.getLength();
+    list.splice(index, chain);
+    indexAdded(index, count);
 }
 
-template <class T>
-void ListSequence<T>::set(const int index, const T &data)
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::set(const SequenceIndex index, const T &data)
 {
+    hashCache.clear();
     if (index < 0 || index >= getLength())
     {
-        throw std::out_of_range("Index out of range");
+        sequenceThrow<std::out_of_range>("Index out of range");
     }
-    this->get(index) = data;
+    T &slot = list.get(index);
+    if (!valueIndex)
+    {
+        slot = data;
+        return;
+    }
+
+    T previous = slot;
+    slot = data;
+    valueIndex->remove(previous, index, *this);
+    valueIndex->add(slot, index);
 }
 
-template <class T>
-Sequence<T> *ListSequence<T>::setImmutable(const int index, const T &data) const
+template <class T, class Allocator>
+Sequence<T> *ListSequence<T, Allocator>::setImmutable(const SequenceIndex index, const T &data) const
 {
-    ListSequence<T> *newSequence = new ListSequence<T>(*this);
+    ListSequence<T, Allocator> *newSequence = new ListSequence<T, Allocator>(*this);
     newSequence->set(index, data);
     return newSequence;
 }
 
-template <class T>
-Sequence<T> *ListSequence<T>::appendImmutable(const T &item) const
+template <class T, class Allocator>
+Sequence<T> *ListSequence<T, Allocator>::appendImmutable(const T &item) const
 {
-    ListSequence<T> *newSequence = new ListSequence<T>(*this);
+    ListSequence<T, Allocator> *newSequence = new ListSequence<T, Allocator>(*this);
     newSequence->append(item);
     return newSequence;
 }
 
-template <class T>
-Sequence<T> *ListSequence<T>::prependImmutable(const T &item) const
+template <class T, class Allocator>
+Sequence<T> *ListSequence<T, Allocator>::prependImmutable(const T &item) const
 {
-    ListSequence<T> *newSequence = new ListSequence<T>(*this);
+    ListSequence<T, Allocator> *newSequence = new ListSequence<T, Allocator>(*this);
     newSequence->prepend(item);
     return newSequence;
 }
 
-template <class T>
-Sequence<T> *ListSequence<T>::insertAtImmutable(const T &item, const int index) const
+template <class T, class Allocator>
+Sequence<T> *ListSequence<T, Allocator>::insertAtImmutable(const T &item, const SequenceIndex index) const
 {
-    ListSequence<T> *newSequence = new ListSequence<T>(*this);
+    ListSequence<T, Allocator> *newSequence = new ListSequence<T, Allocator>(*this);
     newSequence->insertAt(item, index);
     return newSequence;
 }
 
-template <class T>
-Sequence<T> *ListSequence<T>::concatImmutable(const Sequence<T> *list) const
+template <class T, class Allocator>
+Sequence<T> *ListSequence<T, Allocator>::concatImmutable(const Sequence<T> *list) const
 {
-    ListSequence<T> *newSequence = new ListSequence<T>(*this);
-    for (int i = 0; i < list->getLength(); i++)
-    {
-        newSequence->append(list->get(i));
-    }
+    ListSequence<T, Allocator> *newSequence = new ListSequence<T, Allocator>(*this);
+    newSequence->concat(list);
     return newSequence;
 }
 
-template <class T>
-void ListSequence<T>::print() const
+template <class T, class Allocator>
+Sequence<T> *ListSequence<T, Allocator>::clone() const
+{
+    return new ListSequence<T, Allocator>(*this);
+}
+
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::writeTo(std::ostream &out, const SequenceFormat &format) const
+{
+    list.writeTo(out, format);
+}
+
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::print() const
 {
     list.print();
 }
 
-template <class T>
-void ListSequence<T>::clear()
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::reverse()
+{
+    hashCache.clear();
+    list.reverse();
+    reindex();
+}
+
+template <class T, class Allocator>
+template <class Compare>
+void ListSequence<T, Allocator>::sort(Compare compare)
+{
+    hashCache.clear();
+    list.sort(compare);
+    reindex();
+}
+
+template <class T, class Allocator>
+template <class Compare>
+void ListSequence<T, Allocator>::merge(ListSequence<T, Allocator> &other, Compare compare)
 {
+    hashCache.clear();
+    other.hashCache.clear();
+    list.merge(other.list, compare);
+    reindex();
+    other.reindex();
+}
+
+template <class T, class Allocator>
+void ListSequence<T, Allocator>::clear()
+{
+    hashCache.clear();
     list.clear();
+    reindex();
 }
 
-template <class T>
-ListSequence<T> &ListSequence<T>::operator=(const ListSequence<T> &other)
+template <class T, class Allocator>
+ListSequence<T, Allocator> &ListSequence<T, Allocator>::operator=(const ListSequence<T, Allocator> &other)
 {
     if (this != &other)
     {
+        std::unique_ptr<ValueIndex<T>> copied(other.valueIndex ? other.valueIndex->clone() : nullptr);
         list = other.list;
+        valueIndex = std::move(copied);
+        hashCache = other.hashCache;
     }
     return *this;
 }
+
+template <class T, class Allocator>
+ListSequence<T, Allocator> &ListSequence<T, Allocator>::operator=(ListSequence<T, Allocator> &&other)
+{
+    list = std::move(other.list);
+    valueIndex = std::move(other.valueIndex);
+    hashCache = other.hashCache;
+    other.hashCache.clear();
+    return *this;
+}
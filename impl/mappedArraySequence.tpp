@@ -0,0 +1,275 @@
+#include <iostream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../inc/mappedArraySequence.hpp"
+#include "../inc/sequenceError.hpp"
+
+template <class T>
+MappedArraySequence<T>::MappedArraySequence(const std::string &path) : mapping(nullptr), mappingSize(0), data(nullptr), size(0)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Binary format requires trivially copyable elements");
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        sequenceThrow<std::runtime_error>("Cannot open file for reading: " + path);
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(BinarySequenceHeader))
+    {
+        ::close(fd);
+        sequenceThrow<std::runtime_error>("Truncated sequence file: " + path);
+    }
+
+    mappingSize = static_cast<std::size_t>(info.st_size);
+    mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        sequenceThrow<std::runtime_error>("Cannot map file: " + path);
+    }
+
+    SEQUENCE_TRY
+    {
+        BinarySequenceHeader header;
+        if (readBinaryHeader(*static_cast<const BinarySequenceHeader *>(mapping), header))
+        {
+            sequenceThrow<std::runtime_error>("Cannot map file with foreign byte order: " + path);
+        }
+        checkBinaryHeader<T>(header);
+        if (header.count > (mappingSize - sizeof(BinarySequenceHeader)) / sizeof(T))
+        {
+            sequenceThrow<std::runtime_error>("Truncated sequence file: " + path);
+        }
+        data = reinterpret_cast<T *>(static_cast<char *>(mapping) + sizeof(BinarySequenceHeader));
+        size = static_cast<SequenceIndex>(header.count);
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        ::munmap(mapping, mappingSize);
+        SEQUENCE_RETHROW;
+    }
+}
+
+template <class T>
+MappedArraySequence<T>::~MappedArraySequence()
+{
+    ::munmap(mapping, mappingSize);
+}
+
+template <class T>
+ArraySequence<T> *MappedArraySequence<T>::copy() const
+{
+    return new ArraySequence<T>(data, size);
+}
+
+template <class T>
+T &MappedArraySequence<T>::getFirst()
+{
+    if (size == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return data[0];
+}
+
+template <class T>
+const T &MappedArraySequence<T>::getFirst() const
+{
+    if (size == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return data[0];
+}
+
+template <class T>
+T &MappedArraySequence<T>::getLast()
+{
+    if (size == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return data[size - 1];
+}
+
+template <class T>
+const T &MappedArraySequence<T>::getLast() const
+{
+    if (size == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return data[size - 1];
+}
+
+template <class T>
+T &MappedArraySequence<T>::get(const SequenceIndex index)
+{
+    if (index < 0 || index >= size)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    return data[index];
+}
+
+template <class T>
+const T &MappedArraySequence<T>::get(const SequenceIndex index) const
+{
+    if (index < 0 || index >= size)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    return data[index];
+}
+
+template <class T>
+SequenceIndex MappedArraySequence<T>::getLength() const
+{
+    return size;
+}
+
+template <class T>
+void MappedArraySequence<T>::visitChunks(ChunkVisitor<T> &visitor) const
+{
+    if (size > 0)
+    {
+        visitor.visit(data, size, 0);
+    }
+}
+
+template <class T>
+const T *MappedArraySequence<T>::getData() const
+{
+    return data;
+}
+
+template <class T>
+const T *MappedArraySequence<T>::getContiguousData() const
+{
+    return data;
+}
+
+template <class T>
+void MappedArraySequence<T>::append(const T & /*item*/)
+{
+    sequenceThrow<std::logic_error>("Mapped sequence has a fixed length");
+}
+
+template <class T>
+void MappedArraySequence<T>::prepend(const T & /*item*/)
+{
+    sequenceThrow<std::logic_error>("Mapped sequence has a fixed length");
+}
+
+template <class T>
+void MappedArraySequence<T>::insertAt(const T & /*item*/, const SequenceIndex /*index*/)
+{
+    sequenceThrow<std::logic_error>("Mapped sequence has a fixed length");
+}
+
+template <class T>
+void MappedArraySequence<T>::set(const SequenceIndex index, const T &data)
+{
+    get(index) = data;
+}
+
+template <class T>
+void MappedArraySequence<T>::concat(const Sequence<T> * /*other*/)
+{
+    sequenceThrow<std::logic_error>("Mapped sequence has a fixed length");
+}
+
+template <class T>
+Sequence<T> *MappedArraySequence<T>::getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const
+{
+    if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
+    {
+        sequenceThrow<std::out_of_range>("Invalid subsequence range");
+    }
+    return new ArraySequence<T>(data + startIndex, endIndex - startIndex + 1);
+}
+
+template <class T>
+Sequence<T> *MappedArraySequence<T>::appendImmutable(const T &item) const
+{
+    ArraySequence<T> *newSequence = copy();
+    newSequence->append(item);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *MappedArraySequence<T>::prependImmutable(const T &item) const
+{
+    ArraySequence<T> *newSequence = copy();
+    newSequence->prepend(item);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *MappedArraySequence<T>::insertAtImmutable(const T &item, const SequenceIndex index) const
+{
+    ArraySequence<T> *newSequence = copy();
+    SEQUENCE_TRY
+    {
+        newSequence->insertAt(item, index);
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        delete newSequence;
+        SEQUENCE_RETHROW;
+    }
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *MappedArraySequence<T>::setImmutable(const SequenceIndex index, const T &data) const
+{
+    ArraySequence<T> *newSequence = copy();
+    SEQUENCE_TRY
+    {
+        newSequence->set(index, data);
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        delete newSequence;
+        SEQUENCE_RETHROW;
+    }
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *MappedArraySequence<T>::concatImmutable(const Sequence<T> *other) const
+{
+    ArraySequence<T> *newSequence = copy();
+    newSequence->concat(other);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *MappedArraySequence<T>::clone() const
+{
+    return copy();
+}
+
+template <class T>
+void MappedArraySequence<T>::writeTo(std::ostream &out, const SequenceFormat &format) const
+{
+    writeItems(out, data, size, format);
+}
+
+template <class T>
+void MappedArraySequence<T>::print() const
+{
+    writeTo(std::cout);
+}
+
+template <class T>
+const T &MappedArraySequence<T>::operator[](const SequenceIndex index) const
+{
+    return get(index);
+}
@@ -0,0 +1,589 @@
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include "../inc/packedIntSequence.hpp"
+#include "../inc/sequenceError.hpp"
+
+template <class T>
+template <std::size_t Width>
+void PackedIntSequence<T>::unpack(const std::uint64_t *packed, std::uint64_t *output)
+{
+    const std::uint64_t mask = Width == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (Width % 64)) - 1;
+    for (int i = 0; i < BLOCK_SIZE; i++)
+    {
+        if (Width == 0)
+        {
+            output[i] = 0;
+            continue;
+        }
+        std::size_t bit = static_cast<std::size_t>(i) * Width;
+        std::size_t word = bit >> 6;
+        std::size_t shift = bit & 63;
+        std::uint64_t value = packed[word] >> shift;
+        if (shift + Width > 64)
+        {
+            value |= packed[word + 1] << (64 - shift);
+        }
+        output[i] = value & mask;
+    }
+}
+
+template <class T>
+template <std::size_t... Width>
+const typename PackedIntSequence<T>::Unpacker *PackedIntSequence<T>::unpackers(std::index_sequence<Width...>)
+{
+    static const Unpacker table[] = {&PackedIntSequence<T>::unpack<Width>...};
+    return table;
+}
+
+template <class T>
+int PackedIntSequence<T>::bitWidth(const std::uint64_t value)
+{
+    return value == 0 ? 0 : 64 - __builtin_clzll(value);
+}
+
+template <class T>
+typename PackedIntSequence<T>::Block PackedIntSequence<T>::encodeBlock(const T *values, std::uint64_t *packed)
+{
+    std::uint64_t deltas[BLOCK_SIZE];
+    Block block;
+    block.first = static_cast<std::uint64_t>(static_cast<std::int64_t>(values[0]));
+
+    std::uint64_t previous = block.first;
+    std::int64_t minDelta = 0;
+    for (int i = 1; i < BLOCK_SIZE; i++)
+    {
+        std::uint64_t current = static_cast<std::uint64_t>(static_cast<std::int64_t>(values[i]));
+        deltas[i] = current - previous;
+        previous = current;
+        std::int64_t delta = static_cast<std::int64_t>(deltas[i]);
+        if (i == 1 || delta < minDelta)
+        {
+            minDelta = delta;
+        }
+    }
+    block.minDelta = static_cast<std::uint64_t>(minDelta);
+
+    std::uint64_t largest = 0;
+    deltas[0] = 0;
+    for (int i = 1; i < BLOCK_SIZE; i++)
+    {
+        deltas[i] -= block.minDelta;
+        largest |= deltas[i];
+    }
+    block.width = bitWidth(largest);
+
+    const int wordCount = 2 * block.width;
+    std::fill(packed, packed + wordCount, 0);
+    for (int i = 1; i < BLOCK_SIZE && block.width > 0; i++)
+    {
+        std::size_t bit = static_cast<std::size_t>(i) * block.width;
+        std::size_t word = bit >> 6;
+        std::size_t shift = bit & 63;
+        packed[word] |= deltas[i] << shift;
+        if (shift + block.width > 64)
+        {
+            packed[word + 1] |= deltas[i] >> (64 - shift);
+        }
+    }
+    return block;
+}
+
+template <class T>
+SequenceIndex PackedIntSequence<T>::getSealedLength() const
+{
+    return blocks.getSize() << BLOCK_SHIFT;
+}
+
+template <class T>
+void PackedIntSequence<T>::decodeBlock(const SequenceIndex block, T *output) const
+{
+    if (writeCache.dirty && writeCache.block == block)
+    {
+        std::copy(writeCache.values, writeCache.values + BLOCK_SIZE, output);
+        return;
+    }
+
+    static const Unpacker *table = unpackers(std::make_index_sequence<65>());
+    const Block &header = blocks[block];
+    std::uint64_t deltas[BLOCK_SIZE];
+    table[header.width](words.getData() + header.offset, deltas);
+
+    std::uint64_t value = header.first;
+    output[0] = static_cast<T>(value);
+    for (int i = 1; i < BLOCK_SIZE; i++)
+    {
+        value += deltas[i] + header.minDelta;
+        output[i] = static_cast<T>(value);
+    }
+}
+
+template <class T>
+const T *PackedIntSequence<T>::decodedBlock(const SequenceIndex block) const
+{
+    T *values = decoded[block].load(std::memory_order_acquire);
+    if (values)
+    {
+        return values;
+    }
+
+    std::unique_ptr<T[]> fresh(new T[BLOCK_SIZE]);
+    decodeBlock(block, fresh.get());
+    if (decoded[block].compare_exchange_strong(values, fresh.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+        return fresh.release();
+    }
+    return values;
+}
+
+template <class T>
+void PackedIntSequence<T>::dropDecoded(const SequenceIndex block)
+{
+    if (block < decodedSlots)
+    {
+        delete[] decoded[block].exchange(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+void PackedIntSequence<T>::dropAllDecoded()
+{
+    for (SequenceIndex block = 0; block < decodedSlots; block++)
+    {
+        dropDecoded(block);
+    }
+}
+
+template <class T>
+void PackedIntSequence<T>::growDecoded()
+{
+    if (blocks.getSize() <= decodedSlots)
+    {
+        return;
+    }
+    SequenceIndex slots = std::max(blocks.getSize(), decodedSlots > 0 ? 2 * decodedSlots : 16);
+    std::unique_ptr<std::atomic<T *>[]> grown(new std::atomic<T *>[slots]);
+    for (SequenceIndex i = 0; i < slots; i++)
+    {
+        grown[i].store(i < decodedSlots ? decoded[i].load(std::memory_order_relaxed) : nullptr, std::memory_order_relaxed);
+    }
+    decoded = std::move(grown);
+    decodedSlots = slots;
+}
+
+template <class T>
+void PackedIntSequence<T>::storeBlock(const SequenceIndex block, const T *values)
+{
+    std::uint64_t packed[2 * 64];
+    Block header = encodeBlock(values, packed);
+    header.offset = blocks[block].offset;
+
+    SequenceIndex oldCount = 2 * blocks[block].width;
+    SequenceIndex newCount = 2 * header.width;
+    if (newCount != oldCount)
+    {
+        SequenceIndex total = words.getSize();
+        SequenceIndex moved = header.offset + oldCount;
+        if (newCount > oldCount)
+        {
+            words.resize(total + newCount - oldCount);
+            std::copy_backward(words.getData() + moved, words.getData() + total, words.getData() + words.getSize());
+        }
+        else
+        {
+            std::copy(words.getData() + moved, words.getData() + total, words.getData() + header.offset + newCount);
+            words.resize(total + newCount - oldCount);
+        }
+        for (SequenceIndex i = block + 1; i < blocks.getSize(); i++)
+        {
+            blocks[i].offset += newCount - oldCount;
+        }
+    }
+
+    std::copy(packed, packed + newCount, words.getData() + header.offset);
+    blocks[block] = header;
+    dropDecoded(block);
+}
+
+template <class T>
+void PackedIntSequence<T>::seal()
+{
+    std::uint64_t packed[2 * 64];
+    Block header = encodeBlock(tail.getData(), packed);
+    header.offset = words.getSize();
+    words.appendRange(packed, 2 * header.width);
+    blocks.append(header);
+    tail.clear();
+    growDecoded();
+}
+
+template <class T>
+void PackedIntSequence<T>::flush()
+{
+    if (writeCache.dirty)
+    {
+        writeCache.dirty = false;
+        storeBlock(writeCache.block, writeCache.values);
+    }
+    writeCache.block = -1;
+}
+
+template <class T>
+void PackedIntSequence<T>::assign(const T *items, const SequenceIndex count)
+{
+    DynamicArray<T> values;
+    if (count > 0)
+    {
+        values.appendRange(items, count);
+    }
+    words.clear();
+    blocks.clear();
+    tail.clear();
+    dropAllDecoded();
+    writeCache.block = -1;
+    writeCache.dirty = false;
+
+    SequenceIndex sealed = count - count % BLOCK_SIZE;
+    for (SequenceIndex start = 0; start < sealed; start += BLOCK_SIZE)
+    {
+        tail.appendRange(values.getData() + start, BLOCK_SIZE);
+        seal();
+    }
+    tail.appendRange(values.getData() + sealed, count - sealed);
+}
+
+template <class T>
+void PackedIntSequence<T>::checkIndex(const SequenceIndex index) const
+{
+    if (index < 0 || index >= getLength())
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+}
+
+template <class T>
+PackedIntSequence<T>::PackedIntSequence() : words(), blocks(), tail(), writeCache(), decoded(), decodedSlots(0) {}
+
+template <class T>
+PackedIntSequence<T>::PackedIntSequence(const T *items, const SequenceIndex count) : PackedIntSequence()
+{
+    if (items == nullptr && count > 0)
+    {
+        sequenceThrow<std::invalid_argument>("Null array with non-zero count");
+    }
+    if (count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Negative count");
+    }
+    assign(items, count);
+}
+
+template <class T>
+PackedIntSequence<T>::PackedIntSequence(const SequenceIndex count) : PackedIntSequence()
+{
+    if (count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Negative count");
+    }
+    DynamicArray<T> zeros(count);
+    std::fill(zeros.getData(), zeros.getData() + count, T());
+    assign(zeros.getData(), count);
+}
+
+template <class T>
+PackedIntSequence<T>::PackedIntSequence(const PackedIntSequence<T> &other)
+    : words(other.words), blocks(other.blocks), tail(other.tail), writeCache(other.writeCache), decoded(), decodedSlots(0)
+{
+    growDecoded();
+}
+
+template <class T>
+PackedIntSequence<T>::~PackedIntSequence()
+{
+    dropAllDecoded();
+}
+
+template <class T>
+T &PackedIntSequence<T>::getFirst()
+{
+    if (getLength() == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return get(0);
+}
+
+template <class T>
+const T &PackedIntSequence<T>::getFirst() const
+{
+    if (getLength() == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return get(0);
+}
+
+template <class T>
+T &PackedIntSequence<T>::getLast()
+{
+    if (getLength() == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return get(getLength() - 1);
+}
+
+template <class T>
+const T &PackedIntSequence<T>::getLast() const
+{
+    if (getLength() == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return get(getLength() - 1);
+}
+
+template <class T>
+T &PackedIntSequence<T>::get(const SequenceIndex index)
+{
+    checkIndex(index);
+    SequenceIndex sealed = getSealedLength();
+    if (index >= sealed)
+    {
+        return tail[index - sealed];
+    }
+
+    SequenceIndex block = index >> BLOCK_SHIFT;
+    if (writeCache.block != block)
+    {
+        flush();
+        decodeBlock(block, writeCache.values);
+        writeCache.block = block;
+    }
+    writeCache.dirty = true;
+    return writeCache.values[index & (BLOCK_SIZE - 1)];
+}
+
+template <class T>
+const T &PackedIntSequence<T>::get(const SequenceIndex index) const
+{
+    checkIndex(index);
+    SequenceIndex sealed = getSealedLength();
+    if (index >= sealed)
+    {
+        return tail[index - sealed];
+    }
+
+    SequenceIndex block = index >> BLOCK_SHIFT;
+    if (writeCache.dirty && writeCache.block == block)
+    {
+        return writeCache.values[index & (BLOCK_SIZE - 1)];
+    }
+    return decodedBlock(block)[index & (BLOCK_SIZE - 1)];
+}
+
+template <class T>
+SequenceIndex PackedIntSequence<T>::getLength() const
+{
+    return getSealedLength() + tail.getSize();
+}
+
+template <class T>
+void PackedIntSequence<T>::visitChunks(ChunkVisitor<T> &visitor) const
+{
+    T values[BLOCK_SIZE];
+    for (SequenceIndex block = 0; block < blocks.getSize(); block++)
+    {
+        decodeBlock(block, values);
+        if (!visitor.visit(values, BLOCK_SIZE, block << BLOCK_SHIFT))
+        {
+            return;
+        }
+    }
+    if (tail.getSize() > 0)
+    {
+        visitor.visit(tail.getData(), tail.getSize(), getSealedLength());
+    }
+}
+
+template <class T>
+void PackedIntSequence<T>::decodeTo(T *output) const
+{
+    for (SequenceIndex block = 0; block < blocks.getSize(); block++)
+    {
+        decodeBlock(block, output + (block << BLOCK_SHIFT));
+    }
+    std::copy(tail.getData(), tail.getData() + tail.getSize(), output + getSealedLength());
+}
+
+template <class T>
+void PackedIntSequence<T>::append(const T &item)
+{
+    tail.append(item);
+    if (tail.getSize() == BLOCK_SIZE)
+    {
+        seal();
+    }
+}
+
+template <class T>
+void PackedIntSequence<T>::prepend(const T &item)
+{
+    insertRange(0, &item, 1);
+}
+
+template <class T>
+void PackedIntSequence<T>::insertAt(const T &item, const SequenceIndex index)
+{
+    insertRange(index, &item, 1);
+}
+
+template <class T>
+void PackedIntSequence<T>::set(const SequenceIndex index, const T &data)
+{
+    checkIndex(index);
+    T value = data;
+    get(index) = value;
+}
+
+template <class T>
+void PackedIntSequence<T>::concat(const Sequence<T> *other)
+{
+    if (!other)
+    {
+        return;
+    }
+    Sequence<T>::insertRange(getLength(), other);
+}
+
+template <class T>
+void PackedIntSequence<T>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    SequenceIndex length = getLength();
+    if (index < 0 || index > length)
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+
+    if (count == 0)
+    {
+        return;
+    }
+    if (index == length)
+    {
+        DynamicArray<T> copied(items, count);
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            append(copied[i]);
+        }
+        return;
+    }
+
+    flush();
+    DynamicArray<T> values(length);
+    decodeTo(values.getData());
+    values.insertRange(index, items, count);
+    assign(values.getData(), values.getSize());
+}
+
+template <class T>
+Sequence<T> *PackedIntSequence<T>::getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const
+{
+    if (startIndex < 0 || endIndex >= getLength() || startIndex > endIndex)
+    {
+        sequenceThrow<std::out_of_range>("Invalid subsequence range");
+    }
+
+    DynamicArray<T> values(getLength());
+    decodeTo(values.getData());
+    return new PackedIntSequence<T>(values.getData() + startIndex, endIndex - startIndex + 1);
+}
+
+template <class T>
+Sequence<T> *PackedIntSequence<T>::appendImmutable(const T &item) const
+{
+    PackedIntSequence<T> *newSequence = new PackedIntSequence<T>(*this);
+    newSequence->append(item);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *PackedIntSequence<T>::prependImmutable(const T &item) const
+{
+    PackedIntSequence<T> *newSequence = new PackedIntSequence<T>(*this);
+    newSequence->prepend(item);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *PackedIntSequence<T>::insertAtImmutable(const T &item, const SequenceIndex index) const
+{
+    PackedIntSequence<T> *newSequence = new PackedIntSequence<T>(*this);
+    newSequence->insertAt(item, index);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *PackedIntSequence<T>::setImmutable(const SequenceIndex index, const T &data) const
+{
+    PackedIntSequence<T> *newSequence = new PackedIntSequence<T>(*this);
+    newSequence->set(index, data);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *PackedIntSequence<T>::concatImmutable(const Sequence<T> *other) const
+{
+    PackedIntSequence<T> *newSequence = new PackedIntSequence<T>(*this);
+    newSequence->concat(other);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *PackedIntSequence<T>::clone() const
+{
+    return new PackedIntSequence<T>(*this);
+}
+
+template <class T>
+void PackedIntSequence<T>::print() const
+{
+    this->writeTo(std::cout);
+}
+
+template <class T>
+std::size_t PackedIntSequence<T>::getPackedBytes() const
+{
+    return words.getSize() * sizeof(std::uint64_t) + blocks.getSize() * sizeof(Block) + tail.getSize() * sizeof(T);
+}
+
+template <class T>
+SequenceIndex PackedIntSequence<T>::getBlockCount() const
+{
+    return blocks.getSize();
+}
+
+template <class T>
+void PackedIntSequence<T>::clear()
+{
+    assign(nullptr, 0);
+}
+
+template <class T>
+PackedIntSequence<T> &PackedIntSequence<T>::operator=(const PackedIntSequence<T> &other)
+{
+    if (this != &other)
+    {
+        words = other.words;
+        blocks = other.blocks;
+        tail = other.tail;
+        dropAllDecoded();
+        growDecoded();
+        writeCache = other.writeCache;
+    }
+    return *this;
+}
@@ -0,0 +1,575 @@
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include "../inc/poolListSequence.hpp"
+#include "../inc/sequenceError.hpp"
+
+//* ConstIterator {
+
+template <class T, bool XorLinked>
+PoolListSequence<T, XorLinked>::ConstIterator::ConstIterator(const PoolListSequence<T, XorLinked> *owner, const Slot previous, const Slot current)
+    : owner(owner), previous(previous), current(current) {}
+
+template <class T, bool XorLinked>
+typename PoolListSequence<T, XorLinked>::ConstIterator &PoolListSequence<T, XorLinked>::ConstIterator::operator++()
+{
+    if (current)
+    {
+        Slot next = owner->step(previous, current);
+        previous = current;
+        current = next;
+    }
+    return *this;
+}
+
+template <class T, bool XorLinked>
+typename PoolListSequence<T, XorLinked>::ConstIterator PoolListSequence<T, XorLinked>::ConstIterator::operator++(int)
+{
+    ConstIterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <class T, bool XorLinked>
+const T &PoolListSequence<T, XorLinked>::ConstIterator::operator*() const
+{
+    if (!current)
+    {
+        sequenceThrow<std::runtime_error>("Dereferencing invalid iterator");
+    }
+    return owner->node(current).value;
+}
+
+template <class T, bool XorLinked>
+bool PoolListSequence<T, XorLinked>::ConstIterator::operator==(const ConstIterator &other) const
+{
+    return current == other.current;
+}
+
+template <class T, bool XorLinked>
+bool PoolListSequence<T, XorLinked>::ConstIterator::operator!=(const ConstIterator &other) const
+{
+    return !(*this == other);
+}
+
+template <class T, bool XorLinked>
+bool PoolListSequence<T, XorLinked>::ConstIterator::notEnd() const
+{
+    return current != 0;
+}
+
+//* } end of ConstIterator section
+
+template <class T, bool XorLinked>
+typename PoolListSequence<T, XorLinked>::Node &PoolListSequence<T, XorLinked>::node(const Slot slot)
+{
+    return nodes.getData()[slot - 1];
+}
+
+template <class T, bool XorLinked>
+const typename PoolListSequence<T, XorLinked>::Node &PoolListSequence<T, XorLinked>::node(const Slot slot) const
+{
+    return nodes.getData()[slot - 1];
+}
+
+template <class T, bool XorLinked>
+typename PoolListSequence<T, XorLinked>::Slot PoolListSequence<T, XorLinked>::step(const Slot previous, const Slot current) const
+{
+    return XorLinked ? node(current).link ^ previous : node(current).link;
+}
+
+template <class T, bool XorLinked>
+typename PoolListSequence<T, XorLinked>::Slot PoolListSequence<T, XorLinked>::locate(const SequenceIndex index, Slot &before) const
+{
+    if (XorLinked && index >= length / 2)
+    {
+        Slot after = 0;
+        Slot current = tail;
+        for (SequenceIndex i = length - 1; i > index; i--)
+        {
+            Slot previous = node(current).link ^ after;
+            after = current;
+            current = previous;
+        }
+        SEQUENCE_STATS_ADD(PoolListSequence, traversalSteps, length - 1 - index);
+        before = node(current).link ^ after;
+        return current;
+    }
+
+    before = 0;
+    Slot current = head;
+    for (SequenceIndex i = 0; i < index; i++)
+    {
+        Slot next = step(before, current);
+        before = current;
+        current = next;
+    }
+    SEQUENCE_STATS_ADD(PoolListSequence, traversalSteps, index);
+    return current;
+}
+
+template <class T, bool XorLinked>
+typename PoolListSequence<T, XorLinked>::Slot PoolListSequence<T, XorLinked>::acquire(const T &item)
+{
+    if (freeList)
+    {
+        Slot slot = freeList;
+        node(slot).value = item;
+        freeList = node(slot).link;
+        node(slot).link = 0;
+        return slot;
+    }
+
+    if (nodes.getSize() >= static_cast<SequenceIndex>(std::numeric_limits<Slot>::max()))
+    {
+        sequenceThrow<std::length_error>("Pool is full");
+    }
+
+    Node fresh;
+    fresh.value = item;
+    nodes.append(fresh);
+    return static_cast<Slot>(nodes.getSize());
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::linkBetween(const Slot before, const Slot after, const Slot slot)
+{
+    if (XorLinked)
+    {
+        node(slot).link = before ^ after;
+        if (before)
+        {
+            node(before).link ^= after ^ slot;
+        }
+        if (after)
+        {
+            node(after).link ^= before ^ slot;
+        }
+    }
+    else
+    {
+        node(slot).link = after;
+        if (before)
+        {
+            node(before).link = slot;
+        }
+    }
+
+    if (!before)
+    {
+        head = slot;
+    }
+    if (!after)
+    {
+        tail = slot;
+    }
+    length++;
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::unlink(const Slot before, const Slot slot)
+{
+    Slot after = step(before, slot);
+    if (XorLinked)
+    {
+        if (before)
+        {
+            node(before).link ^= slot ^ after;
+        }
+        if (after)
+        {
+            node(after).link ^= slot ^ before;
+        }
+    }
+    else if (before)
+    {
+        node(before).link = after;
+    }
+
+    if (!before)
+    {
+        head = after;
+    }
+    if (!after)
+    {
+        tail = before;
+    }
+    length--;
+
+    node(slot).value = T();
+    node(slot).link = freeList;
+    freeList = slot;
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::checkIndex(const SequenceIndex index) const
+{
+    if (index < 0 || index >= length)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+}
+
+template <class T, bool XorLinked>
+PoolListSequence<T, XorLinked>::PoolListSequence() : nodes(), head(0), tail(0), freeList(0), length(0) {}
+
+template <class T, bool XorLinked>
+PoolListSequence<T, XorLinked>::PoolListSequence(const T *items, const SequenceIndex count)
+    : nodes(), head(0), tail(0), freeList(0), length(0)
+{
+    if (!items || count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+    insertRange(0, items, count);
+}
+
+template <class T, bool XorLinked>
+PoolListSequence<T, XorLinked>::PoolListSequence(const SequenceIndex count)
+    : nodes(), head(0), tail(0), freeList(0), length(0)
+{
+    if (count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Count cannot be negative");
+    }
+
+    T defaultValue = T();
+    for (SequenceIndex i = 0; i < count; i++)
+    {
+        append(defaultValue);
+    }
+}
+
+template <class T, bool XorLinked>
+PoolListSequence<T, XorLinked>::PoolListSequence(const PoolListSequence<T, XorLinked> &other)
+    : nodes(other.nodes), head(other.head), tail(other.tail), freeList(other.freeList), length(other.length) {}
+
+template <class T, bool XorLinked>
+PoolListSequence<T, XorLinked>::~PoolListSequence() {}
+
+template <class T, bool XorLinked>
+T &PoolListSequence<T, XorLinked>::getFirst()
+{
+    if (!head)
+    {
+        sequenceThrow<std::out_of_range>("List is empty");
+    }
+    return node(head).value;
+}
+
+template <class T, bool XorLinked>
+const T &PoolListSequence<T, XorLinked>::getFirst() const
+{
+    if (!head)
+    {
+        sequenceThrow<std::out_of_range>("List is empty");
+    }
+    return node(head).value;
+}
+
+template <class T, bool XorLinked>
+T &PoolListSequence<T, XorLinked>::getLast()
+{
+    if (!tail)
+    {
+        sequenceThrow<std::out_of_range>("List is empty");
+    }
+    return node(tail).value;
+}
+
+template <class T, bool XorLinked>
+const T &PoolListSequence<T, XorLinked>::getLast() const
+{
+    if (!tail)
+    {
+        sequenceThrow<std::out_of_range>("List is empty");
+    }
+    return node(tail).value;
+}
+
+template <class T, bool XorLinked>
+T &PoolListSequence<T, XorLinked>::get(const SequenceIndex index)
+{
+    checkIndex(index);
+    Slot before = 0;
+    return node(locate(index, before)).value;
+}
+
+template <class T, bool XorLinked>
+const T &PoolListSequence<T, XorLinked>::get(const SequenceIndex index) const
+{
+    checkIndex(index);
+    Slot before = 0;
+    return node(locate(index, before)).value;
+}
+
+template <class T, bool XorLinked>
+SequenceIndex PoolListSequence<T, XorLinked>::getLength() const
+{
+    return length;
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::visitChunks(ChunkVisitor<T> &visitor) const
+{
+    SequenceIndex position = 0;
+    for (ConstIterator it = begin(); it != end(); ++it)
+    {
+        if (!visitor.visit(&*it, 1, position++))
+        {
+            return;
+        }
+    }
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::append(const T &item)
+{
+    Slot before = tail;
+    linkBetween(before, 0, acquire(item));
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::prepend(const T &item)
+{
+    Slot after = head;
+    linkBetween(0, after, acquire(item));
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::insertAt(const T &item, const SequenceIndex index)
+{
+    if (index < 0 || index > length)
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    insertRange(index, &item, 1);
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    if (index < 0 || index > length)
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+    if (count == 0)
+    {
+        return;
+    }
+
+    const void *first = nodes.getData();
+    const void *last = nodes.getData() + nodes.getSize();
+    std::less<const void *> less;
+    if (!less(items, first) && less(items, last))
+    {
+        DynamicArray<T> copy(items, count);
+        insertRange(index, copy.getData(), count);
+        return;
+    }
+
+    Slot previous = tail;
+    Slot next = 0;
+    if (index < length)
+    {
+        next = locate(index, previous);
+    }
+
+    for (SequenceIndex i = 0; i < count; i++)
+    {
+        Slot slot = acquire(items[i]);
+        linkBetween(previous, next, slot);
+        previous = slot;
+    }
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::set(const SequenceIndex index, const T &data)
+{
+    get(index) = data;
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::concat(const Sequence<T> *other)
+{
+    if (!other)
+    {
+        return;
+    }
+
+    const PoolListSequence<T, XorLinked> *same = dynamic_cast<const PoolListSequence<T, XorLinked> *>(other);
+    if (same && same != this)
+    {
+        for (ConstIterator it = same->begin(); it != same->end(); ++it)
+        {
+            append(*it);
+        }
+        return;
+    }
+    if (same)
+    {
+        PoolListSequence<T, XorLinked> copy(*this);
+        concat(&copy);
+        return;
+    }
+    this->insertRange(length, other);
+}
+
+template <class T, bool XorLinked>
+Sequence<T> *PoolListSequence<T, XorLinked>::getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const
+{
+    if (startIndex < 0 || startIndex >= length ||
+        endIndex < 0 || endIndex >= length ||
+        startIndex > endIndex)
+    {
+        sequenceThrow<std::out_of_range>("Invalid index range");
+    }
+
+    PoolListSequence<T, XorLinked> *subsequence = new PoolListSequence<T, XorLinked>();
+    SEQUENCE_TRY
+    {
+        Slot previous = 0;
+        Slot current = locate(startIndex, previous);
+        for (SequenceIndex i = startIndex; i <= endIndex; i++)
+        {
+            subsequence->append(node(current).value);
+            Slot next = step(previous, current);
+            previous = current;
+            current = next;
+        }
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        delete subsequence;
+        SEQUENCE_RETHROW;
+    }
+    return subsequence;
+}
+
+template <class T, bool XorLinked>
+Sequence<T> *PoolListSequence<T, XorLinked>::appendImmutable(const T &item) const
+{
+    PoolListSequence<T, XorLinked> *newSequence = new PoolListSequence<T, XorLinked>(*this);
+    newSequence->append(item);
+    return newSequence;
+}
+
+template <class T, bool XorLinked>
+Sequence<T> *PoolListSequence<T, XorLinked>::prependImmutable(const T &item) const
+{
+    PoolListSequence<T, XorLinked> *newSequence = new PoolListSequence<T, XorLinked>(*this);
+    newSequence->prepend(item);
+    return newSequence;
+}
+
+template <class T, bool XorLinked>
+Sequence<T> *PoolListSequence<T, XorLinked>::insertAtImmutable(const T &item, const SequenceIndex index) const
+{
+    PoolListSequence<T, XorLinked> *newSequence = new PoolListSequence<T, XorLinked>(*this);
+    newSequence->insertAt(item, index);
+    return newSequence;
+}
+
+template <class T, bool XorLinked>
+Sequence<T> *PoolListSequence<T, XorLinked>::setImmutable(const SequenceIndex index, const T &data) const
+{
+    PoolListSequence<T, XorLinked> *newSequence = new PoolListSequence<T, XorLinked>(*this);
+    newSequence->set(index, data);
+    return newSequence;
+}
+
+template <class T, bool XorLinked>
+Sequence<T> *PoolListSequence<T, XorLinked>::concatImmutable(const Sequence<T> *other) const
+{
+    PoolListSequence<T, XorLinked> *newSequence = new PoolListSequence<T, XorLinked>(*this);
+    newSequence->concat(other);
+    return newSequence;
+}
+
+template <class T, bool XorLinked>
+Sequence<T> *PoolListSequence<T, XorLinked>::clone() const
+{
+    return new PoolListSequence<T, XorLinked>(*this);
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::writeTo(std::ostream &out, const SequenceFormat &format) const
+{
+    writeRange(out, begin(), end(), format);
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::print() const
+{
+    writeTo(std::cout, SequenceFormat::spaced());
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::removeAt(const SequenceIndex index)
+{
+    checkIndex(index);
+    Slot before = 0;
+    Slot slot = locate(index, before);
+    unlink(before, slot);
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::clear()
+{
+    nodes.clear();
+    head = 0;
+    tail = 0;
+    freeList = 0;
+    length = 0;
+}
+
+template <class T, bool XorLinked>
+void PoolListSequence<T, XorLinked>::compact()
+{
+    DynamicArray<Node> packed(length);
+    Node *target = packed.getData();
+
+    Slot previous = 0;
+    Slot current = head;
+    for (SequenceIndex i = 0; i < length; i++)
+    {
+        Slot before = static_cast<Slot>(i);
+        Slot after = i + 1 < length ? static_cast<Slot>(i + 2) : 0;
+        target[i].value = node(current).value;
+        target[i].link = XorLinked ? before ^ after : after;
+
+        Slot next = step(previous, current);
+        previous = current;
+        current = next;
+    }
+
+    nodes.swap(packed);
+    head = length > 0 ? 1 : 0;
+    tail = static_cast<Slot>(length);
+    freeList = 0;
+}
+
+template <class T, bool XorLinked>
+std::size_t PoolListSequence<T, XorLinked>::getPoolBytes() const
+{
+    return static_cast<std::size_t>(nodes.getCapacity()) * sizeof(Node);
+}
+
+template <class T, bool XorLinked>
+PoolListSequence<T, XorLinked> &PoolListSequence<T, XorLinked>::operator=(const PoolListSequence<T, XorLinked> &other)
+{
+    if (this != &other)
+    {
+        nodes = other.nodes;
+        head = other.head;
+        tail = other.tail;
+        freeList = other.freeList;
+        length = other.length;
+    }
+    return *this;
+}
@@ -0,0 +1,644 @@
+#include <iostream>
+#include <stdexcept>
+#include "../inc/ropeSequence.hpp"
+#include "../inc/sequenceError.hpp"
+
+template <class T>
+RopeSequence<T>::RopeSequence() : root() {}
+
+template <class T>
+RopeSequence<T>::RopeSequence(const NodePtr &root) : root(root) {}
+
+template <class T>
+RopeSequence<T>::RopeSequence(const T *items, const SequenceIndex count) : root()
+{
+    if (items == nullptr && count > 0)
+    {
+        sequenceThrow<std::invalid_argument>("Null array with non-zero count");
+    }
+    if (count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Negative count");
+    }
+    root = build(items, count);
+}
+
+template <class T>
+RopeSequence<T>::RopeSequence(const RopeSequence<T> &other) : root(other.root) {}
+
+template <class T>
+RopeSequence<T>::~RopeSequence() {}
+
+template <class T>
+int RopeSequence<T>::height(const NodePtr &node)
+{
+    return node ? node->height : 0;
+}
+
+template <class T>
+SequenceIndex RopeSequence<T>::length(const NodePtr &node)
+{
+    return node ? node->length : 0;
+}
+
+template <class T>
+typename RopeSequence<T>::NodePtr RopeSequence<T>::makeLeaf(const std::shared_ptr<DynamicArray<T>> &chunk, const SequenceIndex offset, const SequenceIndex length)
+{
+    NodePtr node = std::make_shared<Node>();
+    node->chunk = chunk;
+    node->offset = offset;
+    node->length = length;
+    node->height = 1;
+    return node;
+}
+
+template <class T>
+typename RopeSequence<T>::NodePtr RopeSequence<T>::makeLeaf(const T *items, const SequenceIndex count)
+{
+    return makeLeaf(std::make_shared<DynamicArray<T>>(items, count), 0, count);
+}
+
+template <class T>
+typename RopeSequence<T>::NodePtr RopeSequence<T>::makeNode(const NodePtr &left, const NodePtr &right)
+{
+    NodePtr node = std::make_shared<Node>();
+    node->offset = 0;
+    node->length = left->length + right->length;
+    node->height = 1 + (left->height > right->height ? left->height : right->height);
+    node->left = left;
+    node->right = right;
+    return node;
+}
+
+template <class T>
+typename RopeSequence<T>::NodePtr RopeSequence<T>::build(const T *items, const SequenceIndex count)
+{
+    if (count <= 0)
+    {
+        return NodePtr();
+    }
+    if (count <= LEAF_CAPACITY)
+    {
+        return makeLeaf(items, count);
+    }
+
+    SequenceIndex leaves = (count + LEAF_CAPACITY - 1) / LEAF_CAPACITY;
+    SequenceIndex leftCount = (leaves / 2) * LEAF_CAPACITY;
+    return makeNode(build(items, leftCount), build(items + leftCount, count - leftCount));
+}
+
+template <class T>
+typename RopeSequence<T>::NodePtr RopeSequence<T>::rotateLeft(const NodePtr &node)
+{
+    NodePtr right = node->right;
+    return makeNode(makeNode(node->left, right->left), right->right);
+}
+
+template <class T>
+typename RopeSequence<T>::NodePtr RopeSequence<T>::rotateRight(const NodePtr &node)
+{
+    NodePtr left = node->left;
+    return makeNode(left->left, makeNode(left->right, node->right));
+}
+
+template <class T>
+typename RopeSequence<T>::NodePtr RopeSequence<T>::joinRight(const NodePtr &left, const NodePtr &right)
+{
+    NodePtr outer = left->left;
+    NodePtr inner = left->right;
+
+    if (height(inner) <= height(right) + 1)
+    {
+        NodePtr joined = makeNode(inner, right);
+        if (height(joined) <= height(outer) + 1)
+        {
+            return makeNode(outer, joined);
+        }
+        return rotateLeft(makeNode(outer, rotateRight(joined)));
+    }
+
+    NodePtr joined = joinRight(inner, right);
+    NodePtr result = makeNode(outer, joined);
+    if (height(joined) <= height(outer) + 1)
+    {
+        return result;
+    }
+    return rotateLeft(result);
+}
+
+template <class T>
+typename RopeSequence<T>::NodePtr RopeSequence<T>::joinLeft(const NodePtr &left, const NodePtr &right)
+{
+    NodePtr inner = right->left;
+    NodePtr outer = right->right;
+
+    if (height(inner) <= height(left) + 1)
+    {
+        NodePtr joined = makeNode(left, inner);
+        if (height(joined) <= height(outer) + 1)
+        {
+            return makeNode(joined, outer);
+        }
+        return rotateRight(makeNode(rotateLeft(joined), outer));
+    }
+
+    NodePtr joined = joinLeft(left, inner);
+    NodePtr result = makeNode(joined, outer);
+    if (height(joined) <= height(outer) + 1)
+    {
+        return result;
+    }
+    return rotateRight(result);
+}
+
+template <class T>
+typename RopeSequence<T>::NodePtr RopeSequence<T>::join(const NodePtr &left, const NodePtr &right)
+{
+    if (!left)
+    {
+        return right;
+    }
+    if (!right)
+    {
+        return left;
+    }
+
+    if (left->height > right->height + 1)
+    {
+        return joinRight(left, right);
+    }
+    if (right->height > left->height + 1)
+    {
+        return joinLeft(left, right);
+    }
+    return makeNode(left, right);
+}
+
+template <class T>
+const typename RopeSequence<T>::Node *RopeSequence<T>::edgeLeaf(const Node *node, const bool atEnd)
+{
+    while (!node->chunk)
+    {
+        node = atEnd ? node->right.get() : node->left.get();
+    }
+    return node;
+}
+
+template <class T>
+typename RopeSequence<T>::NodePtr RopeSequence<T>::absorb(const NodePtr &node, const NodePtr &leaf, const bool atEnd)
+{
+    if (!node->chunk)
+    {
+        if (atEnd)
+        {
+            return makeNode(node->left, absorb(node->right, leaf, true));
+        }
+        return makeNode(absorb(node->left, leaf, false), node->right);
+    }
+
+    const Node *first = atEnd ? node.get() : leaf.get();
+    const Node *second = atEnd ? leaf.get() : node.get();
+    std::shared_ptr<DynamicArray<T>> chunk = std::make_shared<DynamicArray<T>>(first->length + second->length);
+
+    T *data = chunk->getData();
+    const T *firstData = first->chunk->getData() + first->offset;
+    const T *secondData = second->chunk->getData() + second->offset;
+    for (SequenceIndex i = 0; i < first->length; i++)
+    {
+        data[i] = firstData[i];
+    }
+    for (SequenceIndex i = 0; i < second->length; i++)
+    {
+        data[first->length + i] = secondData[i];
+    }
+    return makeLeaf(chunk, 0, chunk->getSize());
+}
+
+template <class T>
+void RopeSequence<T>::split(const NodePtr &node, const SequenceIndex index, NodePtr &left, NodePtr &right)
+{
+    if (!node || index <= 0)
+    {
+        left = NodePtr();
+        right = node;
+        return;
+    }
+    if (index >= node->length)
+    {
+        left = node;
+        right = NodePtr();
+        return;
+    }
+
+    if (node->chunk)
+    {
+        left = makeLeaf(node->chunk, node->offset, index);
+        right = makeLeaf(node->chunk, node->offset + index, node->length - index);
+        return;
+    }
+
+    SequenceIndex leftLength = node->left->length;
+    NodePtr first;
+    NodePtr second;
+    if (index < leftLength)
+    {
+        split(node->left, index, first, second);
+        left = first;
+        right = join(second, node->right);
+    }
+    else if (index == leftLength)
+    {
+        left = node->left;
+        right = node->right;
+    }
+    else
+    {
+        split(node->right, index - leftLength, first, second);
+        left = join(node->left, first);
+        right = second;
+    }
+}
+
+template <class T>
+template <class Visitor>
+bool RopeSequence<T>::forEachLeaf(const Node *node, Visitor &visitor)
+{
+    if (!node)
+    {
+        return true;
+    }
+    if (node->chunk)
+    {
+        return visitor(node->chunk->getData() + node->offset, node->length);
+    }
+    return forEachLeaf(node->left.get(), visitor) && forEachLeaf(node->right.get(), visitor);
+}
+
+template <class T>
+const T &RopeSequence<T>::at(SequenceIndex index) const
+{
+    const Node *node = root.get();
+    while (!node->chunk)
+    {
+        SequenceIndex leftLength = node->left->length;
+        if (index < leftLength)
+        {
+            node = node->left.get();
+        }
+        else
+        {
+            index -= leftLength;
+            node = node->right.get();
+        }
+    }
+    return node->chunk->getData()[node->offset + index];
+}
+
+template <class T>
+T &RopeSequence<T>::mutableAt(SequenceIndex index)
+{
+    NodePtr *slot = &root;
+    while (true)
+    {
+        if (slot->use_count() > 1)
+        {
+            *slot = std::make_shared<Node>(**slot);
+        }
+
+        Node *node = slot->get();
+        if (node->chunk)
+        {
+            if (node->chunk.use_count() > 1)
+            {
+                node->chunk = std::make_shared<DynamicArray<T>>(node->chunk->getData() + node->offset, node->length);
+                node->offset = 0;
+            }
+            return node->chunk->getData()[node->offset + index];
+        }
+
+        SequenceIndex leftLength = node->left->length;
+        if (index < leftLength)
+        {
+            slot = &node->left;
+        }
+        else
+        {
+            index -= leftLength;
+            slot = &node->right;
+        }
+    }
+}
+
+template <class T>
+T &RopeSequence<T>::getFirst()
+{
+    if (!root)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return mutableAt(0);
+}
+
+template <class T>
+const T &RopeSequence<T>::getFirst() const
+{
+    if (!root)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return at(0);
+}
+
+template <class T>
+T &RopeSequence<T>::getLast()
+{
+    if (!root)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return mutableAt(root->length - 1);
+}
+
+template <class T>
+const T &RopeSequence<T>::getLast() const
+{
+    if (!root)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return at(root->length - 1);
+}
+
+template <class T>
+T &RopeSequence<T>::get(const SequenceIndex index)
+{
+    if (index < 0 || index >= getLength())
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    return mutableAt(index);
+}
+
+template <class T>
+const T &RopeSequence<T>::get(const SequenceIndex index) const
+{
+    if (index < 0 || index >= getLength())
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    return at(index);
+}
+
+template <class T>
+SequenceIndex RopeSequence<T>::getLength() const
+{
+    return length(root);
+}
+
+template <class T>
+void RopeSequence<T>::visitChunks(ChunkVisitor<T> &visitor) const
+{
+    SequenceIndex offset = 0;
+    auto adapter = [&visitor, &offset](const T *items, const SequenceIndex count)
+    {
+        bool more = visitor.visit(items, count, offset);
+        offset += count;
+        return more;
+    };
+    forEachLeaf(root.get(), adapter);
+}
+
+template <class T>
+int RopeSequence<T>::getHeight() const
+{
+    return height(root);
+}
+
+template <class T>
+void RopeSequence<T>::append(const T &item)
+{
+    insertRange(getLength(), &item, 1);
+}
+
+template <class T>
+void RopeSequence<T>::prepend(const T &item)
+{
+    insertRange(0, &item, 1);
+}
+
+template <class T>
+void RopeSequence<T>::insertAt(const T &item, const SequenceIndex index)
+{
+    insertRange(index, &item, 1);
+}
+
+template <class T>
+void RopeSequence<T>::set(const SequenceIndex index, const T &data)
+{
+    get(index) = data;
+}
+
+template <class T>
+void RopeSequence<T>::concat(const Sequence<T> *other)
+{
+    if (!other)
+    {
+        return;
+    }
+    insertRange(getLength(), other);
+}
+
+template <class T>
+void RopeSequence<T>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    if (index < 0 || index > getLength())
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+
+    NodePtr middle = build(items, count);
+    NodePtr left;
+    NodePtr right;
+    split(root, index, left, right);
+
+    if (middle && !middle->left)
+    {
+        if (left && edgeLeaf(left.get(), true)->length + middle->length <= LEAF_CAPACITY)
+        {
+            root = join(absorb(left, middle, true), right);
+            return;
+        }
+        if (right && edgeLeaf(right.get(), false)->length + middle->length <= LEAF_CAPACITY)
+        {
+            root = join(left, absorb(right, middle, false));
+            return;
+        }
+    }
+    root = join(join(left, middle), right);
+}
+
+template <class T>
+void RopeSequence<T>::insertRange(const SequenceIndex index, const Sequence<T> *other)
+{
+    const RopeSequence<T> *rope = dynamic_cast<const RopeSequence<T> *>(other);
+    if (!rope)
+    {
+        Sequence<T>::insertRange(index, other);
+        return;
+    }
+    if (index < 0 || index > getLength())
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+
+    NodePtr middle = rope->root;
+    NodePtr left;
+    NodePtr right;
+    split(root, index, left, right);
+    root = join(join(left, middle), right);
+}
+
+template <class T>
+Sequence<T> *RopeSequence<T>::getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const
+{
+    if (startIndex < 0 || endIndex >= getLength() || startIndex > endIndex)
+    {
+        sequenceThrow<std::out_of_range>("Invalid subsequence range");
+    }
+
+    NodePtr prefix;
+    NodePtr rest;
+    split(root, endIndex + 1, prefix, rest);
+    NodePtr before;
+    NodePtr middle;
+    split(prefix, startIndex, before, middle);
+    return new RopeSequence<T>(middle);
+}
+
+template <class T>
+Sequence<T> *RopeSequence<T>::appendImmutable(const T &item) const
+{
+    RopeSequence<T> *newSequence = new RopeSequence<T>(*this);
+    newSequence->append(item);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *RopeSequence<T>::prependImmutable(const T &item) const
+{
+    RopeSequence<T> *newSequence = new RopeSequence<T>(*this);
+    newSequence->prepend(item);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *RopeSequence<T>::insertAtImmutable(const T &item, const SequenceIndex index) const
+{
+    RopeSequence<T> *newSequence = new RopeSequence<T>(*this);
+    newSequence->insertAt(item, index);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *RopeSequence<T>::setImmutable(const SequenceIndex index, const T &data) const
+{
+    RopeSequence<T> *newSequence = new RopeSequence<T>(*this);
+    newSequence->set(index, data);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *RopeSequence<T>::concatImmutable(const Sequence<T> *other) const
+{
+    RopeSequence<T> *newSequence = new RopeSequence<T>(*this);
+    newSequence->concat(other);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *RopeSequence<T>::clone() const
+{
+    return new RopeSequence<T>(*this);
+}
+
+template <class T>
+void RopeSequence<T>::writeTo(std::ostream &out, const SequenceFormat &format) const
+{
+    SequenceFormatter formatter(out);
+    if (!root)
+    {
+        formatter.write(format.empty);
+        return;
+    }
+
+    bool first = true;
+    auto visitor = [&formatter, &format, &first](const T *items, const SequenceIndex count)
+    {
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            if (!first)
+            {
+                formatter.write(format.separator);
+            }
+            first = false;
+            formatter.write(format.prefix);
+            formatter.writeValue(items[i]);
+            formatter.write(format.suffix);
+        }
+        return true;
+    };
+    forEachLeaf(root.get(), visitor);
+}
+
+template <class T>
+void RopeSequence<T>::print() const
+{
+    writeTo(std::cout);
+}
+
+template <class T>
+DynamicArray<T> *RopeSequence<T>::flatten() const
+{
+    DynamicArray<T> *result = new DynamicArray<T>(getLength());
+    T *data = result->getData();
+    SequenceIndex size = 0;
+    auto visitor = [data, &size](const T *items, const SequenceIndex count)
+    {
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            data[size++] = items[i];
+        }
+        return true;
+    };
+    forEachLeaf(root.get(), visitor);
+    return result;
+}
+
+template <class T>
+void RopeSequence<T>::clear()
+{
+    root = NodePtr();
+}
+
+template <class T>
+RopeSequence<T> &RopeSequence<T>::operator=(const RopeSequence<T> &other)
+{
+    root = other.root;
+    return *this;
+}
+
+template <class T>
+T &RopeSequence<T>::operator[](const SequenceIndex index)
+{
+    return get(index);
+}
+
+template <class T>
+const T &RopeSequence<T>::operator[](const SequenceIndex index) const
+{
+    return get(index);
+}
@@ -0,0 +1,426 @@
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include "../inc/segmentedArraySequence.hpp"
+#include "../inc/sequenceError.hpp"
+
+template <class T>
+int SegmentedArraySequence<T>::highestBit(std::uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int bit = 0;
+    while (value >>= 1)
+    {
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+template <class T>
+SequenceIndex SegmentedArraySequence<T>::blockSize(const int block)
+{
+    return static_cast<SequenceIndex>(BASE) << block;
+}
+
+template <class T>
+T &SegmentedArraySequence<T>::at(const SequenceIndex index)
+{
+    std::uint64_t position = static_cast<std::uint64_t>(index) + BASE;
+    int bit = highestBit(position);
+    return blocks[bit - BASE_SHIFT][position - (std::uint64_t(1) << bit)];
+}
+
+template <class T>
+const T &SegmentedArraySequence<T>::at(const SequenceIndex index) const
+{
+    std::uint64_t position = static_cast<std::uint64_t>(index) + BASE;
+    int bit = highestBit(position);
+    return blocks[bit - BASE_SHIFT][position - (std::uint64_t(1) << bit)];
+}
+
+template <class T>
+void SegmentedArraySequence<T>::grow()
+{
+    if (blockCount >= MAX_BLOCKS)
+    {
+        sequenceThrow<std::length_error>("Sequence is full");
+    }
+    blocks[blockCount] = new T[blockSize(blockCount)];
+    SEQUENCE_STATS_ALLOCATE(SegmentedArraySequence, sizeof(T) * blockSize(blockCount));
+    blockCount++;
+}
+
+template <class T>
+void SegmentedArraySequence<T>::copyFrom(const SegmentedArraySequence<T> &other)
+{
+    for (int block = 0; block < other.blockCount; block++)
+    {
+        grow();
+        SequenceIndex count = blockSize(block);
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            blocks[block][i] = other.blocks[block][i];
+        }
+        SEQUENCE_STATS_COPY(SegmentedArraySequence, count, sizeof(T) * count);
+    }
+    size = other.size;
+}
+
+template <class T>
+SegmentedArraySequence<T>::SegmentedArraySequence() : blockCount(0), size(0) {}
+
+template <class T>
+SegmentedArraySequence<T>::SegmentedArraySequence(const T *items, const SequenceIndex count) : blockCount(0), size(0)
+{
+    if (items == nullptr && count > 0)
+    {
+        sequenceThrow<std::invalid_argument>("Null array with non-zero count");
+    }
+    if (count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Negative count");
+    }
+    for (SequenceIndex i = 0; i < count; i++)
+    {
+        append(items[i]);
+    }
+}
+
+template <class T>
+SegmentedArraySequence<T>::SegmentedArraySequence(const SequenceIndex count) : blockCount(0), size(0)
+{
+    if (count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Negative count");
+    }
+    T defaultValue = T();
+    for (SequenceIndex i = 0; i < count; i++)
+    {
+        append(defaultValue);
+    }
+}
+
+template <class T>
+SegmentedArraySequence<T>::SegmentedArraySequence(const SegmentedArraySequence<T> &other) : blockCount(0), size(0)
+{
+    copyFrom(other);
+}
+
+template <class T>
+SegmentedArraySequence<T>::~SegmentedArraySequence()
+{
+    clear();
+}
+
+template <class T>
+T &SegmentedArraySequence<T>::getFirst()
+{
+    if (size == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return at(0);
+}
+
+template <class T>
+const T &SegmentedArraySequence<T>::getFirst() const
+{
+    if (size == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return at(0);
+}
+
+template <class T>
+T &SegmentedArraySequence<T>::getLast()
+{
+    if (size == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return at(size - 1);
+}
+
+template <class T>
+const T &SegmentedArraySequence<T>::getLast() const
+{
+    if (size == 0)
+    {
+        sequenceThrow<std::out_of_range>("Sequence is empty");
+    }
+    return at(size - 1);
+}
+
+template <class T>
+T &SegmentedArraySequence<T>::get(const SequenceIndex index)
+{
+    if (index < 0 || index >= size)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    return at(index);
+}
+
+template <class T>
+const T &SegmentedArraySequence<T>::get(const SequenceIndex index) const
+{
+    if (index < 0 || index >= size)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    return at(index);
+}
+
+template <class T>
+SequenceIndex SegmentedArraySequence<T>::getLength() const
+{
+    return size;
+}
+
+template <class T>
+void SegmentedArraySequence<T>::visitChunks(ChunkVisitor<T> &visitor) const
+{
+    SequenceIndex offset = 0;
+    for (int block = 0; block < blockCount && offset < size; block++)
+    {
+        SequenceIndex count = std::min(blockSize(block), size - offset);
+        if (!visitor.visit(blocks[block], count, offset))
+        {
+            return;
+        }
+        offset += count;
+    }
+}
+
+template <class T>
+SequenceIndex SegmentedArraySequence<T>::getCapacity() const
+{
+    return BASE * ((static_cast<SequenceIndex>(1) << blockCount) - 1);
+}
+
+template <class T>
+int SegmentedArraySequence<T>::getBlockCount() const
+{
+    return blockCount;
+}
+
+template <class T>
+void SegmentedArraySequence<T>::append(const T &item)
+{
+    if (size >= getCapacity())
+    {
+        grow();
+    }
+    at(size) = item;
+    size++;
+}
+
+template <class T>
+void SegmentedArraySequence<T>::prepend(const T &item)
+{
+    insertAt(item, 0);
+}
+
+template <class T>
+void SegmentedArraySequence<T>::insertAt(const T &item, const SequenceIndex index)
+{
+    if (index < 0 || index > size)
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+
+    if (size >= getCapacity())
+    {
+        grow();
+    }
+    size++;
+
+    for (SequenceIndex i = size - 1; i > index; i--)
+    {
+        at(i) = at(i - 1);
+    }
+    SEQUENCE_STATS_ADD(SegmentedArraySequence, elementMoves, size - 1 - index);
+    at(index) = item;
+}
+
+template <class T>
+void SegmentedArraySequence<T>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    if (index < 0 || index > size)
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+    if (count == 0)
+    {
+        return;
+    }
+
+    std::less<const T *> before;
+    for (int block = 0; block < blockCount; block++)
+    {
+        if (!before(items, blocks[block]) && before(items, blocks[block] + blockSize(block)))
+        {
+            T *copy = new T[count];
+            SEQUENCE_TRY
+            {
+                for (SequenceIndex i = 0; i < count; i++)
+                {
+                    copy[i] = items[i];
+                }
+                insertRange(index, copy, count);
+            }
+            SEQUENCE_CATCH_ALL
+            {
+                delete[] copy;
+                SEQUENCE_RETHROW;
+            }
+            delete[] copy;
+            return;
+        }
+    }
+
+    while (size + count > getCapacity())
+    {
+        grow();
+    }
+    size += count;
+
+    for (SequenceIndex i = size - 1; i >= index + count; i--)
+    {
+        at(i) = std::move(at(i - count));
+    }
+    for (SequenceIndex i = 0; i < count; i++)
+    {
+        at(index + i) = items[i];
+    }
+    SEQUENCE_STATS_ADD(SegmentedArraySequence, elementMoves, size - count - index);
+    SEQUENCE_STATS_COPY(SegmentedArraySequence, count, sizeof(T) * count);
+}
+
+template <class T>
+void SegmentedArraySequence<T>::set(const SequenceIndex index, const T &data)
+{
+    get(index) = data;
+}
+
+template <class T>
+void SegmentedArraySequence<T>::concat(const Sequence<T> *other)
+{
+    if (!other)
+    {
+        return;
+    }
+    insertRange(size, other);
+}
+
+template <class T>
+Sequence<T> *SegmentedArraySequence<T>::getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const
+{
+    if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
+    {
+        sequenceThrow<std::out_of_range>("Invalid subsequence range");
+    }
+
+    SegmentedArraySequence<T> *newSequence = new SegmentedArraySequence<T>();
+    for (SequenceIndex i = startIndex; i <= endIndex; i++)
+    {
+        newSequence->append(at(i));
+    }
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *SegmentedArraySequence<T>::appendImmutable(const T &item) const
+{
+    SegmentedArraySequence<T> *newSequence = new SegmentedArraySequence<T>(*this);
+    newSequence->append(item);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *SegmentedArraySequence<T>::prependImmutable(const T &item) const
+{
+    SegmentedArraySequence<T> *newSequence = new SegmentedArraySequence<T>(*this);
+    newSequence->prepend(item);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *SegmentedArraySequence<T>::insertAtImmutable(const T &item, const SequenceIndex index) const
+{
+    SegmentedArraySequence<T> *newSequence = new SegmentedArraySequence<T>(*this);
+    newSequence->insertAt(item, index);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *SegmentedArraySequence<T>::setImmutable(const SequenceIndex index, const T &data) const
+{
+    SegmentedArraySequence<T> *newSequence = new SegmentedArraySequence<T>(*this);
+    newSequence->set(index, data);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *SegmentedArraySequence<T>::concatImmutable(const Sequence<T> *other) const
+{
+    SegmentedArraySequence<T> *newSequence = new SegmentedArraySequence<T>(*this);
+    newSequence->concat(other);
+    return newSequence;
+}
+
+template <class T>
+Sequence<T> *SegmentedArraySequence<T>::clone() const
+{
+    return new SegmentedArraySequence<T>(*this);
+}
+
+template <class T>
+void SegmentedArraySequence<T>::print() const
+{
+    this->writeTo(std::cout);
+}
+
+template <class T>
+void SegmentedArraySequence<T>::clear()
+{
+    for (int block = 0; block < blockCount; block++)
+    {
+        delete[] blocks[block];
+        SEQUENCE_STATS_FREE(SegmentedArraySequence);
+    }
+    blockCount = 0;
+    size = 0;
+}
+
+template <class T>
+SegmentedArraySequence<T> &SegmentedArraySequence<T>::operator=(const SegmentedArraySequence<T> &other)
+{
+    if (this != &other)
+    {
+        clear();
+        copyFrom(other);
+    }
+    return *this;
+}
+
+template <class T>
+T &SegmentedArraySequence<T>::operator[](const SequenceIndex index)
+{
+    return get(index);
+}
+
+template <class T>
+const T &SegmentedArraySequence<T>::operator[](const SequenceIndex index) const
+{
+    return get(index);
+}
@@ -0,0 +1,537 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include "../inc/sequence.hpp"
+#include "../inc/transient.hpp"
+
+template <class T>
+class PrefixCopier : public ChunkVisitor<T>
+{
+private:
+    T *output;
+    SequenceIndex length;
+
+public:
+    PrefixCopier(T *output, const SequenceIndex length) : output(output), length(length) {}
+
+    bool visit(const T *items, const SequenceIndex count, const SequenceIndex offset) override
+    {
+        SequenceIndex end = std::min(count, length - offset);
+        std::copy(items, items + end, output + offset);
+        return offset + count < length;
+    }
+};
+
+template <class T>
+void Sequence<T>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    if (index < 0 || index > getLength())
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+
+    for (SequenceIndex i = 0; i < count; i++)
+    {
+        insertAt(items[i], index + i);
+    }
+}
+
+template <class T>
+void Sequence<T>::insertRange(const SequenceIndex index, const Sequence<T> *other)
+{
+    SequenceIndex count = other ? other->getLength() : 0;
+    if (count == 0)
+    {
+        if (index < 0 || index > getLength())
+        {
+            sequenceThrow<std::out_of_range>("Invalid index for insertion");
+        }
+        return;
+    }
+
+    T *items = new T[count];
+    SEQUENCE_TRY
+    {
+        PrefixCopier<T> copier(items, count);
+        other->visitChunks(copier);
+        insertRange(index, items, count);
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        delete[] items;
+        SEQUENCE_RETHROW;
+    }
+    delete[] items;
+}
+
+template <class T>
+SequenceResult<T> Sequence<T>::tryGet(const SequenceIndex index)
+{
+    if (index < 0 || index >= getLength())
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    return get(index);
+}
+
+template <class T>
+SequenceResult<const T> Sequence<T>::tryGet(const SequenceIndex index) const
+{
+    if (index < 0 || index >= getLength())
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    return get(index);
+}
+
+template <class T>
+SequenceResult<T> Sequence<T>::tryGetFirst()
+{
+    if (getLength() == 0)
+    {
+        return SequenceStatus::Empty;
+    }
+    return getFirst();
+}
+
+template <class T>
+SequenceResult<const T> Sequence<T>::tryGetFirst() const
+{
+    if (getLength() == 0)
+    {
+        return SequenceStatus::Empty;
+    }
+    return getFirst();
+}
+
+template <class T>
+SequenceResult<T> Sequence<T>::tryGetLast()
+{
+    if (getLength() == 0)
+    {
+        return SequenceStatus::Empty;
+    }
+    return getLast();
+}
+
+template <class T>
+SequenceResult<const T> Sequence<T>::tryGetLast() const
+{
+    if (getLength() == 0)
+    {
+        return SequenceStatus::Empty;
+    }
+    return getLast();
+}
+
+template <class T>
+SequenceStatus Sequence<T>::trySet(const SequenceIndex index, const T &data)
+{
+    if (index < 0 || index >= getLength())
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    set(index, data);
+    return SequenceStatus::Ok;
+}
+
+template <class T>
+SequenceStatus Sequence<T>::tryInsertAt(const T &item, const SequenceIndex index)
+{
+    if (index < 0 || index > getLength())
+    {
+        return SequenceStatus::OutOfRange;
+    }
+    insertAt(item, index);
+    return SequenceStatus::Ok;
+}
+
+template <class T>
+void Sequence<T>::appendRange(const T *items, const SequenceIndex count)
+{
+    insertRange(getLength(), items, count);
+}
+
+template <class T>
+void Sequence<T>::appendRange(const Sequence<T> *other)
+{
+    insertRange(getLength(), other);
+}
+
+template <class T>
+void Sequence<T>::prependRange(const T *items, const SequenceIndex count)
+{
+    insertRange(0, items, count);
+}
+
+template <class T>
+void Sequence<T>::prependRange(const Sequence<T> *other)
+{
+    insertRange(0, other);
+}
+
+template <class T>
+void Sequence<T>::visitChunks(ChunkVisitor<T> &visitor) const
+{
+    SequenceIndex length = getLength();
+    for (SequenceIndex i = 0; i < length; i++)
+    {
+        if (!visitor.visit(&get(i), 1, i))
+        {
+            return;
+        }
+    }
+}
+
+template <class T>
+const ValueIndex<T> *Sequence<T>::getValueIndex() const
+{
+    return nullptr;
+}
+
+template <class T>
+class ValueFinder : public ChunkVisitor<T>
+{
+private:
+    const T &value;
+    bool stopAtFirst;
+
+public:
+    SequenceIndex found;
+
+    ValueFinder(const T &value, const bool stopAtFirst) : value(value), stopAtFirst(stopAtFirst), found(-1) {}
+
+    const T *getProbe() const override
+    {
+        return &value;
+    }
+
+    bool visit(const T *items, const SequenceIndex count, const SequenceIndex offset) override
+    {
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            if (items[i] == value)
+            {
+                found = offset + i;
+                if (stopAtFirst)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+template <class T>
+SequenceIndex Sequence<T>::indexOf(const T &value) const
+{
+    const ValueIndex<T> *index = getValueIndex();
+    if (index)
+    {
+        return index->first(value);
+    }
+
+    ValueFinder<T> finder(value, true);
+    visitChunks(finder);
+    return finder.found;
+}
+
+template <class T>
+SequenceIndex Sequence<T>::lastIndexOf(const T &value) const
+{
+    const ValueIndex<T> *index = getValueIndex();
+    if (index)
+    {
+        return index->last(value);
+    }
+
+    ValueFinder<T> finder(value, false);
+    visitChunks(finder);
+    return finder.found;
+}
+
+template <class T>
+SequenceHashCache *Sequence<T>::getHashCache() const
+{
+    return nullptr;
+}
+
+template <class T>
+const T *Sequence<T>::getContiguousData() const
+{
+    return nullptr;
+}
+
+template <class T>
+int Sequence<T>::elementsDiffer(const T &left, const T &right)
+{
+    return left == right ? 0 : 1;
+}
+
+template <class T>
+int Sequence<T>::elementOrder(const T &left, const T &right)
+{
+    if (left < right)
+    {
+        return -1;
+    }
+    return right < left ? 1 : 0;
+}
+
+/// Compares the chunks of one sequence against the contiguous elements of
+/// another, up to length, stopping at the first difference.
+template <class T>
+class ContiguousComparer : public ChunkVisitor<T>
+{
+private:
+    const T *reference;
+    SequenceIndex length;
+    typename Sequence<T>::ElementOrder order;
+    bool referenceOnLeft;
+
+public:
+    int result;
+
+    ContiguousComparer(const T *reference, const SequenceIndex length, typename Sequence<T>::ElementOrder order, const bool referenceOnLeft)
+        : reference(reference), length(length), order(order), referenceOnLeft(referenceOnLeft), result(0) {}
+
+    bool visit(const T *items, const SequenceIndex count, const SequenceIndex offset) override
+    {
+        SequenceIndex end = std::min(count, length - offset);
+        for (SequenceIndex i = 0; i < end; i++)
+        {
+            result = referenceOnLeft ? order(reference[offset + i], items[i]) : order(items[i], reference[offset + i]);
+            if (result != 0)
+            {
+                return false;
+            }
+        }
+        return offset + count < length;
+    }
+};
+
+template <class T>
+class HashCombiner : public ChunkVisitor<T>
+{
+public:
+    std::uint64_t state;
+
+    HashCombiner() : state(14695981039346656037ULL) {}
+
+    bool visit(const T *items, const SequenceIndex count, const SequenceIndex) override
+    {
+        std::hash<T> hasher;
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            state = (state ^ static_cast<std::uint64_t>(hasher(items[i]))) * 1099511628211ULL;
+        }
+        return true;
+    }
+};
+
+template <class T>
+int Sequence<T>::compareElements(const Sequence<T> &other, ElementOrder order) const
+{
+    SequenceIndex length = std::min(getLength(), other.getLength());
+    if (length == 0)
+    {
+        return 0;
+    }
+
+    const T *mine = getContiguousData();
+    const T *theirs = other.getContiguousData();
+    if (mine && theirs)
+    {
+        for (SequenceIndex i = 0; i < length; i++)
+        {
+            int result = order(mine[i], theirs[i]);
+            if (result != 0)
+            {
+                return result;
+            }
+        }
+        return 0;
+    }
+    if (mine)
+    {
+        ContiguousComparer<T> comparer(mine, length, order, true);
+        other.visitChunks(comparer);
+        return comparer.result;
+    }
+
+    std::unique_ptr<T[]> copied;
+    if (!theirs)
+    {
+        copied.reset(new T[length]);
+        PrefixCopier<T> copier(copied.get(), length);
+        other.visitChunks(copier);
+        theirs = copied.get();
+    }
+    ContiguousComparer<T> comparer(theirs, length, order, false);
+    visitChunks(comparer);
+    return comparer.result;
+}
+
+template <class T>
+bool equalRuns(const T *left, const T *right, const SequenceIndex count, std::true_type)
+{
+    return std::memcmp(left, right, static_cast<std::size_t>(count) * sizeof(T)) == 0;
+}
+
+template <class T>
+bool equalRuns(const T *left, const T *right, const SequenceIndex count, std::false_type)
+{
+    return std::equal(left, left + count, right);
+}
+
+template <class T>
+bool Sequence<T>::equals(const Sequence<T> &other) const
+{
+    if (this == &other)
+    {
+        return true;
+    }
+    SequenceIndex length = getLength();
+    if (length != other.getLength())
+    {
+        return false;
+    }
+
+    const SequenceHashCache *mineHash = getHashCache();
+    const SequenceHashCache *theirsHash = other.getHashCache();
+    std::size_t mineValue;
+    std::size_t theirsValue;
+    if (mineHash && theirsHash && mineHash->load(mineValue) && theirsHash->load(theirsValue) && mineValue != theirsValue)
+    {
+        return false;
+    }
+
+    const T *mine = getContiguousData();
+    const T *theirs = other.getContiguousData();
+    if (mine && theirs)
+    {
+        return length == 0 || equalRuns(mine, theirs, length, IsBitwiseComparable<T>());
+    }
+    return compareElements(other, &Sequence<T>::elementsDiffer) == 0;
+}
+
+template <class T>
+int Sequence<T>::compare(const Sequence<T> &other) const
+{
+    SequenceIndex length = getLength();
+    SequenceIndex otherLength = other.getLength();
+    const T *mine = getContiguousData();
+    const T *theirs = other.getContiguousData();
+    if (mine && theirs)
+    {
+        SequenceIndex common = std::min(length, otherLength);
+        for (SequenceIndex i = 0; i < common; i++)
+        {
+            if (mine[i] < theirs[i])
+            {
+                return -1;
+            }
+            if (theirs[i] < mine[i])
+            {
+                return 1;
+            }
+        }
+    }
+    else
+    {
+        int result = compareElements(other, &Sequence<T>::elementOrder);
+        if (result != 0)
+        {
+            return result;
+        }
+    }
+    return length < otherLength ? -1 : (otherLength < length ? 1 : 0);
+}
+
+template <class T>
+std::size_t Sequence<T>::hash() const
+{
+    SequenceHashCache *cache = getHashCache();
+    std::size_t cached;
+    if (cache && cache->load(cached))
+    {
+        return cached;
+    }
+
+    HashCombiner<T> combiner;
+    visitChunks(combiner);
+    std::size_t value = static_cast<std::size_t>((combiner.state ^ static_cast<std::uint64_t>(getLength())) * 1099511628211ULL);
+    if (cache)
+    {
+        cache->store(value);
+    }
+    return value;
+}
+
+template <class T>
+Transient<T> Sequence<T>::transient() const
+{
+    return Transient<T>(clone());
+}
+
+template <class T>
+bool Sequence<T>::contains(const T &value) const
+{
+    return indexOf(value) >= 0;
+}
+
+template <class T>
+void Sequence<T>::writeTo(std::ostream &out, const SequenceFormat &format) const
+{
+    SequenceFormatter formatter(out);
+    SequenceIndex length = getLength();
+    if (length == 0)
+    {
+        formatter.write(format.empty);
+        return;
+    }
+
+    for (SequenceIndex i = 0; i < length; i++)
+    {
+        if (i > 0)
+        {
+            formatter.write(format.separator);
+        }
+        formatter.write(format.prefix);
+        formatter.writeValue(get(i));
+        formatter.write(format.suffix);
+    }
+}
+
+template <class T>
+std::ostream &operator<<(std::ostream &out, const Sequence<T> &sequence)
+{
+    sequence.writeTo(out);
+    return out;
+}
+
+template <class T>
+bool operator==(const Sequence<T> &left, const Sequence<T> &right)
+{
+    return left.equals(right);
+}
+
+template <class T>
+bool operator!=(const Sequence<T> &left, const Sequence<T> &right)
+{
+    return !left.equals(right);
+}
+
+template <class T>
+bool operator<(const Sequence<T> &left, const Sequence<T> &right)
+{
+    return left.compare(right) < 0;
+}
@@ -0,0 +1,32 @@
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include "../inc/sequenceError.hpp"
+
+template <class Exception>
+void sequenceThrow(const char *message)
+{
+#if SEQUENCE_EXCEPTIONS
+    throw Exception(message);
+#else
+    std::fprintf(stderr, "%s\n", message);
+    std::abort();
+#endif
+}
+
+template <class Exception>
+void sequenceThrow(const std::string &message)
+{
+    sequenceThrow<Exception>(message.c_str());
+}
+
+template <class T>
+template <class U>
+typename std::remove_const<T>::type SequenceResult<T>::valueOr(U &&fallback) const
+{
+    if (item)
+    {
+        return *item;
+    }
+    return std::forward<U>(fallback);
+}
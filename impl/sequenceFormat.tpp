@@ -0,0 +1,170 @@
+#include <cstdio>
+#include <cstring>
+#include "../inc/sequenceFormat.hpp"
+
+//* SequenceFormat {
+
+inline SequenceFormat::SequenceFormat() : prefix("["), suffix("]"), separator(", "), empty("") {}
+
+inline SequenceFormat::SequenceFormat(const std::string &prefix, const std::string &suffix,
+                                      const std::string &separator, const std::string &empty)
+    : prefix(prefix), suffix(suffix), separator(separator), empty(empty) {}
+
+inline SequenceFormat SequenceFormat::brackets()
+{
+    return SequenceFormat();
+}
+
+inline SequenceFormat SequenceFormat::spaced()
+{
+    return SequenceFormat("", " ", "", "Empty list");
+}
+
+inline SequenceFormat SequenceFormat::lines()
+{
+    return SequenceFormat("", "\n", "", "");
+}
+
+//* } End of SequenceFormat section
+
+//* SequenceFormatter {
+
+inline SequenceFormatter::SequenceFormatter(std::ostream &out) : out(out), buffer(new char[BUFFER_SIZE]), used(0)
+{
+    std::ios::fmtflags flags = out.flags();
+    plain = (flags & std::ios::basefield) == std::ios::dec &&
+            (flags & (std::ios::floatfield | std::ios::showpos | std::ios::showpoint | std::ios::uppercase)) == 0 &&
+            out.width() == 0;
+}
+
+inline SequenceFormatter::~SequenceFormatter()
+{
+    flush();
+    delete[] buffer;
+}
+
+inline void SequenceFormatter::flush()
+{
+    if (used > 0)
+    {
+        out.write(buffer, used);
+        used = 0;
+    }
+}
+
+inline void SequenceFormatter::write(const char *text, const std::size_t length)
+{
+    if (length > static_cast<std::size_t>(BUFFER_SIZE - used))
+    {
+        flush();
+    }
+    if (length > static_cast<std::size_t>(BUFFER_SIZE))
+    {
+        out.write(text, static_cast<std::streamsize>(length));
+        return;
+    }
+    std::memcpy(buffer + used, text, length);
+    used += static_cast<int>(length);
+}
+
+inline void SequenceFormatter::write(const std::string &text)
+{
+    write(text.data(), text.size());
+}
+
+template <class T>
+void SequenceFormatter::writeValue(const T &value)
+{
+    writeValue(value, typename TagOf<T>::type());
+}
+
+template <class T>
+void SequenceFormatter::writeValue(const T &value, GenericTag)
+{
+    flush();
+    out << value;
+}
+
+template <class T>
+void SequenceFormatter::writeValue(const T &value, IntegerTag)
+{
+    if (!plain)
+    {
+        writeValue(value, GenericTag());
+        return;
+    }
+
+    typedef typename std::make_unsigned<T>::type Unsigned;
+    bool negative = value < 0;
+    Unsigned magnitude = negative ? static_cast<Unsigned>(0 - static_cast<Unsigned>(value)) : static_cast<Unsigned>(value);
+
+    char digits[MAX_VALUE_LENGTH];
+    char *end = digits + MAX_VALUE_LENGTH;
+    char *begin = end;
+    do
+    {
+        *--begin = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (negative)
+    {
+        *--begin = '-';
+    }
+
+    write(begin, static_cast<std::size_t>(end - begin));
+}
+
+template <class T>
+void SequenceFormatter::writeValue(const T &value, FloatTag)
+{
+    if (!plain)
+    {
+        writeValue(value, GenericTag());
+        return;
+    }
+
+    char text[2 * MAX_VALUE_LENGTH];
+    int precision = static_cast<int>(out.precision());
+    int length = std::is_same<T, long double>::value
+                     ? std::snprintf(text, sizeof(text), "%.*Lg", precision, static_cast<long double>(value))
+                     : std::snprintf(text, sizeof(text), "%.*g", precision, static_cast<double>(value));
+
+    if (length < 0 || length >= static_cast<int>(sizeof(text)))
+    {
+        writeValue(value, GenericTag());
+        return;
+    }
+    write(text, static_cast<std::size_t>(length));
+}
+
+//* } End of SequenceFormatter section
+
+template <class T>
+void writeItems(std::ostream &out, const T *items, const SequenceIndex count, const SequenceFormat &format)
+{
+    writeRange(out, items, items + count, format);
+}
+
+template <class Iterator>
+void writeRange(std::ostream &out, Iterator begin, Iterator end, const SequenceFormat &format)
+{
+    SequenceFormatter formatter(out);
+    if (!(begin != end))
+    {
+        formatter.write(format.empty);
+        return;
+    }
+
+    bool first = true;
+    for (Iterator it = begin; it != end; ++it)
+    {
+        if (!first)
+        {
+            formatter.write(format.separator);
+        }
+        formatter.write(format.prefix);
+        formatter.writeValue(*it);
+        formatter.write(format.suffix);
+        first = false;
+    }
+}
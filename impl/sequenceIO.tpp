@@ -0,0 +1,308 @@
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "../inc/sequenceIO.hpp"
+#include "../inc/sequenceError.hpp"
+
+inline BinarySequenceHeader makeBinaryHeader(const uint32_t typeTag, const uint32_t elementSize, const uint64_t count)
+{
+    BinarySequenceHeader header;
+    std::memcpy(header.magic, "PSEQ", 4);
+    header.version = 1;
+    header.byteOrder = 0x0102;
+    header.typeTag = typeTag;
+    header.elementSize = elementSize;
+    header.count = count;
+    header.reserved = 0;
+    return header;
+}
+
+inline void swapBytes(void *value, const std::size_t size)
+{
+    unsigned char *bytes = static_cast<unsigned char *>(value);
+    for (std::size_t i = 0; i < size / 2; i++)
+    {
+        unsigned char temp = bytes[i];
+        bytes[i] = bytes[size - 1 - i];
+        bytes[size - 1 - i] = temp;
+    }
+}
+
+inline bool readBinaryHeader(const BinarySequenceHeader &raw, BinarySequenceHeader &header)
+{
+    if (std::memcmp(raw.magic, "PSEQ", 4) != 0)
+    {
+        sequenceThrow<std::runtime_error>("Not a sequence file");
+    }
+
+    header = raw;
+    if (raw.byteOrder == 0x0102)
+    {
+        return false;
+    }
+    if (raw.byteOrder != 0x0201)
+    {
+        sequenceThrow<std::runtime_error>("Corrupted sequence file header");
+    }
+
+    swapBytes(&header.version, sizeof(header.version));
+    swapBytes(&header.byteOrder, sizeof(header.byteOrder));
+    swapBytes(&header.typeTag, sizeof(header.typeTag));
+    swapBytes(&header.elementSize, sizeof(header.elementSize));
+    swapBytes(&header.count, sizeof(header.count));
+    return true;
+}
+
+template <class T>
+void checkBinaryHeader(const BinarySequenceHeader &header)
+{
+    if (header.version != 1)
+    {
+        sequenceThrow<std::runtime_error>("Unsupported sequence file version");
+    }
+    if (header.typeTag != BinaryTypeTag<T>::value || header.elementSize != sizeof(T))
+    {
+        sequenceThrow<std::runtime_error>("Sequence file element type mismatch");
+    }
+    if (header.count > static_cast<uint64_t>(std::numeric_limits<SequenceIndex>::max()))
+    {
+        sequenceThrow<std::length_error>("Sequence file is too large");
+    }
+}
+
+template <class T>
+void saveBinary(const T *items, const SequenceIndex count, const std::string &path)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Binary format requires trivially copyable elements");
+
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+
+    std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        sequenceThrow<std::runtime_error>("Cannot open file for writing: " + path);
+    }
+
+    BinarySequenceHeader header = makeBinaryHeader(BinaryTypeTag<T>::value, sizeof(T), count);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    if (count > 0)
+    {
+        file.write(reinterpret_cast<const char *>(items), static_cast<std::streamsize>(count) * sizeof(T));
+    }
+    if (!file)
+    {
+        sequenceThrow<std::runtime_error>("Failed to write file: " + path);
+    }
+}
+
+template <class T>
+void saveBinary(const DynamicArray<T> &array, const std::string &path)
+{
+    saveBinary(array.getData(), array.getSize(), path);
+}
+
+template <class T>
+void saveBinary(const ArraySequence<T> &sequence, const std::string &path)
+{
+    saveBinary(sequence.getData(), sequence.getLength(), path);
+}
+
+template <class T>
+void saveBinary(const ListSequence<T> &sequence, const std::string &path)
+{
+    BinarySequenceWriter<T> writer(path);
+    for (typename LinkedList<T>::ConstIterator it = sequence.begin(); it != sequence.end(); ++it)
+    {
+        writer.write(*it);
+    }
+    writer.close();
+}
+
+// Reads a saved sequence straight into the storage of any container with
+// clear, resize, getData and getAllocator.
+template <class T, class Storage>
+void loadBinaryInto(const std::string &path, Storage &array)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Binary format requires trivially copyable elements");
+
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file)
+    {
+        sequenceThrow<std::runtime_error>("Cannot open file for reading: " + path);
+    }
+
+    BinarySequenceHeader raw;
+    if (!file.read(reinterpret_cast<char *>(&raw), sizeof(raw)))
+    {
+        sequenceThrow<std::runtime_error>("Truncated sequence file: " + path);
+    }
+
+    BinarySequenceHeader header;
+    bool swapped = readBinaryHeader(raw, header);
+    checkBinaryHeader<T>(header);
+    if (swapped && sizeof(T) > 1 && BinaryTypeTag<T>::value == 0)
+    {
+        sequenceThrow<std::runtime_error>("Cannot convert byte order of untyped elements");
+    }
+
+    if (header.count > static_cast<uint64_t>(maxElements(array.getAllocator())))
+    {
+        sequenceThrow<std::runtime_error>("Sequence file too large: " + path);
+    }
+    // A corrupt count must not turn into a huge allocation before the short
+    // read is noticed.
+    std::streampos start = file.tellg();
+    file.seekg(0, std::ios::end);
+    uint64_t available = static_cast<uint64_t>(file.tellg() - start);
+    file.seekg(start);
+    if (!file || header.count > available / sizeof(T))
+    {
+        sequenceThrow<std::runtime_error>("Truncated sequence file: " + path);
+    }
+    SequenceIndex count = static_cast<SequenceIndex>(header.count);
+    array.clear();
+    array.resize(count);
+    if (count > 0 && !file.read(reinterpret_cast<char *>(array.getData()), static_cast<std::streamsize>(count) * sizeof(T)))
+    {
+        array.clear();
+        sequenceThrow<std::runtime_error>("Truncated sequence file: " + path);
+    }
+
+    if (swapped && sizeof(T) > 1)
+    {
+        T *data = array.getData();
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            swapBytes(&data[i], sizeof(T));
+        }
+    }
+}
+
+template <class T>
+void loadBinary(const std::string &path, DynamicArray<T> &array)
+{
+    loadBinaryInto<T>(path, array);
+}
+
+template <class T>
+void loadBinary(const std::string &path, ArraySequence<T> &sequence)
+{
+    loadBinaryInto<T>(path, sequence);
+    sequence.rebuildIndex();
+}
+
+//* BinarySequenceWriter {
+
+template <class T>
+BinarySequenceWriter<T>::BinarySequenceWriter(const std::string &path)
+    : file(path.c_str(), std::ios::binary | std::ios::trunc), buffer(nullptr), buffered(0), count(0)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Binary format requires trivially copyable elements");
+
+    if (!file)
+    {
+        sequenceThrow<std::runtime_error>("Cannot open file for writing: " + path);
+    }
+
+    BinarySequenceHeader header = makeBinaryHeader(BinaryTypeTag<T>::value, sizeof(T), 0);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    buffer = new char[BUFFER_BYTES];
+}
+
+template <class T>
+BinarySequenceWriter<T>::~BinarySequenceWriter()
+{
+    SEQUENCE_TRY
+    {
+        close();
+    }
+    SEQUENCE_CATCH_ALL
+    {
+    }
+    delete[] buffer;
+}
+
+template <class T>
+void BinarySequenceWriter<T>::flush()
+{
+    if (buffered > 0)
+    {
+        file.write(buffer, buffered);
+        buffered = 0;
+    }
+    if (!file)
+    {
+        sequenceThrow<std::runtime_error>("Failed to write sequence file");
+    }
+}
+
+template <class T>
+void BinarySequenceWriter<T>::write(const T &item)
+{
+    if (!file.is_open())
+    {
+        sequenceThrow<std::logic_error>("Writer is closed");
+    }
+    if (buffered + static_cast<int>(sizeof(T)) > BUFFER_BYTES)
+    {
+        flush();
+    }
+    if (sizeof(T) > static_cast<std::size_t>(BUFFER_BYTES))
+    {
+        file.write(reinterpret_cast<const char *>(&item), sizeof(T));
+    }
+    else
+    {
+        std::memcpy(buffer + buffered, &item, sizeof(T));
+        buffered += sizeof(T);
+    }
+    count++;
+}
+
+template <class T>
+void BinarySequenceWriter<T>::write(const T *items, const SequenceIndex count)
+{
+    if (!file.is_open())
+    {
+        sequenceThrow<std::logic_error>("Writer is closed");
+    }
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+    flush();
+    file.write(reinterpret_cast<const char *>(items), static_cast<std::streamsize>(count) * sizeof(T));
+    this->count += count;
+}
+
+template <class T>
+void BinarySequenceWriter<T>::close()
+{
+    if (!file.is_open())
+    {
+        return;
+    }
+
+    flush();
+    uint64_t total = count;
+    file.seekp(offsetof(BinarySequenceHeader, count));
+    file.write(reinterpret_cast<const char *>(&total), sizeof(total));
+    file.close();
+    if (!file)
+    {
+        sequenceThrow<std::runtime_error>("Failed to write sequence file");
+    }
+}
+
+template <class T>
+uint64_t BinarySequenceWriter<T>::getCount() const
+{
+    return count;
+}
+
+//* } End of BinarySequenceWriter section
@@ -0,0 +1,29 @@
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include "../inc/sequenceIndex.hpp"
+#include "../inc/sequenceError.hpp"
+
+inline SequenceIndex growCapacity(const SequenceIndex current, const SequenceIndex required, const SequenceIndex maximum)
+{
+    if (required < 0 || required > maximum)
+    {
+        sequenceThrow<std::length_error>("Requested size exceeds maximum capacity");
+    }
+
+    SequenceIndex capacity = current > 0 ? current : 1;
+    while (capacity < required)
+    {
+        capacity = capacity > maximum / 2 ? maximum : capacity * 2;
+    }
+    return capacity;
+}
+
+template <class Allocator>
+SequenceIndex maxElements(const Allocator &allocator)
+{
+    typedef typename std::allocator_traits<Allocator>::size_type SizeType;
+    SizeType limit = std::allocator_traits<Allocator>::max_size(allocator);
+    SizeType indexLimit = static_cast<SizeType>(std::numeric_limits<SequenceIndex>::max());
+    return static_cast<SequenceIndex>(limit < indexLimit ? limit : indexLimit);
+}
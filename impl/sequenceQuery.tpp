@@ -0,0 +1,322 @@
+#include <stdexcept>
+#include "../inc/sequenceQuery.hpp"
+#include "../inc/sequenceError.hpp"
+
+/// Feeds each chunk of a sequence to a query consumer and stops the walk as
+/// soon as the consumer declines an element.
+template <class T>
+class ConsumingVisitor : public ChunkVisitor<T>
+{
+private:
+    const std::function<bool(const T &)> &consumer;
+
+public:
+    bool stopped;
+
+    ConsumingVisitor(const std::function<bool(const T &)> &consumer) : consumer(consumer), stopped(false) {}
+
+    bool visit(const T *items, const SequenceIndex count, const SequenceIndex /*offset*/) override
+    {
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            if (!consumer(items[i]))
+            {
+                stopped = true;
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <class T>
+SequenceQuery<T>::SequenceQuery(Producer producer, Bound bound) : producer(producer), bound(bound) {}
+
+template <class T>
+SequenceQuery<T> SequenceQuery<T>::from(const Sequence<T> &sequence)
+{
+    const Sequence<T> *source = &sequence;
+    return SequenceQuery<T>(
+        [source](const Consumer &consumer)
+        {
+            ConsumingVisitor<T> visitor(consumer);
+            source->visitChunks(visitor);
+            return !visitor.stopped;
+        },
+        [source]()
+        { return source->getLength(); });
+}
+
+template <class T>
+SequenceQuery<T> SequenceQuery<T>::from(const ArraySequence<T> &sequence)
+{
+    const ArraySequence<T> *source = &sequence;
+    return SequenceQuery<T>(
+        [source](const Consumer &consumer)
+        {
+            const T *data = source->getData();
+            SequenceIndex length = source->getLength();
+            for (SequenceIndex i = 0; i < length; i++)
+            {
+                if (!consumer(data[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        },
+        [source]()
+        { return source->getLength(); });
+}
+
+template <class T>
+SequenceQuery<T> SequenceQuery<T>::from(const ListSequence<T> &sequence)
+{
+    const ListSequence<T> *source = &sequence;
+    return SequenceQuery<T>(
+        [source](const Consumer &consumer)
+        {
+            for (typename LinkedList<T>::ConstIterator it = source->begin(); it != source->end(); ++it)
+            {
+                if (!consumer(*it))
+                {
+                    return false;
+                }
+            }
+            return true;
+        },
+        [source]()
+        { return source->getLength(); });
+}
+
+template <class T>
+SequenceQuery<T> SequenceQuery<T>::from(const T *items, const SequenceIndex count)
+{
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+
+    return SequenceQuery<T>(
+        [items, count](const Consumer &consumer)
+        {
+            for (SequenceIndex i = 0; i < count; i++)
+            {
+                if (!consumer(items[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        },
+        [count]()
+        { return count; });
+}
+
+template <class T>
+template <class Function>
+SequenceQuery<typename std::decay<decltype(std::declval<Function>()(std::declval<const T &>()))>::type> SequenceQuery<T>::map(Function function) const
+{
+    typedef typename std::decay<decltype(std::declval<Function>()(std::declval<const T &>()))>::type Result;
+    typedef typename SequenceQuery<Result>::Consumer ResultConsumer;
+
+    Producer source = producer;
+    return SequenceQuery<Result>(
+        [source, function](const ResultConsumer &consumer)
+        {
+            return source([&consumer, &function](const T &item)
+                          { return consumer(function(item)); });
+        },
+        bound);
+}
+
+template <class T>
+template <class Predicate>
+SequenceQuery<T> SequenceQuery<T>::filter(Predicate predicate) const
+{
+    Producer source = producer;
+    return SequenceQuery<T>(
+        [source, predicate](const Consumer &consumer)
+        {
+            return source([&consumer, &predicate](const T &item)
+                          { return !predicate(item) || consumer(item); });
+        },
+        bound);
+}
+
+template <class T>
+SequenceQuery<T> SequenceQuery<T>::take(const SequenceIndex count) const
+{
+    if (count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Count cannot be negative");
+    }
+
+    Producer source = producer;
+    Bound sourceBound = bound;
+    return SequenceQuery<T>(
+        [source, count](const Consumer &consumer)
+        {
+            if (count == 0)
+            {
+                return true;
+            }
+            SequenceIndex taken = 0;
+            bool stopped = false;
+            source([&consumer, &taken, &stopped, count](const T &item)
+                   {
+                if (!consumer(item))
+                {
+                    stopped = true;
+                    return false;
+                }
+                return ++taken < count; });
+            return !stopped;
+        },
+        [sourceBound, count]()
+        {
+            SequenceIndex length = sourceBound();
+            return length < count ? length : count;
+        });
+}
+
+template <class T>
+SequenceQuery<T> SequenceQuery<T>::skip(const SequenceIndex count) const
+{
+    if (count < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Count cannot be negative");
+    }
+
+    Producer source = producer;
+    Bound sourceBound = bound;
+    return SequenceQuery<T>(
+        [source, count](const Consumer &consumer)
+        {
+            SequenceIndex skipped = 0;
+            return source([&consumer, &skipped, count](const T &item)
+                          {
+                if (skipped < count)
+                {
+                    skipped++;
+                    return true;
+                }
+                return consumer(item); });
+        },
+        [sourceBound, count]()
+        {
+            SequenceIndex length = sourceBound();
+            return length > count ? length - count : 0;
+        });
+}
+
+template <class T>
+SequenceQuery<T> SequenceQuery<T>::slice(const SequenceIndex startIndex, const SequenceIndex endIndex) const
+{
+    if (startIndex < 0 || startIndex > endIndex)
+    {
+        sequenceThrow<std::out_of_range>("Invalid slice range");
+    }
+    return skip(startIndex).take(endIndex - startIndex + 1);
+}
+
+template <class T>
+SequenceQuery<T> SequenceQuery<T>::concat(const SequenceQuery<T> &other) const
+{
+    Producer first = producer;
+    Producer second = other.producer;
+    Bound firstBound = bound;
+    Bound secondBound = other.bound;
+    return SequenceQuery<T>(
+        [first, second](const Consumer &consumer)
+        {
+            return first(consumer) && second(consumer);
+        },
+        [firstBound, secondBound]()
+        { return firstBound() + secondBound(); });
+}
+
+template <class T>
+template <class Function>
+void SequenceQuery<T>::forEach(Function function) const
+{
+    producer([&function](const T &item)
+             {
+        function(item);
+        return true; });
+}
+
+template <class T>
+SequenceIndex SequenceQuery<T>::count() const
+{
+    SequenceIndex total = 0;
+    producer([&total](const T &)
+             {
+        total++;
+        return true; });
+    return total;
+}
+
+template <class T>
+SequenceIndex SequenceQuery<T>::getBound() const
+{
+    return bound();
+}
+
+template <class T>
+ArraySequence<T> *SequenceQuery<T>::toArraySequence() const
+{
+    DynamicArray<T> items;
+    producer([&items](const T &item)
+             {
+        items.append(item);
+        return true; });
+    return new ArraySequence<T>(std::move(items));
+}
+
+template <class T>
+ListSequence<T> *SequenceQuery<T>::toListSequence() const
+{
+    ListSequence<T> *result = new ListSequence<T>();
+    SEQUENCE_TRY
+    {
+        producer([result](const T &item)
+                 {
+            result->prepend(item);
+            return true; });
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        delete result;
+        SEQUENCE_RETHROW;
+    }
+    result->reverse();
+    return result;
+}
+
+template <class T>
+void SequenceQuery<T>::appendTo(Sequence<T> &target) const
+{
+    producer([&target](const T &item)
+             {
+        target.append(item);
+        return true; });
+}
+
+template <class T>
+SequenceQuery<T> query(const Sequence<T> &sequence)
+{
+    return SequenceQuery<T>::from(sequence);
+}
+
+template <class T>
+SequenceQuery<T> query(const ArraySequence<T> &sequence)
+{
+    return SequenceQuery<T>::from(sequence);
+}
+
+template <class T>
+SequenceQuery<T> query(const ListSequence<T> &sequence)
+{
+    return SequenceQuery<T>::from(sequence);
+}
@@ -0,0 +1,175 @@
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "../inc/sequenceStream.hpp"
+#include "../inc/sequenceError.hpp"
+
+template <class T>
+Generator<T> Generator<T>::promise_type::get_return_object()
+{
+    return Generator<T>(Handle::from_promise(*this));
+}
+
+template <class T>
+std::suspend_always Generator<T>::promise_type::yield_value(const T &value) noexcept
+{
+    current = std::addressof(value);
+    return {};
+}
+
+template <class T>
+void Generator<T>::promise_type::unhandled_exception()
+{
+    failure = std::current_exception();
+}
+
+template <class T>
+Generator<T>::Iterator::Iterator(Handle handle) : handle(handle) {}
+
+template <class T>
+const T &Generator<T>::Iterator::operator*() const
+{
+    return *handle.promise().current;
+}
+
+template <class T>
+typename Generator<T>::Iterator &Generator<T>::Iterator::operator++()
+{
+    Generator<T>::resume(handle);
+    return *this;
+}
+
+template <class T>
+void Generator<T>::Iterator::operator++(int)
+{
+    ++*this;
+}
+
+template <class T>
+bool Generator<T>::Iterator::operator==(std::default_sentinel_t) const
+{
+    return !handle || handle.done();
+}
+
+template <class T>
+Generator<T>::Generator(Handle handle) : handle(handle) {}
+
+template <class T>
+Generator<T>::Generator(Generator<T> &&other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+template <class T>
+Generator<T>::~Generator()
+{
+    if (handle)
+    {
+        handle.destroy();
+    }
+}
+
+template <class T>
+void Generator<T>::resume(Handle handle)
+{
+    handle.resume();
+    if (handle.promise().failure)
+    {
+        std::rethrow_exception(std::exchange(handle.promise().failure, nullptr));
+    }
+}
+
+template <class T>
+typename Generator<T>::Iterator Generator<T>::begin()
+{
+    if (handle && !handle.done())
+    {
+        resume(handle);
+    }
+    return Iterator(handle);
+}
+
+template <class T>
+Generator<T> &Generator<T>::operator=(Generator<T> &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (handle)
+        {
+            handle.destroy();
+        }
+        handle = std::exchange(other.handle, nullptr);
+    }
+    return *this;
+}
+
+template <class T, class Allocator>
+Generator<T> stream(const ArraySequence<T, Allocator> &sequence)
+{
+    for (SequenceIndex i = 0; i < sequence.getLength(); i++)
+    {
+        co_yield sequence.getData()[i];
+    }
+}
+
+template <class T, class Allocator>
+Generator<T> stream(const ListSequence<T, Allocator> &sequence)
+{
+    for (const T &value : sequence)
+    {
+        co_yield value;
+    }
+}
+
+template <class T>
+Generator<T> stream(const Sequence<T> &sequence)
+{
+    for (SequenceIndex i = 0; i < sequence.getLength(); i++)
+    {
+        co_yield sequence.get(i);
+    }
+}
+
+template <class T>
+Generator<T> readValues(std::istream &in)
+{
+    T value;
+    while (in >> value)
+    {
+        co_yield value;
+    }
+}
+
+template <class T>
+SequenceIndex appendFrom(Sequence<T> &target, Generator<T> source, const SequenceIndex batchSize)
+{
+    if (batchSize <= 0)
+    {
+        sequenceThrow<std::invalid_argument>("Batch size must be positive");
+    }
+
+    std::unique_ptr<T[]> batch(new T[batchSize]);
+    SequenceIndex filled = 0;
+    SequenceIndex appended = 0;
+    for (const T &value : source)
+    {
+        batch[filled++] = value;
+        if (filled == batchSize)
+        {
+            target.appendRange(batch.get(), filled);
+            appended += filled;
+            filled = 0;
+        }
+    }
+    if (filled > 0)
+    {
+        target.appendRange(batch.get(), filled);
+        appended += filled;
+    }
+    return appended;
+}
+
+template <class SequenceType, class T>
+SequenceType collect(Generator<T> source, const SequenceIndex batchSize)
+{
+    SequenceType target;
+    appendFrom<T>(target, std::move(source), batchSize);
+    return target;
+}
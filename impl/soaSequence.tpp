@@ -0,0 +1,248 @@
+#include <stdexcept>
+#include "../inc/soaSequence.hpp"
+#include "../inc/sequenceError.hpp"
+
+template <class T>
+ColumnSpan<T>::ColumnSpan(T *items, const SequenceIndex count) : items(items), count(count) {}
+
+template <class T>
+T *ColumnSpan<T>::data() const
+{
+    return items;
+}
+
+template <class T>
+SequenceIndex ColumnSpan<T>::size() const
+{
+    return count;
+}
+
+template <class T>
+T *ColumnSpan<T>::begin() const
+{
+    return items;
+}
+
+template <class T>
+T *ColumnSpan<T>::end() const
+{
+    return items + count;
+}
+
+template <class T>
+T &ColumnSpan<T>::operator[](const SequenceIndex index) const
+{
+    if (index < 0 || index >= count)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+    return items[index];
+}
+
+template <class... Fields>
+const std::size_t SoASequence<Fields...>::COLUMN_COUNT;
+
+template <class... Fields>
+SoASequence<Fields...>::SoASequence() : columns(), length(0) {}
+
+template <class... Fields>
+template <std::size_t... Column>
+void SoASequence<Fields...>::resizeColumns(const SequenceIndex newLength, std::index_sequence<Column...>)
+{
+    int expand[] = {0, (std::get<Column>(columns).resize(newLength), 0)...};
+    (void)expand;
+}
+
+template <class... Fields>
+template <std::size_t... Column>
+void SoASequence<Fields...>::assign(const SequenceIndex index, const Record &record, std::index_sequence<Column...>)
+{
+    int expand[] = {0, (std::get<Column>(columns).getData()[index] = std::get<Column>(record), 0)...};
+    (void)expand;
+}
+
+template <class... Fields>
+template <std::size_t... Column>
+typename SoASequence<Fields...>::Record SoASequence<Fields...>::read(const SequenceIndex index, std::index_sequence<Column...>) const
+{
+    return Record(std::get<Column>(columns).getData()[index]...);
+}
+
+template <class... Fields>
+template <class T>
+void SoASequence<Fields...>::shiftColumn(T *items, const SequenceIndex index, const SequenceIndex length)
+{
+    for (SequenceIndex i = length - 1; i > index; i--)
+    {
+        items[i] = std::move(items[i - 1]);
+    }
+}
+
+template <class... Fields>
+template <std::size_t... Column>
+void SoASequence<Fields...>::shiftColumns(const SequenceIndex index, std::index_sequence<Column...>)
+{
+    int expand[] = {0, (shiftColumn(std::get<Column>(columns).getData(), index, length), 0)...};
+    (void)expand;
+}
+
+template <class... Fields>
+void SoASequence<Fields...>::resizeAll(const SequenceIndex newLength)
+{
+    if (newLength < 0)
+    {
+        sequenceThrow<std::invalid_argument>("Invalid size");
+    }
+
+    SEQUENCE_TRY
+    {
+        resizeColumns(newLength, Columns());
+    }
+    SEQUENCE_CATCH_ALL
+    {
+        resizeColumns(length, Columns());
+        SEQUENCE_RETHROW;
+    }
+    length = newLength;
+}
+
+template <class... Fields>
+void SoASequence<Fields...>::checkIndex(const SequenceIndex index) const
+{
+    if (index < 0 || index >= length)
+    {
+        sequenceThrow<std::out_of_range>("Index out of range");
+    }
+}
+
+template <class... Fields>
+SequenceIndex SoASequence<Fields...>::getLength() const
+{
+    return length;
+}
+
+template <class... Fields>
+void SoASequence<Fields...>::append(const Record &record)
+{
+    resizeAll(length + 1);
+    assign(length - 1, record, Columns());
+}
+
+template <class... Fields>
+void SoASequence<Fields...>::append(const Fields &...values)
+{
+    append(Record(values...));
+}
+
+template <class... Fields>
+void SoASequence<Fields...>::insertAt(const Record &record, const SequenceIndex index)
+{
+    if (index < 0 || index > length)
+    {
+        sequenceThrow<std::out_of_range>("Invalid index for insertion");
+    }
+
+    resizeAll(length + 1);
+    shiftColumns(index, Columns());
+    assign(index, record, Columns());
+}
+
+template <class... Fields>
+typename SoASequence<Fields...>::Record SoASequence<Fields...>::get(const SequenceIndex index) const
+{
+    checkIndex(index);
+    return read(index, Columns());
+}
+
+template <class... Fields>
+void SoASequence<Fields...>::set(const SequenceIndex index, const Record &record)
+{
+    checkIndex(index);
+    assign(index, record, Columns());
+}
+
+template <class... Fields>
+void SoASequence<Fields...>::set(const SequenceIndex index, const Fields &...values)
+{
+    set(index, Record(values...));
+}
+
+template <class... Fields>
+void SoASequence<Fields...>::resize(const SequenceIndex newLength)
+{
+    resizeAll(newLength);
+}
+
+template <class... Fields>
+void SoASequence<Fields...>::clear()
+{
+    columns = std::tuple<DynamicArray<Fields>...>();
+    length = 0;
+}
+
+template <class... Fields>
+template <std::size_t Column>
+ColumnSpan<typename SoASequence<Fields...>::template ColumnType<Column>> SoASequence<Fields...>::column()
+{
+    return ColumnSpan<ColumnType<Column>>(std::get<Column>(columns).getData(), length);
+}
+
+template <class... Fields>
+template <std::size_t Column>
+ColumnSpan<const typename SoASequence<Fields...>::template ColumnType<Column>> SoASequence<Fields...>::column() const
+{
+    return ColumnSpan<const ColumnType<Column>>(std::get<Column>(columns).getData(), length);
+}
+
+template <class... Fields>
+template <std::size_t Column>
+typename SoASequence<Fields...>::template ColumnType<Column> &SoASequence<Fields...>::at(const SequenceIndex index)
+{
+    checkIndex(index);
+    return std::get<Column>(columns).getData()[index];
+}
+
+template <class... Fields>
+template <std::size_t Column>
+const typename SoASequence<Fields...>::template ColumnType<Column> &SoASequence<Fields...>::at(const SequenceIndex index) const
+{
+    checkIndex(index);
+    return std::get<Column>(columns).getData()[index];
+}
+
+template <class... Fields>
+typename SoASequence<Fields...>::Record SoASequence<Fields...>::operator[](const SequenceIndex index) const
+{
+    return get(index);
+}
+
+template <class T>
+typename std::remove_const<T>::type sumColumn(const ColumnSpan<T> &column)
+{
+    typedef typename std::remove_const<T>::type Value;
+    const int LANES = 8;
+
+    Value partial[LANES] = {};
+    const Value *items = column.data();
+    const SequenceIndex count = column.size();
+
+    SequenceIndex i = 0;
+    for (; i + LANES <= count; i += LANES)
+    {
+        for (int lane = 0; lane < LANES; lane++)
+        {
+            partial[lane] += items[i + lane];
+        }
+    }
+
+    Value total = Value();
+    for (; i < count; i++)
+    {
+        total += items[i];
+    }
+    for (int lane = 0; lane < LANES; lane++)
+    {
+        total += partial[lane];
+    }
+    return total;
+}
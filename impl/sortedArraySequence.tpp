@@ -0,0 +1,259 @@
+#include <iostream>
+#include <stdexcept>
+#include "../inc/sortedArraySequence.hpp"
+#include "../inc/sequenceError.hpp"
+
+template <class T, class Compare>
+SortedArraySequence<T, Compare>::SortedArraySequence(Compare compare) : array(), compare(compare), layout(SearchLayout::Branchless) {}
+
+template <class T, class Compare>
+SortedArraySequence<T, Compare>::SortedArraySequence(const T *items, const SequenceIndex count, Compare compare)
+    : array(), compare(compare), layout(SearchLayout::Branchless)
+{
+    if (count < 0 || (items == nullptr && count > 0))
+    {
+        sequenceThrow<std::invalid_argument>("Invalid items");
+    }
+
+    array.resize(count);
+    for (SequenceIndex i = 0; i < count; i++)
+    {
+        array[i] = items[i];
+    }
+    array.sort(compare);
+}
+
+template <class T, class Compare>
+SortedArraySequence<T, Compare>::SortedArraySequence(const Sequence<T> &items, Compare compare)
+    : array(), compare(compare), layout(SearchLayout::Branchless)
+{
+    SequenceIndex count = items.getLength();
+    array.resize(count);
+    PrefixCopier<T> copier(array.getData(), count);
+    items.visitChunks(copier);
+    array.sort(compare);
+}
+
+template <class T, class Compare>
+const T &SortedArraySequence<T, Compare>::getFirst() const
+{
+    return array.getFirst();
+}
+
+template <class T, class Compare>
+const T &SortedArraySequence<T, Compare>::getLast() const
+{
+    return array.getLast();
+}
+
+template <class T, class Compare>
+const T &SortedArraySequence<T, Compare>::get(const SequenceIndex index) const
+{
+    return array.get(index);
+}
+
+template <class T, class Compare>
+SequenceIndex SortedArraySequence<T, Compare>::getLength() const
+{
+    return array.getSize();
+}
+
+template <class T, class Compare>
+const DynamicArray<T> &SortedArraySequence<T, Compare>::getArray() const
+{
+    return array;
+}
+
+template <class T, class Compare>
+SequenceIndex SortedArraySequence<T, Compare>::fillTree(const SequenceIndex node, SequenceIndex next)
+{
+    if (node > array.getSize())
+    {
+        return next;
+    }
+
+    next = fillTree(2 * node, next);
+    tree[node] = array[next];
+    treeIndex[node] = next;
+    return fillTree(2 * node + 1, next + 1);
+}
+
+template <class T, class Compare>
+void SortedArraySequence<T, Compare>::buildTree()
+{
+    tree.clear();
+    treeIndex.clear();
+    tree.resize(array.getSize() + 1);
+    treeIndex.resize(array.getSize() + 1);
+    fillTree(1, 0);
+}
+
+template <class T, class Compare>
+void SortedArraySequence<T, Compare>::setSearchLayout(const SearchLayout layout)
+{
+    this->layout = layout;
+    if (layout == SearchLayout::Eytzinger)
+    {
+        buildTree();
+    }
+    else
+    {
+        tree.clear();
+        treeIndex.clear();
+    }
+}
+
+template <class T, class Compare>
+SearchLayout SortedArraySequence<T, Compare>::getSearchLayout() const
+{
+    return layout;
+}
+
+template <class T, class Compare>
+void SortedArraySequence<T, Compare>::insert(const T &item)
+{
+    array.insertAt(item, upperBound(item));
+    if (layout == SearchLayout::Eytzinger)
+    {
+        buildTree();
+    }
+}
+
+template <class T, class Compare>
+void SortedArraySequence<T, Compare>::clear()
+{
+    array.clear();
+    tree.clear();
+    treeIndex.clear();
+    if (layout == SearchLayout::Eytzinger)
+    {
+        buildTree();
+    }
+}
+
+template <class T, class Compare>
+template <class Before>
+SequenceIndex SortedArraySequence<T, Compare>::partitionPoint(Before before) const
+{
+    SequenceIndex size = array.getSize();
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    if (layout == SearchLayout::Binary)
+    {
+        const T *data = array.getData();
+        SequenceIndex low = 0;
+        SequenceIndex high = size;
+        while (low < high)
+        {
+            SequenceIndex middle = low + (high - low) / 2;
+            if (before(data[middle]))
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        return low;
+    }
+
+    if (layout == SearchLayout::Branchless)
+    {
+        const T *data = array.getData();
+        const T *base = data;
+        SequenceIndex remaining = size;
+        while (remaining > 1)
+        {
+            SequenceIndex half = remaining / 2;
+            base = before(base[half]) ? base + half : base;
+            remaining -= half;
+        }
+        return static_cast<SequenceIndex>(base - data) + (before(*base) ? 1 : 0);
+    }
+
+    const T *nodes = tree.getData();
+    std::size_t node = 1;
+    while (node <= static_cast<std::size_t>(size))
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(nodes + 16 * node);
+#endif
+        node = 2 * node + static_cast<std::size_t>(before(nodes[node]));
+    }
+    while (node & 1)
+    {
+        node >>= 1;
+    }
+    node >>= 1;
+    return node == 0 ? size : treeIndex[static_cast<SequenceIndex>(node)];
+}
+
+template <class T, class Compare>
+SequenceIndex SortedArraySequence<T, Compare>::lowerBound(const T &value) const
+{
+    const Compare &less = compare;
+    return partitionPoint([&less, &value](const T &item)
+                          { return less(item, value); });
+}
+
+template <class T, class Compare>
+SequenceIndex SortedArraySequence<T, Compare>::upperBound(const T &value) const
+{
+    const Compare &less = compare;
+    return partitionPoint([&less, &value](const T &item)
+                          { return !less(value, item); });
+}
+
+template <class T, class Compare>
+SequenceIndex SortedArraySequence<T, Compare>::rank(const T &value) const
+{
+    return lowerBound(value);
+}
+
+template <class T, class Compare>
+IndexRange SortedArraySequence<T, Compare>::equalRange(const T &value) const
+{
+    IndexRange range;
+    range.begin = lowerBound(value);
+    range.end = upperBound(value);
+    return range;
+}
+
+template <class T, class Compare>
+SequenceIndex SortedArraySequence<T, Compare>::find(const T &value) const
+{
+    SequenceIndex index = lowerBound(value);
+    if (index < array.getSize() && !compare(value, array[index]))
+    {
+        return index;
+    }
+    return -1;
+}
+
+template <class T, class Compare>
+bool SortedArraySequence<T, Compare>::contains(const T &value) const
+{
+    return find(value) != -1;
+}
+
+template <class T, class Compare>
+void SortedArraySequence<T, Compare>::writeTo(std::ostream &out, const SequenceFormat &format) const
+{
+    array.writeTo(out, format);
+}
+
+template <class T, class Compare>
+void SortedArraySequence<T, Compare>::print() const
+{
+    array.print();
+}
+
+template <class T, class Compare>
+const T &SortedArraySequence<T, Compare>::operator[](const SequenceIndex index) const
+{
+    return array[index];
+}
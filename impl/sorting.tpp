@@ -0,0 +1,286 @@
+#include <thread>
+#include <utility>
+#include "../inc/sorting.hpp"
+
+template <class T, class Compare>
+void insertionSort(T *items, const SequenceIndex count, Compare compare)
+{
+    for (SequenceIndex i = 1; i < count; i++)
+    {
+        if (!compare(items[i], items[i - 1]))
+        {
+            continue;
+        }
+
+        T value = std::move(items[i]);
+        SequenceIndex j = i;
+        while (j > 0 && compare(value, items[j - 1]))
+        {
+            items[j] = std::move(items[j - 1]);
+            j--;
+        }
+        items[j] = std::move(value);
+    }
+}
+
+template <class T, class Compare>
+void siftDown(T *items, SequenceIndex root, const SequenceIndex count, Compare compare)
+{
+    while (true)
+    {
+        SequenceIndex child = 2 * root + 1;
+        if (child >= count)
+        {
+            return;
+        }
+        if (child + 1 < count && compare(items[child], items[child + 1]))
+        {
+            child++;
+        }
+        if (!compare(items[root], items[child]))
+        {
+            return;
+        }
+        std::swap(items[root], items[child]);
+        root = child;
+    }
+}
+
+template <class T, class Compare>
+void heapSort(T *items, const SequenceIndex count, Compare compare)
+{
+    for (SequenceIndex i = count / 2 - 1; i >= 0; i--)
+    {
+        siftDown(items, i, count, compare);
+    }
+    for (SequenceIndex end = count - 1; end > 0; end--)
+    {
+        std::swap(items[0], items[end]);
+        siftDown(items, 0, end, compare);
+    }
+}
+
+template <class T, class Compare>
+void introSortLoop(T *items, SequenceIndex count, int depth, Compare compare)
+{
+    while (count > 16)
+    {
+        if (depth == 0)
+        {
+            heapSort(items, count, compare);
+            return;
+        }
+        depth--;
+
+        SequenceIndex middle = count / 2;
+        if (compare(items[middle], items[0]))
+        {
+            std::swap(items[middle], items[0]);
+        }
+        if (compare(items[count - 1], items[middle]))
+        {
+            std::swap(items[count - 1], items[middle]);
+            if (compare(items[middle], items[0]))
+            {
+                std::swap(items[middle], items[0]);
+            }
+        }
+        T pivot = items[middle];
+
+        SequenceIndex i = -1;
+        SequenceIndex j = count;
+        while (true)
+        {
+            do
+            {
+                i++;
+            } while (compare(items[i], pivot));
+            do
+            {
+                j--;
+            } while (compare(pivot, items[j]));
+            if (i >= j)
+            {
+                break;
+            }
+            std::swap(items[i], items[j]);
+        }
+
+        SequenceIndex leftCount = j + 1;
+        SequenceIndex rightCount = count - leftCount;
+        if (leftCount < rightCount)
+        {
+            introSortLoop(items, leftCount, depth, compare);
+            items += leftCount;
+            count = rightCount;
+        }
+        else
+        {
+            introSortLoop(items + leftCount, rightCount, depth, compare);
+            count = leftCount;
+        }
+    }
+    insertionSort(items, count, compare);
+}
+
+template <class T, class Compare>
+void introSort(T *items, const SequenceIndex count, Compare compare)
+{
+    int depth = 0;
+    for (SequenceIndex n = count; n > 1; n >>= 1)
+    {
+        depth += 2;
+    }
+    introSortLoop(items, count, depth, compare);
+}
+
+template <class T, class Compare>
+void mergeRuns(T *first, const SequenceIndex firstCount, T *second, const SequenceIndex secondCount, T *out, Compare compare)
+{
+    SequenceIndex i = 0;
+    SequenceIndex j = 0;
+    while (i < firstCount && j < secondCount)
+    {
+        if (compare(second[j], first[i]))
+        {
+            *out++ = std::move(second[j++]);
+        }
+        else
+        {
+            *out++ = std::move(first[i++]);
+        }
+    }
+    while (i < firstCount)
+    {
+        *out++ = std::move(first[i++]);
+    }
+    while (j < secondCount)
+    {
+        *out++ = std::move(second[j++]);
+    }
+}
+
+template <class T, class Compare>
+void mergeSort(T *items, const SequenceIndex count, Compare compare)
+{
+    const SequenceIndex blockSize = 32;
+    for (SequenceIndex start = 0; start < count; start += blockSize)
+    {
+        insertionSort(items + start, count - start < blockSize ? count - start : blockSize, compare);
+    }
+    if (count <= blockSize)
+    {
+        return;
+    }
+
+    T *buffer = new T[count];
+    T *source = items;
+    T *target = buffer;
+    for (SequenceIndex width = blockSize; width < count; width *= 2)
+    {
+        for (SequenceIndex start = 0; start < count; start += 2 * width)
+        {
+            SequenceIndex middle = start + width < count ? start + width : count;
+            SequenceIndex end = start + 2 * width < count ? start + 2 * width : count;
+            mergeRuns(source + start, middle - start, source + middle, end - middle, target + start, compare);
+        }
+        std::swap(source, target);
+    }
+
+    if (source != items)
+    {
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            items[i] = std::move(source[i]);
+        }
+    }
+    delete[] buffer;
+}
+
+template <class T, class Compare>
+void parallelSort(T *items, const SequenceIndex count, Compare compare, const int threads, const bool stable)
+{
+    const SequenceIndex minPartSize = 8192;
+    int parts = threads;
+    if (count / minPartSize < parts)
+    {
+        parts = static_cast<int>(count / minPartSize);
+    }
+
+    if (parts <= 1)
+    {
+        if (stable)
+        {
+            mergeSort(items, count, compare);
+        }
+        else
+        {
+            introSort(items, count, compare);
+        }
+        return;
+    }
+
+    SequenceIndex *bounds = new SequenceIndex[parts + 1];
+    std::thread *workers = new std::thread[parts];
+    for (int i = 0; i <= parts; i++)
+    {
+        bounds[i] = count / parts * i + count % parts * i / parts;
+    }
+
+    for (int i = 0; i < parts; i++)
+    {
+        T *part = items + bounds[i];
+        SequenceIndex partCount = bounds[i + 1] - bounds[i];
+        workers[i] = std::thread([part, partCount, compare, stable]()
+                                 {
+            if (stable)
+            {
+                mergeSort(part, partCount, compare);
+            }
+            else
+            {
+                introSort(part, partCount, compare);
+            } });
+    }
+    for (int i = 0; i < parts; i++)
+    {
+        workers[i].join();
+    }
+
+    T *buffer = new T[count];
+    T *source = items;
+    T *target = buffer;
+    int runs = parts;
+    while (runs > 1)
+    {
+        SequenceIndex merged = (runs + 1) / 2;
+        for (int k = 0; k < merged; k++)
+        {
+            SequenceIndex start = bounds[2 * k];
+            SequenceIndex middle = bounds[2 * k + 1];
+            SequenceIndex end = 2 * k + 2 <= runs ? bounds[2 * k + 2] : middle;
+            workers[k] = std::thread([source, target, start, middle, end, compare]()
+                                     { mergeRuns(source + start, middle - start, source + middle, end - middle, target + start, compare); });
+        }
+        for (int k = 0; k < merged; k++)
+        {
+            workers[k].join();
+            bounds[k] = bounds[2 * k];
+        }
+        bounds[merged] = count;
+        runs = merged;
+        std::swap(source, target);
+    }
+
+    if (source != items)
+    {
+        for (SequenceIndex i = 0; i < count; i++)
+        {
+            items[i] = std::move(source[i]);
+        }
+    }
+
+    delete[] buffer;
+    delete[] workers;
+    delete[] bounds;
+}
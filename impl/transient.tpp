@@ -0,0 +1,122 @@
+#include <stdexcept>
+#include "../inc/transient.hpp"
+#include "../inc/sequenceError.hpp"
+
+template <class T>
+Transient<T>::Transient(Sequence<T> *sequence) : sequence(sequence)
+{
+    if (!sequence)
+    {
+        sequenceThrow<std::invalid_argument>("Null sequence");
+    }
+}
+
+template <class T>
+Transient<T>::Transient(Transient<T> &&other) noexcept : sequence(other.sequence)
+{
+    other.sequence = nullptr;
+}
+
+template <class T>
+Transient<T>::~Transient()
+{
+    delete sequence;
+}
+
+template <class T>
+Sequence<T> &Transient<T>::target() const
+{
+    if (!sequence)
+    {
+        sequenceThrow<std::logic_error>("Transient is frozen");
+    }
+    return *sequence;
+}
+
+template <class T>
+Transient<T> &Transient<T>::append(const T &item)
+{
+    target().append(item);
+    return *this;
+}
+
+template <class T>
+Transient<T> &Transient<T>::prepend(const T &item)
+{
+    target().prepend(item);
+    return *this;
+}
+
+template <class T>
+Transient<T> &Transient<T>::insertAt(const T &item, const SequenceIndex index)
+{
+    target().insertAt(item, index);
+    return *this;
+}
+
+template <class T>
+Transient<T> &Transient<T>::set(const SequenceIndex index, const T &data)
+{
+    target().set(index, data);
+    return *this;
+}
+
+template <class T>
+Transient<T> &Transient<T>::concat(const Sequence<T> *other)
+{
+    target().concat(other);
+    return *this;
+}
+
+template <class T>
+Transient<T> &Transient<T>::insertRange(const SequenceIndex index, const T *items, const SequenceIndex count)
+{
+    target().insertRange(index, items, count);
+    return *this;
+}
+
+template <class T>
+Transient<T> &Transient<T>::appendRange(const T *items, const SequenceIndex count)
+{
+    target().appendRange(items, count);
+    return *this;
+}
+
+template <class T>
+const T &Transient<T>::get(const SequenceIndex index) const
+{
+    const Sequence<T> &edited = target();
+    return edited.get(index);
+}
+
+template <class T>
+SequenceIndex Transient<T>::getLength() const
+{
+    return target().getLength();
+}
+
+template <class T>
+bool Transient<T>::isFrozen() const
+{
+    return sequence == nullptr;
+}
+
+template <class T>
+Sequence<T> *Transient<T>::freeze()
+{
+    Sequence<T> *result = &target();
+    sequence = nullptr;
+    return result;
+}
+
+template <class T>
+Transient<T> &Transient<T>::operator=(Transient<T> &&other) noexcept
+{
+    if (this != &other)
+    {
+        delete sequence;
+        sequence = other.sequence;
+        other.sequence = nullptr;
+    }
+    return *this;
+}
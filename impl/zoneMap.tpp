@@ -0,0 +1,115 @@
+#include "../inc/zoneMap.hpp"
+
+template <class T, class Hash>
+ZoneMap<T, Hash>::ZoneMap(const Hash &hash) : zones(), hash(hash) {}
+
+template <class T, class Hash>
+ChunkSummary<T> *ZoneMap<T, Hash>::clone() const
+{
+    return new ZoneMap<T, Hash>(*this);
+}
+
+template <class T, class Hash>
+std::uint64_t ZoneMap<T, Hash>::mix(const T &value) const
+{
+    std::uint64_t mixed = static_cast<std::uint64_t>(hash(value));
+    mixed ^= mixed >> 33;
+    mixed *= 0xff51afd7ed558ccdull;
+    mixed ^= mixed >> 33;
+    mixed *= 0xc4ceb9fe1a85ec53ull;
+    mixed ^= mixed >> 33;
+    return mixed;
+}
+
+template <class T, class Hash>
+void ZoneMap<T, Hash>::rebuild(const T *items, const SequenceIndex count)
+{
+    zones.clear();
+    for (SequenceIndex i = 0; i < count; i++)
+    {
+        add(items[i], i);
+    }
+}
+
+template <class T, class Hash>
+void ZoneMap<T, Hash>::add(const T &value, const SequenceIndex position)
+{
+    SequenceIndex chunk = position >> ChunkSummary<T>::CHUNK_SHIFT;
+    if (chunk >= zones.getSize())
+    {
+        zones.resize(chunk + 1);
+    }
+
+    Zone &zone = zones[chunk];
+    if (zone.empty)
+    {
+        zone.min = value;
+        zone.max = value;
+        zone.empty = false;
+    }
+    else if (value < zone.min)
+    {
+        zone.min = value;
+    }
+    else if (zone.max < value)
+    {
+        zone.max = value;
+    }
+
+    std::uint64_t mixed = mix(value);
+    for (int probe = 0; probe < 3; probe++)
+    {
+        std::uint64_t bit = (mixed >> (probe * 14)) & (BLOOM_WORDS * 64 - 1);
+        zone.bloom[bit >> 6] |= std::uint64_t(1) << (bit & 63);
+    }
+}
+
+template <class T, class Hash>
+bool ZoneMap<T, Hash>::mayContain(const SequenceIndex chunk, const T &value) const
+{
+    if (chunk >= zones.getSize())
+    {
+        return true;
+    }
+    const Zone &zone = zones[chunk];
+    if (zone.empty || value < zone.min || zone.max < value)
+    {
+        return false;
+    }
+
+    std::uint64_t mixed = mix(value);
+    for (int probe = 0; probe < 3; probe++)
+    {
+        std::uint64_t bit = (mixed >> (probe * 14)) & (BLOOM_WORDS * 64 - 1);
+        if (!(zone.bloom[bit >> 6] & (std::uint64_t(1) << (bit & 63))))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class T, class Hash>
+RangeOverlap ZoneMap<T, Hash>::overlap(const SequenceIndex chunk, const T &low, const T &high) const
+{
+    if (chunk >= zones.getSize())
+    {
+        return RangeOverlap::Partial;
+    }
+    const Zone &zone = zones[chunk];
+    if (zone.empty || zone.max < low || high < zone.min)
+    {
+        return RangeOverlap::None;
+    }
+    if (!(zone.min < low) && !(high < zone.max))
+    {
+        return RangeOverlap::Full;
+    }
+    return RangeOverlap::Partial;
+}
+
+template <class T, class Hash>
+SequenceIndex ZoneMap<T, Hash>::getChunkCount() const
+{
+    return zones.getSize();
+}
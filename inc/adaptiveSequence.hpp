@@ -0,0 +1,117 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include "sequence.hpp"
+
+/// @brief Storage an AdaptiveSequence currently uses: an ArraySequence, a
+/// DListSequence or a RopeSequence of leaf chunks.
+enum class SequenceRepresentation
+{
+    Contiguous,
+    Linked,
+    Chunked
+};
+
+/// @brief Sequence that watches its own operation mix (reads at the ends or in
+/// the middle, inserts at the back, front or middle) and migrates between
+/// contiguous, linked and chunked storage when another representation would
+/// have been cheaper. The decaying mix is re-costed every few operations; a
+/// migration happens only once the estimated savings exceed twice the cost of
+/// copying into the new representation, so short bursts do not cause flapping.
+/// Mutations and non-const accesses may migrate and invalidate references.
+/// Const reads only count themselves in atomic counters, so concurrent const
+/// readers are safe and their references stay valid; the counts join the mix
+/// at the next non-const operation.
+template <class T>
+class AdaptiveSequence : public Sequence<T>
+{
+private:
+    enum OperationKind
+    {
+        EndRead,
+        MiddleRead,
+        BackInsert,
+        FrontInsert,
+        MiddleInsert,
+        KIND_COUNT
+    };
+
+    static const int CHECK_INTERVAL = 64;
+    static const int DECAY_INTERVAL = 1024;
+    static const int REPRESENTATION_COUNT = 3;
+    static const int READ_KIND_COUNT = MiddleRead + 1;
+
+    class Collector;
+
+    std::unique_ptr<Sequence<T>> sequence;
+    SequenceRepresentation representation;
+    double mix[KIND_COUNT];
+    SequenceIndex sinceCheck;
+    SequenceIndex sinceDecay;
+    SequenceIndex migrations;
+    /// Reads made through const accessors since the last non-const operation.
+    mutable std::atomic<SequenceIndex> pendingReads[READ_KIND_COUNT];
+
+    AdaptiveSequence(Sequence<T> *sequence, const SequenceRepresentation representation);
+
+    static Sequence<T> *create(const SequenceRepresentation representation, const T *items, const SequenceIndex count);
+    static double operationCost(const SequenceRepresentation representation, const OperationKind kind, const SequenceIndex length);
+    static double migrationCost(const SequenceRepresentation from, const SequenceRepresentation to, const SequenceIndex length);
+
+    OperationKind readKind(const SequenceIndex index) const;
+    void recordRead(const OperationKind kind) const;
+    SequenceIndex collectPendingReads();
+    void observeInsert(const SequenceIndex index);
+    void observe(const OperationKind kind);
+    void adapt(const SequenceIndex elapsed);
+    void migrate(const SequenceRepresentation target);
+    const Sequence<T> &view() const;
+
+public:
+    AdaptiveSequence();
+    explicit AdaptiveSequence(const SequenceRepresentation representation);
+    AdaptiveSequence(const T *items, const SequenceIndex count, const SequenceRepresentation representation = SequenceRepresentation::Contiguous);
+    AdaptiveSequence(const AdaptiveSequence<T> &other);
+    virtual ~AdaptiveSequence() override;
+
+    T &getFirst() override;
+    T &getLast() override;
+    T &get(const SequenceIndex index) override;
+
+    const T &getFirst() const override;
+    const T &getLast() const override;
+    const T &get(const SequenceIndex index) const override;
+
+    SequenceIndex getLength() const override;
+    void visitChunks(ChunkVisitor<T> &visitor) const override;
+    const T *getContiguousData() const override;
+
+    void append(const T &item) override;
+    void prepend(const T &item) override;
+    void insertAt(const T &item, const SequenceIndex index) override;
+    void set(const SequenceIndex index, const T &data) override;
+    void concat(const Sequence<T> *other) override;
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count) override;
+    void insertRange(const SequenceIndex index, const Sequence<T> *other) override;
+
+    Sequence<T> *getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const override;
+    Sequence<T> *appendImmutable(const T &item) const override;
+    Sequence<T> *prependImmutable(const T &item) const override;
+    Sequence<T> *insertAtImmutable(const T &item, const SequenceIndex index) const override;
+    Sequence<T> *setImmutable(const SequenceIndex index, const T &data) const override;
+    Sequence<T> *concatImmutable(const Sequence<T> *other) const override;
+    Sequence<T> *clone() const override;
+
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const override;
+    void print() const override;
+
+    SequenceRepresentation getRepresentation() const;
+    /// @brief Number of representation changes since construction.
+    SequenceIndex getMigrationCount() const;
+    /// @brief Moves to target now; the sequence keeps adapting afterwards.
+    void migrateTo(const SequenceRepresentation target);
+
+    AdaptiveSequence<T> &operator=(const AdaptiveSequence<T> &other);
+};
+
+#include "../impl/adaptiveSequence.tpp"
@@ -0,0 +1,73 @@
+#pragma once
+#include <atomic>
+#include "dynamicArray.hpp"
+#include "arraySequence.hpp"
+
+/// @brief Lock-free multi-producer staging area for bulk appends.
+/// Each thread appends through its own Producer, which fills a private chunk
+/// and publishes it with a single compare-and-swap once full (or on flush).
+/// drainInto() takes every published chunk with one atomic exchange and
+/// copies them into the target after a single resize. Items of one producer
+/// keep their relative order; chunks of different producers are ordered by
+/// publication. Drains may run concurrently with producers and with each other.
+/// If the target cannot grow, the taken chunks are published back ahead of
+/// anything newer and the exception propagates. A sequence's attached index
+/// and zone map are rebuilt after every non-empty drain.
+template <class T>
+class AppendBuffer
+{
+private:
+    struct Chunk
+    {
+        T *items;
+        SequenceIndex count;
+        Chunk *next;
+
+        Chunk(const SequenceIndex capacity) : items(new T[capacity]), count(0), next(nullptr) {}
+        ~Chunk() { delete[] items; }
+    };
+
+    std::atomic<Chunk *> published;
+    const SequenceIndex chunkSize;
+
+    AppendBuffer(const AppendBuffer<T> &other);
+    AppendBuffer<T> &operator=(const AppendBuffer<T> &other);
+
+    void publish(Chunk *chunk);
+    Chunk *takeAll();
+    void restore(Chunk *ordered);
+
+    template <class Target>
+    SequenceIndex drain(Target &target);
+
+public:
+    class Producer
+    {
+    private:
+        AppendBuffer<T> &buffer;
+        Chunk *current;
+
+        Producer(const Producer &other);
+        Producer &operator=(const Producer &other);
+
+    public:
+        Producer(AppendBuffer<T> &buffer);
+        ~Producer();
+
+        void append(const T &item);
+        void flush();
+    };
+
+    AppendBuffer(const SequenceIndex chunkSize = 1024);
+    ~AppendBuffer();
+
+    SequenceIndex getChunkSize() const;
+    bool isEmpty() const;
+
+    template <class Allocator>
+    SequenceIndex drainInto(DynamicArray<T, Allocator> &array);
+    template <class Allocator>
+    SequenceIndex drainInto(ArraySequence<T, Allocator> &sequence);
+};
+
+#include "../impl/appendBuffer.tpp"
@@ -1,49 +1,119 @@
 #pragma once
+#include <functional>
+#include <memory>
 #include "sequence.hpp"
+#include "hashIndex.hpp"
+#include "zoneMap.hpp"
 #include "dynamicArray.hpp"
 
-template <class T>
+template <class T, class Allocator = std::allocator<T>>
 class ArraySequence : public Sequence<T>
 {
 private:
-    DynamicArray<T> array;
+    DynamicArray<T, Allocator> array;
+    std::unique_ptr<ValueIndex<T>> valueIndex;
+    std::unique_ptr<ChunkSummary<T>> summary;
+    mutable SequenceHashCache hashCache;
+
+    void indexAdded(const SequenceIndex start, const SequenceIndex count);
+    void reindex();
+
+protected:
+    SequenceHashCache *getHashCache() const override;
 
 public:
     ArraySequence();
-    ArraySequence(const T *items, int count);
-    ArraySequence(const int count);
-    ArraySequence(const DynamicArray<T> &array);
+    explicit ArraySequence(const Allocator &allocator);
+    ArraySequence(const T *items, SequenceIndex count, const Allocator &allocator = Allocator());
+    ArraySequence(const SequenceIndex count, const Allocator &allocator = Allocator());
+    ArraySequence(const DynamicArray<T, Allocator> &array);
+    ArraySequence(DynamicArray<T, Allocator> &&array);
+    ArraySequence(const ArraySequence<T, Allocator> &other);
+    ArraySequence(ArraySequence<T, Allocator> &&other) noexcept;
     virtual ~ArraySequence() override;
 
+    Allocator getAllocator() const;
+    void swap(ArraySequence<T, Allocator> &other);
+
     T &getFirst() override;
     T &getLast() override;
-    T &get(const int index) override;
+    T &get(const SequenceIndex index) override;
 
     const T &getFirst() const override;
     const T &getLast() const override;
-    const T &get(const int index) const override;
+    const T &get(const SequenceIndex index) const override;
+    /// @brief Forwards straight to the array's tryGet, so calls on the concrete
+    /// type skip the virtual get and inline.
+    SequenceResult<T> tryGet(const SequenceIndex index);
+    SequenceResult<const T> tryGet(const SequenceIndex index) const;
+
+    SequenceIndex getLength() const override;
+    void visitChunks(ChunkVisitor<T> &visitor) const override;
+    const ValueIndex<T> *getValueIndex() const override;
+    const T *getContiguousData() const override;
 
-    int getLength() const override;
+    /// @brief Builds a HashIndex so indexOf, lastIndexOf and contains run in
+    /// O(1). append, prepend, insertAt and set keep it current incrementally;
+    /// range inserts, resizes, sorts and merges rebuild it. Writes made through
+    /// references from get, getFirst, getLast, getData or operator[] bypass it and
+    /// need rebuildIndex.
+    template <class Hash = std::hash<T>, class Equal = std::equal_to<T>>
+    void attachIndex(const Hash &hash = Hash(), const Equal &equal = Equal());
+    void detachIndex();
+    bool hasIndex() const;
+    /// @brief Rebuilds the attached hash index and chunk summary.
+    void rebuildIndex();
+
+    /// @brief Builds a ZoneMap (min/max and a Bloom filter per 4K elements)
+    /// that lets indexOf, lastIndexOf, contains and filterRange skip chunks.
+    /// append extends it and set widens it; other edits rebuild it. Direct
+    /// writes bypass it as they do the hash index.
+    template <class Hash = std::hash<T>>
+    void attachSummary(const Hash &hash = Hash());
+    void detachSummary();
+    bool hasSummary() const;
+
+    /// @brief New sequence of the elements in [low, high], in order.
+    ArraySequence<T, Allocator> *filterRange(const T &low, const T &high) const;
+
+    /// @brief Non-const getData, get, getFirst, getLast and operator[] forget
+    /// the cached hash, so writes through the returned reference stay visible
+    /// to hash() as long as it is not kept across a hash() call.
+    T *getData();
+    const T *getData() const;
 
     void append(const T &item) override;
     void prepend(const T &item) override;
-    void insertAt(const T &item, int index) override;
-    void set(const int index, const T &data) override;
+    void insertAt(const T &item, SequenceIndex index) override;
+    void set(const SequenceIndex index, const T &data) override;
     void concat(const Sequence<T> *other) override;
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count) override;
+    void insertRange(const SequenceIndex index, const Sequence<T> *other) override;
 
-    Sequence<T> *getSubsequence(const int startIndex, const int endIndex) const override;
+    Sequence<T> *getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const override;
     Sequence<T> *appendImmutable(const T &item) const override;
     Sequence<T> *prependImmutable(const T &item) const override;
-    Sequence<T> *insertAtImmutable(const T &item, const int index) const override;
-    Sequence<T> *setImmutable(const int index, const T &data) const override;
+    Sequence<T> *insertAtImmutable(const T &item, const SequenceIndex index) const override;
+    Sequence<T> *setImmutable(const SequenceIndex index, const T &data) const override;
     Sequence<T> *concatImmutable(const Sequence<T> *other) const override;
+    Sequence<T> *clone() const override;
 
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const override;
     void print() const override;
 
+    void resize(const SequenceIndex newSize);
     void clear();
-    ArraySequence<T> &operator=(const ArraySequence<T> &other);
-    T &operator[](const int index);
-    const T &operator[](const int index) const;
+
+    template <class Compare = std::less<T>>
+    void sort(Compare compare = Compare(), const int threads = 1);
+    template <class Compare = std::less<T>>
+    void stableSort(Compare compare = Compare(), const int threads = 1);
+    template <class Compare = std::less<T>>
+    void merge(const ArraySequence<T, Allocator> &other, Compare compare = Compare());
+    ArraySequence<T, Allocator> &operator=(const ArraySequence<T, Allocator> &other);
+    ArraySequence<T, Allocator> &operator=(ArraySequence<T, Allocator> &&other);
+    T &operator[](const SequenceIndex index);
+    const T &operator[](const SequenceIndex index) const;
 };
 
 #include "../impl/arraySequence.tpp"
\ No newline at end of file
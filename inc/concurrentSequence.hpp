@@ -0,0 +1,58 @@
+#pragma once
+#include <mutex>
+#include <shared_mutex>
+#include "sequence.hpp"
+
+/// @brief Thread-safe wrapper that owns any Sequence<T>.
+/// Readers share a reader-writer lock, mutations take it exclusively. Accessors
+/// return copies because a reference would outlive the lock; batch operations
+/// (appendAll, withLock) let writers pay for one acquisition per batch.
+/// C++14 has no std::shared_mutex, so std::shared_timed_mutex is used.
+template <class T>
+class ConcurrentSequence
+{
+private:
+    typedef std::shared_timed_mutex Mutex;
+    typedef std::shared_lock<Mutex> ReadLock;
+    typedef std::unique_lock<Mutex> WriteLock;
+
+    Sequence<T> *sequence;
+    mutable Mutex mutex;
+
+    ConcurrentSequence(const ConcurrentSequence<T> &other);
+    ConcurrentSequence<T> &operator=(const ConcurrentSequence<T> &other);
+
+public:
+    ConcurrentSequence(Sequence<T> *sequence);
+    ~ConcurrentSequence();
+
+    T getFirst() const;
+    T getLast() const;
+    T get(const SequenceIndex index) const;
+    SequenceIndex getLength() const;
+
+    void append(const T &item);
+    void prepend(const T &item);
+    void insertAt(const T &item, const SequenceIndex index);
+    void set(const SequenceIndex index, const T &data);
+    void concat(const Sequence<T> *other);
+
+    void appendAll(const T *items, const SequenceIndex count);
+    void appendAll(const Sequence<T> &items);
+
+    template <class Function>
+    auto withLock(Function function) -> decltype(function(*sequence))
+    {
+        WriteLock lock(mutex);
+        return function(*sequence);
+    }
+
+    template <class Function>
+    auto withSharedLock(Function function) const -> decltype(function(static_cast<const Sequence<T> &>(*sequence)))
+    {
+        ReadLock lock(mutex);
+        return function(static_cast<const Sequence<T> &>(*sequence));
+    }
+};
+
+#include "../impl/concurrentSequence.tpp"
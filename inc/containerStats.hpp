@@ -0,0 +1,104 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/// @brief Plain copy of the counters of one container type.
+struct StatsSnapshot
+{
+    unsigned long long allocations;
+    unsigned long long frees;
+    unsigned long long bytesAllocated;
+    unsigned long long bytesCopied;
+    unsigned long long reallocations;
+    unsigned long long elementCopies;
+    unsigned long long elementMoves;
+    unsigned long long traversalSteps;
+
+    StatsSnapshot();
+};
+
+/// @brief Counters shared by every instance of one container type. They are
+/// only touched when the build defines SEQUENCE_STATS (cmake -DENABLE_STATS=ON);
+/// otherwise the recording macros below expand to nothing.
+class ContainerStats
+{
+public:
+    std::atomic<unsigned long long> allocations;
+    std::atomic<unsigned long long> frees;
+    std::atomic<unsigned long long> bytesAllocated;
+    std::atomic<unsigned long long> bytesCopied;
+    std::atomic<unsigned long long> reallocations;
+    std::atomic<unsigned long long> elementCopies;
+    std::atomic<unsigned long long> elementMoves;
+    std::atomic<unsigned long long> traversalSteps;
+
+    ContainerStats();
+
+    void add(std::atomic<unsigned long long> &counter, const unsigned long long amount);
+    void recordAllocation(const std::size_t bytes);
+    void recordFree();
+    void recordCopies(const std::size_t count, const std::size_t bytes);
+
+    StatsSnapshot snapshot() const;
+    void reset();
+
+private:
+    ContainerStats(const ContainerStats &other);
+    ContainerStats &operator=(const ContainerStats &other);
+};
+
+class StatsRegistry
+{
+private:
+    struct Entry
+    {
+        std::string name;
+        ContainerStats *stats;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<Entry> entries;
+
+    StatsRegistry();
+
+public:
+    static StatsRegistry &instance();
+
+    void add(const std::string &name, ContainerStats *stats);
+    void reset();
+    void writeJson(std::ostream &out) const;
+};
+
+template <class Container>
+std::string statsName();
+
+template <class Container>
+ContainerStats &statsFor();
+
+template <class Container>
+StatsSnapshot snapshotStats();
+
+template <class Container>
+void resetStats();
+
+inline void resetAllStats();
+inline void writeStatsJson(std::ostream &out);
+
+#ifdef SEQUENCE_STATS
+#define SEQUENCE_STATS_ADD(Container, counter, amount) \
+    statsFor<Container>().add(statsFor<Container>().counter, static_cast<unsigned long long>(amount))
+#define SEQUENCE_STATS_ALLOCATE(Container, bytes) statsFor<Container>().recordAllocation(bytes)
+#define SEQUENCE_STATS_FREE(Container) statsFor<Container>().recordFree()
+#define SEQUENCE_STATS_COPY(Container, count, bytes) statsFor<Container>().recordCopies(count, bytes)
+#else
+#define SEQUENCE_STATS_ADD(Container, counter, amount) ((void)0)
+#define SEQUENCE_STATS_ALLOCATE(Container, bytes) ((void)0)
+#define SEQUENCE_STATS_FREE(Container) ((void)0)
+#define SEQUENCE_STATS_COPY(Container, count, bytes) ((void)0)
+#endif
+
+#include "../impl/containerStats.tpp"
@@ -0,0 +1,74 @@
+#pragma once
+#include <memory>
+#include "sequence.hpp"
+#include "doublyLinkedList.hpp"
+
+/// @brief Sequence over DoublyLinkedList: O(1) work at both ends and indexed
+/// access that walks from whichever end is closer.
+template <class T, class Allocator = std::allocator<T>>
+class DListSequence : public Sequence<T>
+{
+private:
+    DoublyLinkedList<T, Allocator> list;
+
+public:
+    typename DoublyLinkedList<T, Allocator>::ConstIterator begin() const { return list.begin(); };
+    typename DoublyLinkedList<T, Allocator>::ConstIterator end() const { return list.end(); };
+    typename DoublyLinkedList<T, Allocator>::ConstReverseIterator rbegin() const { return list.rbegin(); };
+    typename DoublyLinkedList<T, Allocator>::ConstReverseIterator rend() const { return list.rend(); };
+
+    DListSequence();
+    explicit DListSequence(const Allocator &allocator);
+    DListSequence(const T *items, const SequenceIndex count, const Allocator &allocator = Allocator());
+    DListSequence(const SequenceIndex count, const Allocator &allocator = Allocator());
+    DListSequence(const DoublyLinkedList<T, Allocator> &list);
+    DListSequence(DoublyLinkedList<T, Allocator> &&list);
+    DListSequence(const DListSequence<T, Allocator> &other);
+    DListSequence(DListSequence<T, Allocator> &&other) noexcept;
+    virtual ~DListSequence() override;
+
+    Allocator getAllocator() const;
+    void swap(DListSequence<T, Allocator> &other);
+
+    T &getFirst() override;
+    T &getLast() override;
+    T &get(const SequenceIndex index) override;
+
+    const T &getFirst() const override;
+    const T &getLast() const override;
+    const T &get(const SequenceIndex index) const override;
+
+    SequenceIndex getLength() const override;
+    void visitChunks(ChunkVisitor<T> &visitor) const override;
+
+    void append(const T &item) override;
+    void prepend(const T &item) override;
+    void insertAt(const T &item, SequenceIndex index) override;
+    void set(const SequenceIndex index, const T &data) override;
+    void concat(const Sequence<T> *other) override;
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count) override;
+    void insertRange(const SequenceIndex index, const Sequence<T> *other) override;
+
+    Sequence<T> *getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const override;
+    Sequence<T> *appendImmutable(const T &item) const override;
+    Sequence<T> *prependImmutable(const T &item) const override;
+    Sequence<T> *insertAtImmutable(const T &item, SequenceIndex index) const override;
+    Sequence<T> *setImmutable(const SequenceIndex index, const T &data) const override;
+    Sequence<T> *concatImmutable(const Sequence<T> *other) const override;
+    Sequence<T> *clone() const override;
+
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const override;
+    void print() const override;
+
+    void removeFirst();
+    void removeLast();
+    void removeAt(const SequenceIndex index);
+
+    void clear();
+    void reverse();
+
+    DListSequence<T, Allocator> &operator=(const DListSequence<T, Allocator> &other);
+    DListSequence<T, Allocator> &operator=(DListSequence<T, Allocator> &&other);
+};
+
+#include "../impl/dListSequence.tpp"
\ No newline at end of file
@@ -0,0 +1,168 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include "containerStats.hpp"
+#include "sequenceIndex.hpp"
+#include "sequenceFormat.hpp"
+
+/// @brief Doubly linked list with head and tail pointers: both ends are O(1),
+/// iterators move in both directions and get/set walk from the nearer end.
+template <typename T, class Allocator = std::allocator<T>>
+class DoublyLinkedList
+{
+private:
+    struct Node
+    {
+        T value;
+        Node *prev;
+        Node *next;
+        Node(const T &value) : value(value), prev(nullptr), next(nullptr) {}
+    };
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+    NodeAllocator allocator;
+    Node *head;
+    Node *tail;
+    SequenceIndex length;
+
+    Node *createNode(const T &value);
+    void destroyNode(Node *node);
+    Node *nodeAt(const SequenceIndex index) const;
+    void linkBefore(Node *position, Node *node);
+    void unlink(Node *node);
+    void copyNodes(const DoublyLinkedList<T, Allocator> &list);
+    void checkAllocator(const DoublyLinkedList<T, Allocator> &other) const;
+
+public:
+    /// @brief Iterator section
+    class Iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T *pointer;
+        typedef T &reference;
+
+        Node *current;
+        const DoublyLinkedList<T, Allocator> *owner;
+
+        Iterator(Node *nodePtr, const DoublyLinkedList<T, Allocator> *owner);
+        Iterator &operator++();
+        Iterator operator++(int);
+        Iterator &operator--();
+        Iterator operator--(int);
+        T &operator*() const;
+        T *operator->() const;
+        bool operator!=(const Iterator &other) const;
+        bool operator==(const Iterator &other) const;
+        bool notEnd() const;
+    };
+
+    /// @brief ConstIterator section
+    class ConstIterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        const Node *current;
+        const DoublyLinkedList<T, Allocator> *owner;
+
+        ConstIterator(const Node *nodePtr, const DoublyLinkedList<T, Allocator> *owner);
+        ConstIterator(const Iterator &other);
+        ConstIterator &operator++();
+        ConstIterator operator++(int);
+        ConstIterator &operator--();
+        ConstIterator operator--(int);
+        const T &operator*() const;
+        const T *operator->() const;
+        bool operator!=(const ConstIterator &other) const;
+        bool operator==(const ConstIterator &other) const;
+        bool notEnd() const;
+    };
+
+    typedef std::reverse_iterator<Iterator> ReverseIterator;
+    typedef std::reverse_iterator<ConstIterator> ConstReverseIterator;
+
+    Iterator begin() { return Iterator(head, this); };
+    Iterator end() { return Iterator(nullptr, this); };
+
+    ConstIterator begin() const { return ConstIterator(head, this); };
+    ConstIterator end() const { return ConstIterator(nullptr, this); };
+
+    ReverseIterator rbegin() { return ReverseIterator(end()); };
+    ReverseIterator rend() { return ReverseIterator(begin()); };
+
+    ConstReverseIterator rbegin() const { return ConstReverseIterator(end()); };
+    ConstReverseIterator rend() const { return ConstReverseIterator(begin()); };
+
+public:
+    typedef Allocator allocator_type;
+
+    DoublyLinkedList();
+    explicit DoublyLinkedList(const Allocator &allocator);
+    DoublyLinkedList(const SequenceIndex count, const Allocator &allocator = Allocator());
+    DoublyLinkedList(const T *items, const SequenceIndex count, const Allocator &allocator = Allocator());
+    DoublyLinkedList(const DoublyLinkedList<T, Allocator> &list);
+    DoublyLinkedList(const DoublyLinkedList<T, Allocator> &list, const Allocator &allocator);
+    DoublyLinkedList(DoublyLinkedList<T, Allocator> &&list) noexcept;
+    ~DoublyLinkedList();
+
+    Allocator getAllocator() const;
+    void swap(DoublyLinkedList<T, Allocator> &other);
+
+    const T &getFirst() const;
+    const T &getLast() const;
+    const T &get(const SequenceIndex index) const;
+
+    T &getFirst();
+    T &getLast();
+    T &get(const SequenceIndex index);
+
+    SequenceIndex getLength() const;
+
+    void append(const T &item);
+    void prepend(const T &item);
+    void removeFirst();
+    void removeLast();
+    void removeAt(const SequenceIndex index);
+    void set(const SequenceIndex index, const T &value);
+    void insertAt(const T &value, const SequenceIndex index);
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count);
+    void appendRange(const T *items, const SequenceIndex count);
+    void prependRange(const T *items, const SequenceIndex count);
+    void splice(const SequenceIndex index, DoublyLinkedList<T, Allocator> &other);
+
+    /// @brief Inserts before position (end() appends) and returns an iterator to the new element.
+    Iterator insert(Iterator position, const T &value);
+    /// @brief Removes the element at position in O(1) and returns the iterator after it.
+    Iterator erase(Iterator position);
+
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const;
+    void print() const;
+    void clear();
+    void reverse();
+
+    void concat(const DoublyLinkedList<T, Allocator> &list);
+    DoublyLinkedList<T, Allocator> *concatImmutable(const DoublyLinkedList<T, Allocator> &list) const;
+    DoublyLinkedList<T, Allocator> *getSubList(const SequenceIndex startIndex, const SequenceIndex endIndex) const;
+
+    DoublyLinkedList<T, Allocator> &operator=(const DoublyLinkedList<T, Allocator> &other);
+    DoublyLinkedList<T, Allocator> &operator=(DoublyLinkedList<T, Allocator> &&other);
+};
+
+template <typename T, class Allocator>
+std::ostream &operator<<(std::ostream &out, const DoublyLinkedList<T, Allocator> &list);
+
+template <typename T, class Allocator>
+void swap(DoublyLinkedList<T, Allocator> &first, DoublyLinkedList<T, Allocator> &second);
+
+#include "../impl/doublyLinkedList.tpp"
@@ -1,45 +1,99 @@
 #pragma once
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include "containerStats.hpp"
+#include "sequenceError.hpp"
+#include "sequenceIndex.hpp"
+#include "sequenceFormat.hpp"
+#include "sorting.hpp"
 
-template <typename T>
+/// @brief Growable array. Storage comes from Allocator through
+/// std::allocator_traits, and copy, move and swap follow the allocator's
+/// propagation traits the way standard containers do.
+template <typename T, class Allocator = std::allocator<T>>
 class DynamicArray
 {
 private:
+    typedef std::allocator_traits<Allocator> AllocatorTraits;
+
+    Allocator allocator;
     T *data;
-    int size;
-    int capacity;
+    SequenceIndex size;
+    SequenceIndex capacity;
+
+    T *allocate(const SequenceIndex count);
+    void release(T *items, const SequenceIndex count);
 
 public:
+    typedef Allocator allocator_type;
+
     DynamicArray();
-    DynamicArray(const int size);
-    DynamicArray(const T *items, const int count);
-    DynamicArray(const DynamicArray<T> &dynamicArray);
+    explicit DynamicArray(const Allocator &allocator);
+    DynamicArray(const SequenceIndex size, const Allocator &allocator = Allocator());
+    DynamicArray(const T *items, const SequenceIndex count, const Allocator &allocator = Allocator());
+    DynamicArray(const DynamicArray<T, Allocator> &dynamicArray);
+    DynamicArray(const DynamicArray<T, Allocator> &dynamicArray, const Allocator &allocator);
+    DynamicArray(DynamicArray<T, Allocator> &&dynamicArray) noexcept;
     ~DynamicArray();
 
+    Allocator getAllocator() const;
+    void swap(DynamicArray<T, Allocator> &other);
+
     T &getFirst();
     T &getLast();
-    T &get(const int index);
+    T &get(const SequenceIndex index);
 
     const T &getFirst() const;
     const T &getLast() const;
-    const T &get(const int index) const;
+    const T &get(const SequenceIndex index) const;
 
-    int getSize() const;
+    SequenceIndex getSize() const;
+    SequenceIndex getCapacity() const;
+
+    T *getData();
+    const T *getData() const;
 
     void append(const T &item);
     void prepend(const T &item);
-    void set(const int index, const T &value);
-    void insertAt(const T &item, const int index);
-    void resize(const int newSize);
+    void set(const SequenceIndex index, const T &value);
+    void insertAt(const T &item, const SequenceIndex index);
+    /// @brief get, set and insertAt that report a bad index through the
+    /// result instead of throwing std::out_of_range.
+    SequenceResult<T> tryGet(const SequenceIndex index);
+    SequenceResult<const T> tryGet(const SequenceIndex index) const;
+    SequenceStatus trySet(const SequenceIndex index, const T &value);
+    SequenceStatus tryInsertAt(const T &item, const SequenceIndex index);
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count);
+    void appendRange(const T *items, const SequenceIndex count);
+    void prependRange(const T *items, const SequenceIndex count);
+    void resize(const SequenceIndex newSize);
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const;
     void print() const;
     void clear();
 
-    void concat(DynamicArray<T> *dynamicArray);
-    DynamicArray<T> *concatImmutable(DynamicArray<T> *dynamicArray);
-    DynamicArray<T> *getSubArray(const int startIndex, const int endIndex);
+    template <class Compare = std::less<T>>
+    void sort(Compare compare = Compare(), const int threads = 1);
+    template <class Compare = std::less<T>>
+    void stableSort(Compare compare = Compare(), const int threads = 1);
+    template <class Compare = std::less<T>>
+    void merge(const DynamicArray<T, Allocator> &other, Compare compare = Compare());
+
+    void concat(DynamicArray<T, Allocator> *dynamicArray);
+    DynamicArray<T, Allocator> *concatImmutable(DynamicArray<T, Allocator> *dynamicArray);
+    DynamicArray<T, Allocator> *getSubArray(const SequenceIndex startIndex, const SequenceIndex endIndex);
 
-    T &operator[](int index);
-    const T &operator[](int index) const;
-    DynamicArray<T> &operator=(const DynamicArray<T> &other);
+    T &operator[](SequenceIndex index);
+    const T &operator[](SequenceIndex index) const;
+    DynamicArray<T, Allocator> &operator=(const DynamicArray<T, Allocator> &other);
+    DynamicArray<T, Allocator> &operator=(DynamicArray<T, Allocator> &&other);
 };
 
+template <typename T, class Allocator>
+std::ostream &operator<<(std::ostream &out, const DynamicArray<T, Allocator> &dynamicArray);
+
+template <typename T, class Allocator>
+void swap(DynamicArray<T, Allocator> &first, DynamicArray<T, Allocator> &second);
+
 #include "../impl/dynamicArray.tpp"
\ No newline at end of file
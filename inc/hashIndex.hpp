@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include "sequence.hpp"
+#include "dynamicArray.hpp"
+
+/// @brief Open-addressing hash table from value to {first, last, count} of
+/// its positions. Linear probing over a power-of-two table kept at most half
+/// full; removed keys leave tombstones that are dropped on the next rehash.
+/// Positions are stored relative to an origin so a shift from 0 (prepend) is
+/// O(1); a shift from the middle rewrites every slot.
+template <class T, class Hash = std::hash<T>, class Equal = std::equal_to<T>>
+class HashIndex : public ValueIndex<T>
+{
+private:
+    enum SlotState : unsigned char
+    {
+        Empty,
+        Full,
+        Removed
+    };
+
+    struct Slot
+    {
+        T key;
+        SequenceIndex first;
+        SequenceIndex last;
+        SequenceIndex count;
+        SlotState state;
+        Slot() : key(), first(0), last(0), count(0), state(Empty) {}
+    };
+
+    class Scanner;
+
+    static const SequenceIndex MIN_CAPACITY = 16;
+
+    DynamicArray<Slot> slots;
+    int bits;
+    SequenceIndex used;
+    SequenceIndex removed;
+    SequenceIndex origin;
+    Hash hash;
+    Equal equal;
+
+    std::size_t home(const T &value) const;
+    SequenceIndex locate(const T &value) const;
+    void reserveSlot();
+    void rehash(const SequenceIndex capacity);
+
+public:
+    HashIndex(const Hash &hash = Hash(), const Equal &equal = Equal());
+
+    ValueIndex<T> *clone() const override;
+
+    void rebuild(const Sequence<T> &source) override;
+    void add(const T &value, const SequenceIndex position) override;
+    void remove(const T &value, const SequenceIndex position, const Sequence<T> &source) override;
+    void shift(const SequenceIndex from, const SequenceIndex delta) override;
+
+    SequenceIndex first(const T &value) const override;
+    SequenceIndex last(const T &value) const override;
+    SequenceIndex count(const T &value) const override;
+
+    /// @brief Number of distinct values recorded.
+    SequenceIndex getDistinct() const;
+    SequenceIndex getCapacity() const;
+    void clear();
+};
+
+#include "../impl/hashIndex.tpp"
@@ -1,6 +1,16 @@
 #pragma once
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include "containerStats.hpp"
+#include "sequenceError.hpp"
+#include "sequenceIndex.hpp"
+#include "sequenceFormat.hpp"
 
-template <typename T>
+/// @brief Singly linked list. Nodes are allocated from Allocator rebound to
+/// the node type; copy, move and swap follow the allocator's propagation traits.
+template <typename T, class Allocator = std::allocator<T>>
 class LinkedList
 {
 private:
@@ -10,8 +20,23 @@ private:
         Node *next;
         Node(const T &value) : value(value), next(nullptr) {}
     };
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+    NodeAllocator allocator;
     Node *head;
-    int length;
+    SequenceIndex length;
+
+    Node *createNode(const T &value);
+    void destroyNode(Node *node);
+    Node **linkAt(const SequenceIndex index);
+    void copyNodes(const LinkedList<T, Allocator> &list);
+    void checkAllocator(const LinkedList<T, Allocator> &other) const;
+
+    template <class Compare>
+    static Node *runEnd(Node *node, Compare compare);
+    template <class Compare>
+    static Node **mergeNodes(Node *first, Node *second, Node **tail, Compare compare);
 
 public:
     /// @brief Iterator section
@@ -53,35 +78,67 @@ public:
     ConstIterator end() const { return ConstIterator(nullptr); };
 
 public:
+    typedef Allocator allocator_type;
+
     LinkedList();
-    LinkedList(const int count);
-    LinkedList(const T *items, const int count);
-    LinkedList(const LinkedList<T> &list);
+    explicit LinkedList(const Allocator &allocator);
+    LinkedList(const SequenceIndex count, const Allocator &allocator = Allocator());
+    LinkedList(const T *items, const SequenceIndex count, const Allocator &allocator = Allocator());
+    LinkedList(const LinkedList<T, Allocator> &list);
+    LinkedList(const LinkedList<T, Allocator> &list, const Allocator &allocator);
+    LinkedList(LinkedList<T, Allocator> &&list) noexcept;
     ~LinkedList();
 
+    Allocator getAllocator() const;
+    void swap(LinkedList<T, Allocator> &other);
+
     const T &getFirst() const;
     const T &getLast() const;
-    const T &get(const int index) const;
+    const T &get(const SequenceIndex index) const;
 
     T &getFirst();
     T &getLast();
-    T &get(const int index);
+    T &get(const SequenceIndex index);
 
-    int getLength() const;
+    SequenceIndex getLength() const;
 
     void append(const T &item);
     void prepend(const T &item);
-    void set(int index, const T &value);
-    void insertAt(const T &value, const int index);
+    void set(SequenceIndex index, const T &value);
+    void insertAt(const T &value, const SequenceIndex index);
+    /// @brief get, set and insertAt that report a bad index through the
+    /// result instead of throwing std::out_of_range.
+    SequenceResult<T> tryGet(const SequenceIndex index);
+    SequenceResult<const T> tryGet(const SequenceIndex index) const;
+    SequenceStatus trySet(const SequenceIndex index, const T &value);
+    SequenceStatus tryInsertAt(const T &value, const SequenceIndex index);
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count);
+    void appendRange(const T *items, const SequenceIndex count);
+    void prependRange(const T *items, const SequenceIndex count);
+    void splice(const SequenceIndex index, LinkedList<T, Allocator> &other);
 
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const;
     void print() const;
     void clear();
+    void reverse();
+
+    template <class Compare = std::less<T>>
+    void sort(Compare compare = Compare());
+    template <class Compare = std::less<T>>
+    void merge(LinkedList<T, Allocator> &other, Compare compare = Compare());
 
-    void concat(const LinkedList<T> &list);
-    LinkedList<T> *concatImmutable(const LinkedList<T> &list) const;
-    LinkedList<T> *getSubList(const int startIndex, const int endIndex) const;
+    void concat(const LinkedList<T, Allocator> &list);
+    LinkedList<T, Allocator> *concatImmutable(const LinkedList<T, Allocator> &list) const;
+    LinkedList<T, Allocator> *getSubList(const SequenceIndex startIndex, const SequenceIndex endIndex) const;
 
-    LinkedList<T> &operator=(const LinkedList<T> &other);
+    LinkedList<T, Allocator> &operator=(const LinkedList<T, Allocator> &other);
+    LinkedList<T, Allocator> &operator=(LinkedList<T, Allocator> &&other);
 };
 
+template <typename T, class Allocator>
+std::ostream &operator<<(std::ostream &out, const LinkedList<T, Allocator> &list);
+
+template <typename T, class Allocator>
+void swap(LinkedList<T, Allocator> &first, LinkedList<T, Allocator> &second);
+
 #include "../impl/linkedList.tpp"
\ No newline at end of file
@@ -1,47 +1,98 @@
 #pragma once
+#include <functional>
+#include <memory>
 #include "sequence.hpp"
+#include "hashIndex.hpp"
 #include "linkedList.hpp"
 
-template <class T>
+template <class T, class Allocator = std::allocator<T>>
 class ListSequence : public Sequence<T>
 {
 private:
-    LinkedList<T> list;
+    LinkedList<T, Allocator> list;
+    std::unique_ptr<ValueIndex<T>> valueIndex;
+    mutable SequenceHashCache hashCache;
+
+    void indexAdded(const SequenceIndex start, const SequenceIndex count);
+    void reindex();
+
+protected:
+    SequenceHashCache *getHashCache() const override;
 
 public:
+    typename LinkedList<T, Allocator>::ConstIterator begin() const { return list.begin(); };
+    typename LinkedList<T, Allocator>::ConstIterator end() const { return list.end(); };
+
     ListSequence();
-    ListSequence(const T *items, const int count);
-    ListSequence(const int count);
-    ListSequence(const LinkedList<T> &list);
+    explicit ListSequence(const Allocator &allocator);
+    ListSequence(const T *items, const SequenceIndex count, const Allocator &allocator = Allocator());
+    ListSequence(const SequenceIndex count, const Allocator &allocator = Allocator());
+    ListSequence(const LinkedList<T, Allocator> &list);
+    ListSequence(LinkedList<T, Allocator> &&list);
+    ListSequence(const ListSequence<T, Allocator> &other);
+    ListSequence(ListSequence<T, Allocator> &&other) noexcept;
     virtual ~ListSequence() override;
 
+    Allocator getAllocator() const;
+    void swap(ListSequence<T, Allocator> &other);
+
     T &getFirst() override;
     T &getLast() override;
-    T &get(const int index) override;
+    T &get(const SequenceIndex index) override;
 
     const T &getFirst() const override;
     const T &getLast() const override;
-    const T &get(const int index) const override;
+    const T &get(const SequenceIndex index) const override;
+    /// @brief Forwards straight to the list's tryGet, so calls on the concrete
+    /// type skip the virtual get and inline.
+    SequenceResult<T> tryGet(const SequenceIndex index);
+    SequenceResult<const T> tryGet(const SequenceIndex index) const;
+
+    SequenceIndex getLength() const override;
+    void visitChunks(ChunkVisitor<T> &visitor) const override;
+    const ValueIndex<T> *getValueIndex() const override;
+    /// @brief Walks both node chains in lockstep when other is a ListSequence too.
+    int compareElements(const Sequence<T> &other, typename Sequence<T>::ElementOrder order) const override;
 
-    int getLength() const override;
+    /// @brief Builds a HashIndex so indexOf, lastIndexOf and contains run in
+    /// O(1). append, prepend, insertAt and set keep it current incrementally;
+    /// range inserts, resizes, sorts and merges rebuild it. Writes made through
+    /// references from get, getFirst or getLast bypass it and need
+    /// rebuildIndex.
+    template <class Hash = std::hash<T>, class Equal = std::equal_to<T>>
+    void attachIndex(const Hash &hash = Hash(), const Equal &equal = Equal());
+    void detachIndex();
+    bool hasIndex() const;
+    void rebuildIndex();
 
     void append(const T &item) override;
     void prepend(const T &item) override;
-    void insertAt(const T &item, int index) override;
-    void set(const int index, const T &data) override;
+    void insertAt(const T &item, SequenceIndex index) override;
+    void set(const SequenceIndex index, const T &data) override;
     void concat(const Sequence<T> *other) override;
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count) override;
+    void insertRange(const SequenceIndex index, const Sequence<T> *other) override;
 
-    Sequence<T> *getSubsequence(const int startIndex, const int endIndex) const override;
+    Sequence<T> *getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const override;
     Sequence<T> *appendImmutable(const T &item) const override;
     Sequence<T> *prependImmutable(const T &item) const override;
-    Sequence<T> *insertAtImmutable(const T &item, int index) const override;
-    Sequence<T> *setImmutable(const int index, const T &data) const override;
+    Sequence<T> *insertAtImmutable(const T &item, SequenceIndex index) const override;
+    Sequence<T> *setImmutable(const SequenceIndex index, const T &data) const override;
     Sequence<T> *concatImmutable(const Sequence<T> *other) const override;
+    Sequence<T> *clone() const override;
 
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const override;
     void print() const override;
 
     void clear();
-    ListSequence<T> &operator=(const ListSequence<T> &other);
+    void reverse();
+
+    template <class Compare = std::less<T>>
+    void sort(Compare compare = Compare());
+    template <class Compare = std::less<T>>
+    void merge(ListSequence<T, Allocator> &other, Compare compare = Compare());
+    ListSequence<T, Allocator> &operator=(const ListSequence<T, Allocator> &other);
+    ListSequence<T, Allocator> &operator=(ListSequence<T, Allocator> &&other);
 };
 
 #include "../impl/listSequence.tpp"
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+#include <string>
+#include "sequence.hpp"
+#include "sequenceIO.hpp"
+
+/// @brief Array sequence backed by a memory-mapped binary sequence file.
+/// Opening is O(1) regardless of file size; pages are loaded on first access.
+/// The mapping is private, so set() never modifies the file, and operations
+/// that change the length throw std::logic_error. Immutable operations
+/// return an ArraySequence copy.
+template <class T>
+class MappedArraySequence : public Sequence<T>
+{
+private:
+    void *mapping;
+    std::size_t mappingSize;
+    T *data;
+    SequenceIndex size;
+
+    MappedArraySequence(const MappedArraySequence<T> &other);
+    MappedArraySequence<T> &operator=(const MappedArraySequence<T> &other);
+
+    ArraySequence<T> *copy() const;
+
+public:
+    MappedArraySequence(const std::string &path);
+    virtual ~MappedArraySequence() override;
+
+    T &getFirst() override;
+    T &getLast() override;
+    T &get(const SequenceIndex index) override;
+
+    const T &getFirst() const override;
+    const T &getLast() const override;
+    const T &get(const SequenceIndex index) const override;
+
+    SequenceIndex getLength() const override;
+    void visitChunks(ChunkVisitor<T> &visitor) const override;
+    const T *getContiguousData() const override;
+    const T *getData() const;
+
+    void append(const T &item) override;
+    void prepend(const T &item) override;
+    void insertAt(const T &item, SequenceIndex index) override;
+    void set(const SequenceIndex index, const T &data) override;
+    void concat(const Sequence<T> *other) override;
+
+    Sequence<T> *getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const override;
+    Sequence<T> *appendImmutable(const T &item) const override;
+    Sequence<T> *prependImmutable(const T &item) const override;
+    Sequence<T> *insertAtImmutable(const T &item, const SequenceIndex index) const override;
+    Sequence<T> *setImmutable(const SequenceIndex index, const T &data) const override;
+    Sequence<T> *concatImmutable(const Sequence<T> *other) const override;
+    Sequence<T> *clone() const override;
+
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const override;
+    void print() const override;
+
+    const T &operator[](const SequenceIndex index) const;
+};
+
+#include "../impl/mappedArraySequence.tpp"
@@ -0,0 +1,125 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "sequence.hpp"
+#include "dynamicArray.hpp"
+
+/// @brief Read-mostly integer sequence stored as blocks of 128 values. Each
+/// sealed block keeps its first value and the deltas between neighbours,
+/// frame-of-reference encoded against the smallest delta and bit-packed at the
+/// narrowest width that fits, so sorted IDs cost a few bits per element.
+/// Appends fill an uncompressed tail that is sealed once it holds a full block.
+/// The const get decodes a whole block on its first read and keeps the decoded
+/// copy until a mutation changes that block, so sequential access is amortized
+/// O(1), references stay valid until the next mutation, and concurrent const
+/// reads are safe. Reading everything therefore holds a decoded copy of every
+/// block read. Writes through the non-const get land in a decoded block that
+/// is re-encoded lazily; prepend and insertAt away from the end re-encode
+/// every block.
+template <class T>
+class PackedIntSequence : public Sequence<T>
+{
+    static_assert(std::is_integral<T>::value && sizeof(T) <= sizeof(std::uint64_t), "PackedIntSequence stores integers of up to 64 bits");
+
+public:
+    static const int BLOCK_SHIFT = 7;
+    static const int BLOCK_SIZE = 1 << BLOCK_SHIFT;
+
+private:
+    struct Block
+    {
+        std::uint64_t first;
+        std::uint64_t minDelta;
+        SequenceIndex offset;
+        int width;
+        Block() : first(0), minDelta(0), offset(0), width(0) {}
+    };
+
+    struct DecodedBlock
+    {
+        SequenceIndex block;
+        bool dirty;
+        T values[BLOCK_SIZE];
+        DecodedBlock() : block(-1), dirty(false), values() {}
+    };
+
+    typedef void (*Unpacker)(const std::uint64_t *packed, std::uint64_t *output);
+
+    DynamicArray<std::uint64_t> words;
+    DynamicArray<Block> blocks;
+    DynamicArray<T> tail;
+    DecodedBlock writeCache;
+    /// Decoded copy of each sealed block, published by the first const read.
+    mutable std::unique_ptr<std::atomic<T *>[]> decoded;
+    SequenceIndex decodedSlots;
+
+    template <std::size_t Width>
+    static void unpack(const std::uint64_t *packed, std::uint64_t *output);
+    template <std::size_t... Width>
+    static const Unpacker *unpackers(std::index_sequence<Width...>);
+    static int bitWidth(const std::uint64_t value);
+    static Block encodeBlock(const T *values, std::uint64_t *packed);
+
+    SequenceIndex getSealedLength() const;
+    void decodeBlock(const SequenceIndex block, T *output) const;
+    const T *decodedBlock(const SequenceIndex block) const;
+    void dropDecoded(const SequenceIndex block);
+    void dropAllDecoded();
+    void growDecoded();
+    void storeBlock(const SequenceIndex block, const T *values);
+    void seal();
+    void flush();
+    void assign(const T *items, const SequenceIndex count);
+    void checkIndex(const SequenceIndex index) const;
+
+public:
+    PackedIntSequence();
+    PackedIntSequence(const T *items, const SequenceIndex count);
+    PackedIntSequence(const SequenceIndex count);
+    PackedIntSequence(const PackedIntSequence<T> &other);
+    virtual ~PackedIntSequence() override;
+
+    T &getFirst() override;
+    T &getLast() override;
+    T &get(const SequenceIndex index) override;
+
+    const T &getFirst() const override;
+    const T &getLast() const override;
+    const T &get(const SequenceIndex index) const override;
+
+    SequenceIndex getLength() const override;
+    void visitChunks(ChunkVisitor<T> &visitor) const override;
+
+    void append(const T &item) override;
+    void prepend(const T &item) override;
+    void insertAt(const T &item, const SequenceIndex index) override;
+    void set(const SequenceIndex index, const T &data) override;
+    void concat(const Sequence<T> *other) override;
+    using Sequence<T>::insertRange;
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count) override;
+
+    Sequence<T> *getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const override;
+    Sequence<T> *appendImmutable(const T &item) const override;
+    Sequence<T> *prependImmutable(const T &item) const override;
+    Sequence<T> *insertAtImmutable(const T &item, const SequenceIndex index) const override;
+    Sequence<T> *setImmutable(const SequenceIndex index, const T &data) const override;
+    Sequence<T> *concatImmutable(const Sequence<T> *other) const override;
+    Sequence<T> *clone() const override;
+
+    void print() const override;
+
+    /// @brief Decodes every element into output, which must hold getLength() values.
+    void decodeTo(T *output) const;
+    /// @brief Bytes held by packed words, block headers and the tail.
+    std::size_t getPackedBytes() const;
+    SequenceIndex getBlockCount() const;
+    void clear();
+
+    PackedIntSequence<T> &operator=(const PackedIntSequence<T> &other);
+};
+
+#include "../impl/packedIntSequence.tpp"
@@ -0,0 +1,115 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include "sequence.hpp"
+#include "dynamicArray.hpp"
+
+/// @brief Linked list whose nodes live in one contiguous DynamicArray pool and
+/// link to each other through 32-bit slot numbers instead of pointers. Slot 0
+/// means "none", so a node is just {value, link}. With XorLinked the link holds
+/// prev ^ next, which gives bidirectional traversal for the same four bytes.
+template <class T, bool XorLinked = false>
+class PoolListSequence : public Sequence<T>
+{
+private:
+    typedef std::uint32_t Slot;
+
+    struct Node
+    {
+        T value;
+        Slot link;
+        Node() : value(), link(0) {}
+    };
+
+    DynamicArray<Node> nodes;
+    Slot head;
+    Slot tail;
+    Slot freeList;
+    SequenceIndex length;
+
+    Node &node(const Slot slot);
+    const Node &node(const Slot slot) const;
+    Slot step(const Slot previous, const Slot current) const;
+    Slot locate(const SequenceIndex index, Slot &before) const;
+    Slot acquire(const T &item);
+    void linkBetween(const Slot before, const Slot after, const Slot slot);
+    void unlink(const Slot before, const Slot slot);
+    void checkIndex(const SequenceIndex index) const;
+
+public:
+    /// @brief ConstIterator section
+    class ConstIterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        const PoolListSequence<T, XorLinked> *owner;
+        Slot previous;
+        Slot current;
+
+        ConstIterator(const PoolListSequence<T, XorLinked> *owner, const Slot previous, const Slot current);
+        ConstIterator &operator++();
+        ConstIterator operator++(int);
+        const T &operator*() const;
+        bool operator!=(const ConstIterator &other) const;
+        bool operator==(const ConstIterator &other) const;
+        bool notEnd() const;
+    };
+
+    ConstIterator begin() const { return ConstIterator(this, 0, head); };
+    ConstIterator end() const { return ConstIterator(this, 0, 0); };
+
+    PoolListSequence();
+    PoolListSequence(const T *items, const SequenceIndex count);
+    PoolListSequence(const SequenceIndex count);
+    PoolListSequence(const PoolListSequence<T, XorLinked> &other);
+    virtual ~PoolListSequence() override;
+
+    T &getFirst() override;
+    T &getLast() override;
+    T &get(const SequenceIndex index) override;
+
+    const T &getFirst() const override;
+    const T &getLast() const override;
+    const T &get(const SequenceIndex index) const override;
+
+    SequenceIndex getLength() const override;
+    void visitChunks(ChunkVisitor<T> &visitor) const override;
+
+    void append(const T &item) override;
+    void prepend(const T &item) override;
+    void insertAt(const T &item, const SequenceIndex index) override;
+    void set(const SequenceIndex index, const T &data) override;
+    void concat(const Sequence<T> *other) override;
+    using Sequence<T>::insertRange;
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count) override;
+
+    Sequence<T> *getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const override;
+    Sequence<T> *appendImmutable(const T &item) const override;
+    Sequence<T> *prependImmutable(const T &item) const override;
+    Sequence<T> *insertAtImmutable(const T &item, const SequenceIndex index) const override;
+    Sequence<T> *setImmutable(const SequenceIndex index, const T &data) const override;
+    Sequence<T> *concatImmutable(const Sequence<T> *other) const override;
+    Sequence<T> *clone() const override;
+
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const override;
+    void print() const override;
+
+    /// @brief Unlinks the element and puts its slot on the free list for reuse.
+    void removeAt(const SequenceIndex index);
+    void clear();
+    /// @brief Rewrites the pool in list order and drops free slots, so a
+    /// traversal becomes a sequential scan of the pool.
+    void compact();
+    /// @brief Bytes held by the pool, including spare capacity.
+    std::size_t getPoolBytes() const;
+
+    PoolListSequence<T, XorLinked> &operator=(const PoolListSequence<T, XorLinked> &other);
+};
+
+#include "../impl/poolListSequence.tpp"
@@ -0,0 +1,103 @@
+#pragma once
+#include <memory>
+#include "sequence.hpp"
+#include "dynamicArray.hpp"
+
+/// @brief Sequence stored as a height-balanced (AVL) tree of leaf chunks.
+/// Nodes are immutable and shared between ropes, so copying, concat and
+/// getSubsequence cost O(log N) and reuse the existing leaf chunks; writing
+/// through get()/set() copies only the nodes on the path to a shared leaf.
+template <class T>
+class RopeSequence : public Sequence<T>
+{
+private:
+    static const int LEAF_CAPACITY = 64;
+
+    struct Node;
+    typedef std::shared_ptr<Node> NodePtr;
+
+    struct Node
+    {
+        std::shared_ptr<DynamicArray<T>> chunk;
+        SequenceIndex offset;
+        SequenceIndex length;
+        int height;
+        NodePtr left;
+        NodePtr right;
+    };
+
+    NodePtr root;
+
+    RopeSequence(const NodePtr &root);
+
+    static int height(const NodePtr &node);
+    static SequenceIndex length(const NodePtr &node);
+    static NodePtr makeLeaf(const std::shared_ptr<DynamicArray<T>> &chunk, const SequenceIndex offset, const SequenceIndex length);
+    static NodePtr makeLeaf(const T *items, const SequenceIndex count);
+    static NodePtr makeNode(const NodePtr &left, const NodePtr &right);
+    static NodePtr build(const T *items, const SequenceIndex count);
+
+    static NodePtr rotateLeft(const NodePtr &node);
+    static NodePtr rotateRight(const NodePtr &node);
+    static NodePtr joinRight(const NodePtr &left, const NodePtr &right);
+    static NodePtr joinLeft(const NodePtr &left, const NodePtr &right);
+    static const Node *edgeLeaf(const Node *node, const bool atEnd);
+    static NodePtr absorb(const NodePtr &node, const NodePtr &leaf, const bool atEnd);
+    static NodePtr join(const NodePtr &left, const NodePtr &right);
+    static void split(const NodePtr &node, const SequenceIndex index, NodePtr &left, NodePtr &right);
+
+    /// Calls visitor(items, count) for each leaf in order until it returns
+    /// false; returns false if the walk was stopped.
+    template <class Visitor>
+    static bool forEachLeaf(const Node *node, Visitor &visitor);
+
+    const T &at(const SequenceIndex index) const;
+    T &mutableAt(const SequenceIndex index);
+
+public:
+    RopeSequence();
+    RopeSequence(const T *items, const SequenceIndex count);
+    RopeSequence(const RopeSequence<T> &other);
+    virtual ~RopeSequence() override;
+
+    T &getFirst() override;
+    T &getLast() override;
+    T &get(const SequenceIndex index) override;
+
+    const T &getFirst() const override;
+    const T &getLast() const override;
+    const T &get(const SequenceIndex index) const override;
+
+    SequenceIndex getLength() const override;
+    void visitChunks(ChunkVisitor<T> &visitor) const override;
+    int getHeight() const;
+
+    void append(const T &item) override;
+    void prepend(const T &item) override;
+    void insertAt(const T &item, SequenceIndex index) override;
+    void set(const SequenceIndex index, const T &data) override;
+    void concat(const Sequence<T> *other) override;
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count) override;
+    void insertRange(const SequenceIndex index, const Sequence<T> *other) override;
+
+    Sequence<T> *getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const override;
+    Sequence<T> *appendImmutable(const T &item) const override;
+    Sequence<T> *prependImmutable(const T &item) const override;
+    Sequence<T> *insertAtImmutable(const T &item, const SequenceIndex index) const override;
+    Sequence<T> *setImmutable(const SequenceIndex index, const T &data) const override;
+    Sequence<T> *concatImmutable(const Sequence<T> *other) const override;
+    Sequence<T> *clone() const override;
+
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const override;
+    void print() const override;
+
+    /// @brief Copies the elements into one contiguous array.
+    DynamicArray<T> *flatten() const;
+    void clear();
+
+    RopeSequence<T> &operator=(const RopeSequence<T> &other);
+    T &operator[](const SequenceIndex index);
+    const T &operator[](const SequenceIndex index) const;
+};
+
+#include "../impl/ropeSequence.tpp"
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "containerStats.hpp"
+#include "sequence.hpp"
+
+/// @brief Array sequence stored in power-of-two sized blocks.
+/// Block k holds (BASE << k) elements, so appending only ever allocates a new
+/// block and never moves existing elements: references returned by get()
+/// stay valid until the element is shifted by prepend/insertAt or removed.
+template <class T>
+class SegmentedArraySequence : public Sequence<T>
+{
+private:
+    static const int BASE_SHIFT = 3;
+    static const int BASE = 1 << BASE_SHIFT;
+    static const int MAX_BLOCKS = 63 - BASE_SHIFT;
+
+    T *blocks[MAX_BLOCKS];
+    int blockCount;
+    SequenceIndex size;
+
+    static int highestBit(std::uint64_t value);
+    static SequenceIndex blockSize(const int block);
+    T &at(const SequenceIndex index);
+    const T &at(const SequenceIndex index) const;
+    void grow();
+    void copyFrom(const SegmentedArraySequence<T> &other);
+
+public:
+    SegmentedArraySequence();
+    SegmentedArraySequence(const T *items, const SequenceIndex count);
+    SegmentedArraySequence(const SequenceIndex count);
+    SegmentedArraySequence(const SegmentedArraySequence<T> &other);
+    virtual ~SegmentedArraySequence() override;
+
+    T &getFirst() override;
+    T &getLast() override;
+    T &get(const SequenceIndex index) override;
+
+    const T &getFirst() const override;
+    const T &getLast() const override;
+    const T &get(const SequenceIndex index) const override;
+
+    SequenceIndex getLength() const override;
+    void visitChunks(ChunkVisitor<T> &visitor) const override;
+    SequenceIndex getCapacity() const;
+    int getBlockCount() const;
+
+    void append(const T &item) override;
+    void prepend(const T &item) override;
+    void insertAt(const T &item, SequenceIndex index) override;
+    void set(const SequenceIndex index, const T &data) override;
+    void concat(const Sequence<T> *other) override;
+    using Sequence<T>::insertRange;
+    void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count) override;
+
+    Sequence<T> *getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const override;
+    Sequence<T> *appendImmutable(const T &item) const override;
+    Sequence<T> *prependImmutable(const T &item) const override;
+    Sequence<T> *insertAtImmutable(const T &item, const SequenceIndex index) const override;
+    Sequence<T> *setImmutable(const SequenceIndex index, const T &data) const override;
+    Sequence<T> *concatImmutable(const Sequence<T> *other) const override;
+    Sequence<T> *clone() const override;
+
+    void print() const override;
+
+    void clear();
+    SegmentedArraySequence<T> &operator=(const SegmentedArraySequence<T> &other);
+    T &operator[](const SequenceIndex index);
+    const T &operator[](const SequenceIndex index) const;
+};
+
+#include "../impl/segmentedArraySequence.tpp"
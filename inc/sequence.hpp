@@ -1,33 +1,218 @@
 #pragma once
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+#include "sequenceError.hpp"
+#include "sequenceFormat.hpp"
+#include "sequenceIndex.hpp"
+
+template <class T>
+class Sequence;
+
+template <class T>
+class Transient;
+
+/// @brief Receives a sequence's storage as runs of contiguous elements;
+/// returning false stops the walk.
+template <class T>
+class ChunkVisitor
+{
+public:
+    virtual ~ChunkVisitor() = default;
+    virtual bool visit(const T *items, const SequenceIndex count, const SequenceIndex offset) = 0;
+    /// @brief Value the visitor is looking for, if any; sequences that keep
+    /// chunk summaries may skip runs that cannot hold it.
+    virtual const T *getProbe() const { return nullptr; }
+};
+
+/// @brief Value-to-position index a sequence keeps up to date as it changes.
+/// first and last return -1 when the value is absent.
+template <class T>
+class ValueIndex
+{
+public:
+    virtual ~ValueIndex() = default;
+    virtual ValueIndex<T> *clone() const = 0;
+
+    virtual void rebuild(const Sequence<T> &source) = 0;
+    /// @brief Records value at position; positions at or after it must already have been shifted.
+    virtual void add(const T &value, const SequenceIndex position) = 0;
+    /// @brief Forgets value at position; source is rescanned if it held the value's first or last occurrence.
+    virtual void remove(const T &value, const SequenceIndex position, const Sequence<T> &source) = 0;
+    /// @brief Moves every recorded position at or after from by delta.
+    virtual void shift(const SequenceIndex from, const SequenceIndex delta) = 0;
+
+    virtual SequenceIndex first(const T &value) const = 0;
+    virtual SequenceIndex last(const T &value) const = 0;
+    virtual SequenceIndex count(const T &value) const = 0;
+};
+
+/// @brief Element types whose equality is equality of their bytes, so
+/// contiguous runs compare with memcmp. Specialize for padding-free structs.
+template <class T>
+struct IsBitwiseComparable
+    : std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value>
+{
+};
+
+/// @brief Memoized hash() of a sequence that clears it on every mutation.
+/// The value is published with a release store of valid, so const readers
+/// may fill and read it concurrently; mutations still need exclusive access.
+struct SequenceHashCache
+{
+    std::atomic<std::size_t> value;
+    std::atomic<bool> valid;
+
+    SequenceHashCache() : value(0), valid(false) {}
+    SequenceHashCache(const SequenceHashCache &other) : value(0), valid(false) { *this = other; }
+    SequenceHashCache &operator=(const SequenceHashCache &other)
+    {
+        std::size_t copied;
+        if (other.load(copied))
+        {
+            store(copied);
+        }
+        else
+        {
+            clear();
+        }
+        return *this;
+    }
+
+    bool load(std::size_t &out) const
+    {
+        if (!valid.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        out = value.load(std::memory_order_relaxed);
+        return true;
+    }
+    void store(const std::size_t hash)
+    {
+        value.store(hash, std::memory_order_relaxed);
+        valid.store(true, std::memory_order_release);
+    }
+    void clear() { valid.store(false, std::memory_order_relaxed); }
+};
 
 template <class T>
 class Sequence
 {
+private:
+    static int elementsDiffer(const T &left, const T &right);
+    static int elementOrder(const T &left, const T &right);
+
+protected:
+    /// @brief Cache hash() may fill, or nullptr when the sequence cannot tell
+    /// that it changed.
+    virtual SequenceHashCache *getHashCache() const;
+
 public:
+    /// @brief Negative, zero or positive, like memcmp.
+    typedef int (*ElementOrder)(const T &left, const T &right);
+
     virtual ~Sequence() = default;
 
     virtual T &getFirst() = 0;
     virtual T &getLast() = 0;
-    virtual T &get(const int index) = 0;
+    virtual T &get(const SequenceIndex index) = 0;
 
     virtual const T &getFirst() const = 0;
     virtual const T &getLast() const = 0;
-    virtual const T &get(const int index) const = 0;
+    virtual const T &get(const SequenceIndex index) const = 0;
+
+    /// @brief Non-throwing get, getFirst and getLast: a bad index or an empty
+    /// sequence comes back as the result's status instead of an exception.
+    SequenceResult<T> tryGet(const SequenceIndex index);
+    SequenceResult<const T> tryGet(const SequenceIndex index) const;
+    SequenceResult<T> tryGetFirst();
+    SequenceResult<const T> tryGetFirst() const;
+    SequenceResult<T> tryGetLast();
+    SequenceResult<const T> tryGetLast() const;
 
     virtual void append(const T &item) = 0;
     virtual void prepend(const T &item) = 0;
-    virtual void insertAt(const T &item, const int index) = 0;
-    virtual void set(const int index, const T &data) = 0;
+    virtual void insertAt(const T &item, const SequenceIndex index) = 0;
+    virtual void set(const SequenceIndex index, const T &data) = 0;
     virtual void concat(const Sequence<T> *list) = 0;
+    /// @brief set and insertAt that return SequenceStatus::OutOfRange for a bad index.
+    SequenceStatus trySet(const SequenceIndex index, const T &data);
+    SequenceStatus tryInsertAt(const T &item, const SequenceIndex index);
+
+    /// @brief Inserts count items before index in one pass. The defaults fall
+    /// back to insertAt per element; implementations override them to shift or
+    /// link the whole range at once. A null other inserts nothing, like concat.
+    virtual void insertRange(const SequenceIndex index, const T *items, const SequenceIndex count);
+    virtual void insertRange(const SequenceIndex index, const Sequence<T> *other);
+    void appendRange(const T *items, const SequenceIndex count);
+    void appendRange(const Sequence<T> *other);
+    void prependRange(const T *items, const SequenceIndex count);
+    void prependRange(const Sequence<T> *other);
 
-    virtual int getLength() const = 0;
+    virtual SequenceIndex getLength() const = 0;
 
-    virtual Sequence<T> *getSubsequence(const int startIndex, const int endIndex) const = 0;
+    /// @brief Walks the elements in order as contiguous runs. The default
+    /// hands over one element at a time through get.
+    virtual void visitChunks(ChunkVisitor<T> &visitor) const;
+    /// @brief Index attached to this sequence, or nullptr when lookups scan.
+    virtual const ValueIndex<T> *getValueIndex() const;
+
+    /// @brief Position of the first (last) element equal to value, or -1.
+    SequenceIndex indexOf(const T &value) const;
+    SequenceIndex lastIndexOf(const T &value) const;
+    bool contains(const T &value) const;
+
+    /// @brief Same length and equal elements; lengths are checked first and
+    /// contiguous runs of bitwise-comparable types go through memcmp.
+    bool equals(const Sequence<T> &other) const;
+    /// @brief Lexicographic order by operator<: negative, zero or positive.
+    int compare(const Sequence<T> &other) const;
+    /// @brief Combines std::hash of every element; sequences that track their
+    /// own mutations remember the result until the next change. Safe to call
+    /// from several threads at once while nobody mutates the sequence.
+    std::size_t hash() const;
+
+    /// @brief First non-zero order(mine, theirs) over the common prefix, or 0.
+    /// The default walks this sequence's chunks against the other's elements;
+    /// lists override it to walk both node chains in lockstep.
+    virtual int compareElements(const Sequence<T> &other, ElementOrder order) const;
+    /// @brief First element when all of them are stored contiguously, else nullptr.
+    virtual const T *getContiguousData() const;
+
+    virtual Sequence<T> *getSubsequence(const SequenceIndex startIndex, const SequenceIndex endIndex) const = 0;
     virtual Sequence<T> *appendImmutable(const T &item) const = 0;
     virtual Sequence<T> *prependImmutable(const T &item) const = 0;
-    virtual Sequence<T> *insertAtImmutable(const T &item, const int index) const = 0;
-    virtual Sequence<T> *setImmutable(const int index, const T &data) const = 0;
+    virtual Sequence<T> *insertAtImmutable(const T &item, const SequenceIndex index) const = 0;
+    virtual Sequence<T> *setImmutable(const SequenceIndex index, const T &data) const = 0;
     virtual Sequence<T> *concatImmutable(const Sequence<T> *list) const = 0;
 
+    /// @brief Mutable deep copy, of the same concrete type where possible.
+    virtual Sequence<T> *clone() const = 0;
+    /// @brief Copies the sequence once for a batch of in-place edits that
+    /// freeze() hands back as the immutable result.
+    Transient<T> transient() const;
+
+    virtual void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const;
     virtual void print() const = 0;
-};
\ No newline at end of file
+};
+
+template <class T>
+std::ostream &operator<<(std::ostream &out, const Sequence<T> &sequence);
+
+template <class T>
+bool operator==(const Sequence<T> &left, const Sequence<T> &right);
+template <class T>
+bool operator!=(const Sequence<T> &left, const Sequence<T> &right);
+template <class T>
+bool operator<(const Sequence<T> &left, const Sequence<T> &right);
+
+/// @brief Hash functor for unordered containers keyed by sequences.
+template <class T>
+struct SequenceHash
+{
+    std::size_t operator()(const Sequence<T> &sequence) const { return sequence.hash(); }
+};
+
+#include "../impl/sequence.tpp"
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+#include <string>
+#include <type_traits>
+
+/// SEQUENCE_EXCEPTIONS is 0 when the containers are built without exceptions,
+/// either by defining SEQUENCE_NO_EXCEPTIONS (cmake -DENABLE_NO_EXCEPTIONS=ON)
+/// or by compiling with -fno-exceptions. Failed checks then print their
+/// message and abort, and the try/catch cleanup below compiles away.
+#if defined(SEQUENCE_NO_EXCEPTIONS) || !(defined(__cpp_exceptions) || defined(__EXCEPTIONS))
+#define SEQUENCE_EXCEPTIONS 0
+#define SEQUENCE_TRY if (true)
+#define SEQUENCE_CATCH_ALL if (false)
+#define SEQUENCE_RETHROW
+#else
+#define SEQUENCE_EXCEPTIONS 1
+#define SEQUENCE_TRY try
+#define SEQUENCE_CATCH_ALL catch (...)
+#define SEQUENCE_RETHROW throw
+#endif
+
+#if defined(__GNUC__)
+#define SEQUENCE_COLD __attribute__((noinline, cold))
+#else
+#define SEQUENCE_COLD
+#endif
+
+/// @brief Throws Exception(message), or prints message and aborts without
+/// exceptions. Out of line, so a range check costs a compare and a call
+/// rather than inline throw code in every accessor.
+template <class Exception>
+[[noreturn]] SEQUENCE_COLD void sequenceThrow(const char *message);
+template <class Exception>
+[[noreturn]] SEQUENCE_COLD void sequenceThrow(const std::string &message);
+
+/// @brief Why a try* operation did nothing.
+enum class SequenceStatus
+{
+    Ok,
+    OutOfRange,
+    Empty
+};
+
+/// @brief Reference to an element, or the status explaining why there is
+/// none. Returned by the try* accessors, which never throw.
+template <class T>
+class SequenceResult
+{
+private:
+    T *item;
+    SequenceStatus status;
+
+public:
+    SequenceResult(T &item) : item(&item), status(SequenceStatus::Ok) {}
+    SequenceResult(const SequenceStatus status) : item(nullptr), status(status) {}
+
+    bool ok() const { return item != nullptr; }
+    explicit operator bool() const { return item != nullptr; }
+    SequenceStatus getStatus() const { return status; }
+
+    /// @brief The element; only valid when ok().
+    T &value() const { return *item; }
+    T &operator*() const { return *item; }
+    T *operator->() const { return item; }
+    /// @brief Copy of the element, or fallback when there is none.
+    template <class U>
+    typename std::remove_const<T>::type valueOr(U &&fallback) const;
+};
+
+#include "../impl/sequenceError.tpp"
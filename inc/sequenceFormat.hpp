@@ -0,0 +1,85 @@
+#pragma once
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include "sequenceIndex.hpp"
+
+/// @brief Text layout used when writing a sequence: every element is wrapped
+/// in prefix/suffix, consecutive elements are divided by separator and an
+/// empty sequence is written as empty. The default matches DynamicArray::print.
+struct SequenceFormat
+{
+    std::string prefix;
+    std::string suffix;
+    std::string separator;
+    std::string empty;
+
+    SequenceFormat();
+    SequenceFormat(const std::string &prefix, const std::string &suffix,
+                   const std::string &separator, const std::string &empty = "");
+
+    static SequenceFormat brackets();
+    static SequenceFormat spaced();
+    static SequenceFormat lines();
+};
+
+/// @brief Buffers formatted output and hands it to the stream in large chunks.
+/// Integers and floating point values are formatted without going through the
+/// stream when it uses default flags; everything else falls back to operator<<.
+class SequenceFormatter
+{
+private:
+    struct GenericTag {};
+    struct IntegerTag {};
+    struct FloatTag {};
+
+    template <class T>
+    struct TagOf
+    {
+        typedef typename std::conditional<
+            std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                !std::is_same<T, char>::value && !std::is_same<T, signed char>::value &&
+                !std::is_same<T, unsigned char>::value,
+            IntegerTag,
+            typename std::conditional<std::is_floating_point<T>::value, FloatTag, GenericTag>::type>::type type;
+    };
+
+    static const int BUFFER_SIZE = 64 * 1024;
+    static const int MAX_VALUE_LENGTH = 64;
+
+    std::ostream &out;
+    char *buffer;
+    int used;
+    bool plain;
+
+    SequenceFormatter(const SequenceFormatter &other);
+    SequenceFormatter &operator=(const SequenceFormatter &other);
+
+    template <class T>
+    void writeValue(const T &value, GenericTag);
+    template <class T>
+    void writeValue(const T &value, IntegerTag);
+    template <class T>
+    void writeValue(const T &value, FloatTag);
+
+public:
+    SequenceFormatter(std::ostream &out);
+    ~SequenceFormatter();
+
+    void write(const char *text, const std::size_t length);
+    void write(const std::string &text);
+
+    template <class T>
+    void writeValue(const T &value);
+
+    void flush();
+};
+
+template <class T>
+void writeItems(std::ostream &out, const T *items, const SequenceIndex count, const SequenceFormat &format);
+
+template <class Iterator>
+void writeRange(std::ostream &out, Iterator begin, Iterator end, const SequenceFormat &format);
+
+#include "../impl/sequenceFormat.tpp"
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "dynamicArray.hpp"
+#include "arraySequence.hpp"
+#include "listSequence.hpp"
+
+/// @brief On-disk layout: a 32 byte header followed by count raw elements.
+/// byteOrder is written as 0x0102 in the writer's native order so readers
+/// can detect a file produced on a machine with different endianness.
+struct BinarySequenceHeader
+{
+    char magic[4];
+    uint16_t version;
+    uint16_t byteOrder;
+    uint32_t typeTag;
+    uint32_t elementSize;
+    uint64_t count;
+    uint64_t reserved;
+};
+
+static_assert(sizeof(BinarySequenceHeader) == 32, "Unexpected header layout");
+
+/// @brief Element type tags stored in the header. Types without a tag are
+/// saved as raw bytes and only checked by element size.
+template <class T> struct BinaryTypeTag { static const uint32_t value = 0; };
+template <> struct BinaryTypeTag<char> { static const uint32_t value = 1; };
+template <> struct BinaryTypeTag<signed char> { static const uint32_t value = 2; };
+template <> struct BinaryTypeTag<unsigned char> { static const uint32_t value = 3; };
+template <> struct BinaryTypeTag<short> { static const uint32_t value = 4; };
+template <> struct BinaryTypeTag<unsigned short> { static const uint32_t value = 5; };
+template <> struct BinaryTypeTag<int> { static const uint32_t value = 6; };
+template <> struct BinaryTypeTag<unsigned int> { static const uint32_t value = 7; };
+template <> struct BinaryTypeTag<long> { static const uint32_t value = 8; };
+template <> struct BinaryTypeTag<unsigned long> { static const uint32_t value = 9; };
+template <> struct BinaryTypeTag<long long> { static const uint32_t value = 10; };
+template <> struct BinaryTypeTag<unsigned long long> { static const uint32_t value = 11; };
+template <> struct BinaryTypeTag<float> { static const uint32_t value = 12; };
+template <> struct BinaryTypeTag<double> { static const uint32_t value = 13; };
+template <> struct BinaryTypeTag<bool> { static const uint32_t value = 14; };
+
+inline BinarySequenceHeader makeBinaryHeader(const uint32_t typeTag, const uint32_t elementSize, const uint64_t count);
+inline bool readBinaryHeader(const BinarySequenceHeader &raw, BinarySequenceHeader &header);
+inline void swapBytes(void *value, const std::size_t size);
+
+template <class T>
+void checkBinaryHeader(const BinarySequenceHeader &header);
+
+template <class T>
+void saveBinary(const T *items, const SequenceIndex count, const std::string &path);
+template <class T>
+void saveBinary(const DynamicArray<T> &array, const std::string &path);
+template <class T>
+void saveBinary(const ArraySequence<T> &sequence, const std::string &path);
+template <class T>
+void saveBinary(const ListSequence<T> &sequence, const std::string &path);
+
+template <class T>
+void loadBinary(const std::string &path, DynamicArray<T> &array);
+template <class T>
+void loadBinary(const std::string &path, ArraySequence<T> &sequence);
+
+/// @brief Streams elements to a binary sequence file through a fixed buffer,
+/// so sequences without contiguous storage can be saved in one pass.
+template <class T>
+class BinarySequenceWriter
+{
+private:
+    static const int BUFFER_BYTES = 64 * 1024;
+
+    std::ofstream file;
+    char *buffer;
+    int buffered;
+    uint64_t count;
+
+    void flush();
+
+public:
+    BinarySequenceWriter(const std::string &path);
+    ~BinarySequenceWriter();
+
+    void write(const T &item);
+    void write(const T *items, const SequenceIndex count);
+    void close();
+
+    uint64_t getCount() const;
+};
+
+#include "../impl/sequenceIO.tpp"
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstddef>
+
+/// @brief Signed pointer-width type used for every size, capacity and index,
+/// so containers can hold more than 2^31 elements. It stays signed so that
+/// negative indices are still rejected by the usual range checks, and plain
+/// int arguments convert to it implicitly.
+typedef std::ptrdiff_t SequenceIndex;
+
+/// @brief Capacity to grow to from current so that required elements fit:
+/// doubles like before, but clamps to maximum instead of overflowing and
+/// throws std::length_error when required itself is out of reach.
+inline SequenceIndex growCapacity(const SequenceIndex current, const SequenceIndex required, const SequenceIndex maximum);
+
+/// @brief Largest element count an allocator can serve that still fits SequenceIndex.
+template <class Allocator>
+SequenceIndex maxElements(const Allocator &allocator);
+
+#include "../impl/sequenceIndex.tpp"
@@ -0,0 +1,65 @@
+#pragma once
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "sequence.hpp"
+#include "arraySequence.hpp"
+#include "listSequence.hpp"
+
+/// @brief Lazy pipeline over a sequence. map, filter, slice, take, skip and
+/// concat only compose functions; nothing is read until the query is collected,
+/// at which point every stage runs fused in a single pass over the source.
+/// Collecting into an ArraySequence appends elements as they pass the stages,
+/// so a selective filter only pays for what it keeps; getBound() still reports
+/// the upper bound from the current source lengths. Sources are held by reference
+/// and must outlive the query and stay unmodified while it is collected.
+template <class T>
+class SequenceQuery
+{
+public:
+    typedef std::function<bool(const T &)> Consumer;
+    typedef std::function<bool(const Consumer &)> Producer;
+    typedef std::function<SequenceIndex()> Bound;
+
+private:
+    Producer producer;
+    Bound bound;
+
+public:
+    SequenceQuery(Producer producer, Bound bound);
+
+    static SequenceQuery<T> from(const Sequence<T> &sequence);
+    static SequenceQuery<T> from(const ArraySequence<T> &sequence);
+    static SequenceQuery<T> from(const ListSequence<T> &sequence);
+    static SequenceQuery<T> from(const T *items, const SequenceIndex count);
+
+    template <class Function>
+    SequenceQuery<typename std::decay<decltype(std::declval<Function>()(std::declval<const T &>()))>::type> map(Function function) const;
+
+    template <class Predicate>
+    SequenceQuery<T> filter(Predicate predicate) const;
+
+    SequenceQuery<T> take(const SequenceIndex count) const;
+    SequenceQuery<T> skip(const SequenceIndex count) const;
+    SequenceQuery<T> slice(const SequenceIndex startIndex, const SequenceIndex endIndex) const;
+    SequenceQuery<T> concat(const SequenceQuery<T> &other) const;
+
+    template <class Function>
+    void forEach(Function function) const;
+
+    SequenceIndex count() const;
+    SequenceIndex getBound() const;
+
+    ArraySequence<T> *toArraySequence() const;
+    ListSequence<T> *toListSequence() const;
+    void appendTo(Sequence<T> &target) const;
+};
+
+template <class T>
+SequenceQuery<T> query(const Sequence<T> &sequence);
+template <class T>
+SequenceQuery<T> query(const ArraySequence<T> &sequence);
+template <class T>
+SequenceQuery<T> query(const ListSequence<T> &sequence);
+
+#include "../impl/sequenceQuery.tpp"
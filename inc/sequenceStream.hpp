@@ -0,0 +1,100 @@
+#pragma once
+#if __cplusplus >= 202002L && defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <exception>
+#include <istream>
+#include <iterator>
+#include "sequence.hpp"
+#include "arraySequence.hpp"
+#include "listSequence.hpp"
+
+/// Defined when the build is C++20 with coroutines (cmake -DENABLE_CXX20=ON).
+#define SEQUENCE_HAS_STREAMS 1
+
+/// @brief Values produced on demand by a coroutine that co_yields them; the
+/// coroutine runs only as far as the consumer has advanced, so producers and
+/// consumers pipeline without materializing the whole stream. Move-only. A
+/// yielded value stays readable until the iterator is incremented.
+template <class T>
+class Generator
+{
+public:
+    struct promise_type
+    {
+        const T *current = nullptr;
+        std::exception_ptr failure;
+
+        Generator<T> get_return_object();
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+        std::suspend_always yield_value(const T &value) noexcept;
+        void return_void() const noexcept {}
+        void unhandled_exception();
+    };
+
+    typedef std::coroutine_handle<promise_type> Handle;
+
+    class Iterator
+    {
+    private:
+        Handle handle;
+
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        Iterator(Handle handle);
+        const T &operator*() const;
+        Iterator &operator++();
+        void operator++(int);
+        bool operator==(std::default_sentinel_t) const;
+    };
+
+private:
+    Handle handle;
+
+    explicit Generator(Handle handle);
+    static void resume(Handle handle);
+
+public:
+    Generator(const Generator<T> &other) = delete;
+    Generator(Generator<T> &&other) noexcept;
+    ~Generator();
+
+    /// @brief Runs the coroutine to its first value; call once.
+    Iterator begin();
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+    Generator<T> &operator=(const Generator<T> &other) = delete;
+    Generator<T> &operator=(Generator<T> &&other) noexcept;
+};
+
+/// @brief Yields the elements in order straight from the storage. The view
+/// re-reads the length on every step, so appends made while it is suspended
+/// are seen; the sequence must outlive the generator.
+template <class T, class Allocator>
+Generator<T> stream(const ArraySequence<T, Allocator> &sequence);
+/// @brief Yields the elements in order by following the node links.
+template <class T, class Allocator>
+Generator<T> stream(const ListSequence<T, Allocator> &sequence);
+/// @brief Yields any sequence's elements through get.
+template <class T>
+Generator<T> stream(const Sequence<T> &sequence);
+
+/// @brief Parses values with operator>> until the input ends or fails.
+template <class T>
+Generator<T> readValues(std::istream &in);
+
+/// @brief Drains source into target, buffering batchSize values and handing
+/// each full batch to appendRange. Returns the number of values appended.
+template <class T>
+SequenceIndex appendFrom(Sequence<T> &target, Generator<T> source, const SequenceIndex batchSize = 4096);
+/// @brief New SequenceType holding everything source yields.
+template <class SequenceType, class T>
+SequenceType collect(Generator<T> source, const SequenceIndex batchSize = 4096);
+
+#include "../impl/sequenceStream.tpp"
+#endif
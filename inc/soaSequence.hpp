@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "dynamicArray.hpp"
+
+/// @brief Contiguous view of one column; valid until the sequence changes length.
+template <class T>
+class ColumnSpan
+{
+private:
+    T *items;
+    SequenceIndex count;
+
+public:
+    ColumnSpan(T *items, const SequenceIndex count);
+
+    T *data() const;
+    SequenceIndex size() const;
+    T *begin() const;
+    T *end() const;
+    T &operator[](const SequenceIndex index) const;
+};
+
+/// @brief Sequence of records stored column by column: field I of every
+/// record lives in its own DynamicArray, so a scan over one field touches only
+/// that field's memory and runs over a plain contiguous array.
+template <class... Fields>
+class SoASequence
+{
+public:
+    typedef std::tuple<Fields...> Record;
+    static const std::size_t COLUMN_COUNT = sizeof...(Fields);
+
+    template <std::size_t Column>
+    using ColumnType = typename std::tuple_element<Column, Record>::type;
+
+private:
+    typedef std::index_sequence_for<Fields...> Columns;
+
+    std::tuple<DynamicArray<Fields>...> columns;
+    SequenceIndex length;
+
+    template <std::size_t... Column>
+    void resizeColumns(const SequenceIndex newLength, std::index_sequence<Column...>);
+    template <std::size_t... Column>
+    void assign(const SequenceIndex index, const Record &record, std::index_sequence<Column...>);
+    template <std::size_t... Column>
+    Record read(const SequenceIndex index, std::index_sequence<Column...>) const;
+
+    template <std::size_t... Column>
+    void shiftColumns(const SequenceIndex index, std::index_sequence<Column...>);
+    template <class T>
+    static void shiftColumn(T *items, const SequenceIndex index, const SequenceIndex length);
+
+    void resizeAll(const SequenceIndex newLength);
+    void checkIndex(const SequenceIndex index) const;
+
+public:
+    SoASequence();
+
+    SequenceIndex getLength() const;
+
+    void append(const Record &record);
+    void append(const Fields &...values);
+    void insertAt(const Record &record, const SequenceIndex index);
+    Record get(const SequenceIndex index) const;
+    void set(const SequenceIndex index, const Record &record);
+    void set(const SequenceIndex index, const Fields &...values);
+
+    void resize(const SequenceIndex newLength);
+    void clear();
+
+    template <std::size_t Column>
+    ColumnSpan<ColumnType<Column>> column();
+    template <std::size_t Column>
+    ColumnSpan<const ColumnType<Column>> column() const;
+
+    template <std::size_t Column>
+    ColumnType<Column> &at(const SequenceIndex index);
+    template <std::size_t Column>
+    const ColumnType<Column> &at(const SequenceIndex index) const;
+
+    Record operator[](const SequenceIndex index) const;
+};
+
+/// @brief Sums a column with independent partial sums so the loop has no
+/// serial dependency and compiles to packed SIMD adds.
+template <class T>
+typename std::remove_const<T>::type sumColumn(const ColumnSpan<T> &column);
+
+#include "../impl/soaSequence.tpp"
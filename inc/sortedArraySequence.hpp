@@ -0,0 +1,71 @@
+#pragma once
+#include <functional>
+#include <ostream>
+#include "sequence.hpp"
+#include "dynamicArray.hpp"
+
+enum class SearchLayout
+{
+    Binary,
+    Branchless,
+    Eytzinger
+};
+
+struct IndexRange
+{
+    SequenceIndex begin;
+    SequenceIndex end;
+};
+
+/// @brief Array kept sorted by Compare, answering order queries in O(log N).
+/// Binary is the classic branching search, Branchless replaces the branch with
+/// a conditional move, Eytzinger additionally keeps a copy of the elements in
+/// breadth-first tree order so the first levels of every search share cache
+/// lines. The Eytzinger copy is rebuilt on every insert while it is selected.
+template <class T, class Compare = std::less<T>>
+class SortedArraySequence
+{
+private:
+    DynamicArray<T> array;
+    Compare compare;
+    SearchLayout layout;
+    DynamicArray<T> tree;
+    DynamicArray<SequenceIndex> treeIndex;
+
+    void buildTree();
+    SequenceIndex fillTree(const SequenceIndex node, SequenceIndex next);
+
+    template <class Before>
+    SequenceIndex partitionPoint(Before before) const;
+
+public:
+    SortedArraySequence(Compare compare = Compare());
+    SortedArraySequence(const T *items, const SequenceIndex count, Compare compare = Compare());
+    SortedArraySequence(const Sequence<T> &items, Compare compare = Compare());
+
+    const T &getFirst() const;
+    const T &getLast() const;
+    const T &get(const SequenceIndex index) const;
+    SequenceIndex getLength() const;
+    const DynamicArray<T> &getArray() const;
+
+    void setSearchLayout(const SearchLayout layout);
+    SearchLayout getSearchLayout() const;
+
+    void insert(const T &item);
+    void clear();
+
+    SequenceIndex find(const T &value) const;
+    bool contains(const T &value) const;
+    SequenceIndex lowerBound(const T &value) const;
+    SequenceIndex upperBound(const T &value) const;
+    SequenceIndex rank(const T &value) const;
+    IndexRange equalRange(const T &value) const;
+
+    void writeTo(std::ostream &out, const SequenceFormat &format = SequenceFormat()) const;
+    void print() const;
+
+    const T &operator[](const SequenceIndex index) const;
+};
+
+#include "../impl/sortedArraySequence.tpp"
@@ -0,0 +1,28 @@
+#pragma once
+#include "sequenceIndex.hpp"
+
+/// @brief Array sorting primitives shared by the contiguous containers.
+/// introSort is an unstable quicksort with a heapsort fallback once the
+/// recursion gets too deep; mergeSort is stable and uses a buffer of count
+/// elements. parallelSort splits the range into one part per thread, sorts
+/// the parts concurrently and merges them pairwise, also in parallel.
+
+template <class T, class Compare>
+void insertionSort(T *items, const SequenceIndex count, Compare compare);
+
+template <class T, class Compare>
+void heapSort(T *items, const SequenceIndex count, Compare compare);
+
+template <class T, class Compare>
+void introSort(T *items, const SequenceIndex count, Compare compare);
+
+template <class T, class Compare>
+void mergeSort(T *items, const SequenceIndex count, Compare compare);
+
+template <class T, class Compare>
+void mergeRuns(T *first, const SequenceIndex firstCount, T *second, const SequenceIndex secondCount, T *out, Compare compare);
+
+template <class T, class Compare>
+void parallelSort(T *items, const SequenceIndex count, Compare compare, const int threads, const bool stable);
+
+#include "../impl/sorting.tpp"
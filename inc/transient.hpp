@@ -0,0 +1,41 @@
+#pragma once
+#include "sequence.hpp"
+
+/// @brief Owns one private copy of a sequence and edits it in place, so a
+/// batch of N changes costs one copy instead of the N that chained *Immutable
+/// calls pay. freeze() releases the copy as the result; the transient cannot
+/// be used afterwards. Edits return the transient so they can be chained.
+template <class T>
+class Transient
+{
+private:
+    Sequence<T> *sequence;
+
+    Sequence<T> &target() const;
+
+public:
+    explicit Transient(Sequence<T> *sequence);
+    Transient(Transient<T> &&other) noexcept;
+    Transient(const Transient<T> &other) = delete;
+    ~Transient();
+
+    Transient<T> &append(const T &item);
+    Transient<T> &prepend(const T &item);
+    Transient<T> &insertAt(const T &item, const SequenceIndex index);
+    Transient<T> &set(const SequenceIndex index, const T &data);
+    Transient<T> &concat(const Sequence<T> *other);
+    Transient<T> &insertRange(const SequenceIndex index, const T *items, const SequenceIndex count);
+    Transient<T> &appendRange(const T *items, const SequenceIndex count);
+
+    const T &get(const SequenceIndex index) const;
+    SequenceIndex getLength() const;
+    bool isFrozen() const;
+
+    /// @brief Hands over the edited sequence; the caller owns it.
+    Sequence<T> *freeze();
+
+    Transient<T> &operator=(Transient<T> &&other) noexcept;
+    Transient<T> &operator=(const Transient<T> &other) = delete;
+};
+
+#include "../impl/transient.tpp"
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include "sequenceIndex.hpp"
+#include "dynamicArray.hpp"
+
+enum class RangeOverlap
+{
+    None,
+    Partial,
+    Full
+};
+
+/// @brief Per-chunk summary of a contiguous array, consulted to skip chunks
+/// during lookups and range filters. Answers are conservative: a chunk may be
+/// reported as a candidate when it holds no match, never the other way round.
+template <class T>
+class ChunkSummary
+{
+public:
+    static const int CHUNK_SHIFT = 12;
+    static const int CHUNK_SIZE = 1 << CHUNK_SHIFT;
+
+    virtual ~ChunkSummary() = default;
+    virtual ChunkSummary<T> *clone() const = 0;
+
+    virtual void rebuild(const T *items, const SequenceIndex count) = 0;
+    /// @brief Records value at position. Overwritten values are not forgotten,
+    /// so set only ever widens a chunk's summary until the next rebuild.
+    virtual void add(const T &value, const SequenceIndex position) = 0;
+
+    virtual bool mayContain(const SequenceIndex chunk, const T &value) const = 0;
+    virtual RangeOverlap overlap(const SequenceIndex chunk, const T &low, const T &high) const = 0;
+};
+
+/// @brief Zone map plus Bloom filter per 4K-element chunk: min/max bounds
+/// answer range questions, 16384 filter bits (three probes from one mixed
+/// hash) reject most absent values even when the bounds do not.
+template <class T, class Hash = std::hash<T>>
+class ZoneMap : public ChunkSummary<T>
+{
+public:
+    static const int BLOOM_WORDS = 256;
+
+private:
+    struct Zone
+    {
+        T min;
+        T max;
+        bool empty;
+        std::uint64_t bloom[BLOOM_WORDS];
+        Zone() : min(), max(), empty(true), bloom() {}
+    };
+
+    DynamicArray<Zone> zones;
+    Hash hash;
+
+    std::uint64_t mix(const T &value) const;
+
+public:
+    ZoneMap(const Hash &hash = Hash());
+
+    ChunkSummary<T> *clone() const override;
+
+    void rebuild(const T *items, const SequenceIndex count) override;
+    void add(const T &value, const SequenceIndex position) override;
+
+    bool mayContain(const SequenceIndex chunk, const T &value) const override;
+    RangeOverlap overlap(const SequenceIndex chunk, const T &low, const T &high) const override;
+
+    SequenceIndex getChunkCount() const;
+};
+
+#include "../impl/zoneMap.tpp"
@@ -0,0 +1,518 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+#include "../inc/dListSequence.hpp"
+#include "../inc/poolListSequence.hpp"
+#include "../inc/ropeSequence.hpp"
+#include "../inc/segmentedArraySequence.hpp"
+#include "../inc/packedIntSequence.hpp"
+#include "../inc/adaptiveSequence.hpp"
+
+/// Workload driver: replays seeded operation traces against every Sequence
+/// implementation and reports throughput, per-operation latency percentiles,
+/// heap allocations and peak memory. Each run replays the same trace twice:
+/// once untimed per operation for throughput and allocation counts, once with
+/// a clock read around every operation for the latency percentiles.
+
+namespace
+{
+    struct HeapCounter
+    {
+        unsigned long long allocations;
+        std::size_t live;
+        std::size_t peak;
+    };
+
+    HeapCounter heap = {0, 0, 0};
+
+    /// Every allocation carries its size in front so frees can be accounted.
+    const std::size_t HEADER = alignof(std::max_align_t);
+}
+
+void *operator new(std::size_t size)
+{
+    char *block = static_cast<char *>(std::malloc(size + HEADER));
+    if (!block)
+    {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<std::size_t *>(block) = size;
+    heap.allocations++;
+    heap.live += size;
+    heap.peak = std::max(heap.peak, heap.live);
+    return block + HEADER;
+}
+
+void operator delete(void *pointer) noexcept
+{
+    if (!pointer)
+    {
+        return;
+    }
+    char *block = static_cast<char *>(pointer) - HEADER;
+    heap.live -= *reinterpret_cast<std::size_t *>(block);
+    std::free(block);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+namespace
+{
+    enum Operation
+    {
+        Get,
+        Set,
+        Append,
+        Prepend,
+        InsertAt,
+        GetFirst,
+        GetLast,
+        IndexOf,
+        AppendImmutable,
+        SetImmutable,
+        Subsequence,
+        OPERATION_COUNT
+    };
+
+    const char *OPERATION_NAMES[OPERATION_COUNT] = {
+        "get", "set", "append", "prepend", "insertAt", "getFirst", "getLast",
+        "indexOf", "appendImmutable", "setImmutable", "subsequence"};
+
+    const std::size_t SNAPSHOTS = 4;
+    const SequenceIndex SLICE = 64;
+
+    struct Step
+    {
+        Operation operation;
+        std::uint32_t position;
+        int value;
+    };
+
+    struct Mix
+    {
+        std::string name;
+        double weights[OPERATION_COUNT];
+    };
+
+    struct Factory
+    {
+        std::string name;
+        std::function<Sequence<int> *()> create;
+    };
+
+    struct Options
+    {
+        std::vector<std::string> sequences;
+        std::vector<Mix> mixes;
+        int size;
+        int operations;
+        unsigned seed;
+        bool latency;
+        Options() : size(1000), operations(100000), seed(1), latency(true) {}
+    };
+
+    const std::vector<Factory> &factories()
+    {
+        static const std::vector<Factory> all = {
+            {"array", []() -> Sequence<int> * { return new ArraySequence<int>(); }},
+            {"list", []() -> Sequence<int> * { return new ListSequence<int>(); }},
+            {"dlist", []() -> Sequence<int> * { return new DListSequence<int>(); }},
+            {"pool", []() -> Sequence<int> * { return new PoolListSequence<int>(); }},
+            {"xorpool", []() -> Sequence<int> * { return new PoolListSequence<int, true>(); }},
+            {"rope", []() -> Sequence<int> * { return new RopeSequence<int>(); }},
+            {"segmented", []() -> Sequence<int> * { return new SegmentedArraySequence<int>(); }},
+            {"packed", []() -> Sequence<int> * { return new PackedIntSequence<int>(); }},
+            {"adaptive", []() -> Sequence<int> * { return new AdaptiveSequence<int>(); }},
+        };
+        return all;
+    }
+
+    double mixTotal(const Mix &mix)
+    {
+        return std::accumulate(mix.weights, mix.weights + OPERATION_COUNT, 0.0);
+    }
+
+    Mix parseMix(const std::string &name, const std::string &spec)
+    {
+        Mix mix;
+        mix.name = name;
+        std::fill(mix.weights, mix.weights + OPERATION_COUNT, 0.0);
+
+        std::stringstream parts(spec);
+        std::string part;
+        while (std::getline(parts, part, ','))
+        {
+            std::size_t equals = part.find('=');
+            std::string operation = part.substr(0, equals);
+            const char **found = std::find(OPERATION_NAMES, OPERATION_NAMES + OPERATION_COUNT, operation);
+            if (equals == std::string::npos || found == OPERATION_NAMES + OPERATION_COUNT)
+            {
+                throw std::invalid_argument("Unknown operation in mix: " + part);
+            }
+            const char *text = part.c_str() + equals + 1;
+            char *end = nullptr;
+            double weight = std::strtod(text, &end);
+            if (end == text || *end != '\0' || !(weight >= 0) || std::isinf(weight))
+            {
+                throw std::invalid_argument("Weight must be a non-negative number: " + part);
+            }
+            mix.weights[found - OPERATION_NAMES] = weight;
+        }
+        if (mixTotal(mix) <= 0)
+        {
+            throw std::invalid_argument("Mix has no positive weight: " + spec);
+        }
+        return mix;
+    }
+
+    /// Named mixes; Sequence has no removal, so the queue mix produces at the
+    /// tail and consumes by reading the head.
+    std::vector<Mix> builtinMixes()
+    {
+        return {
+            parseMix("mixed", "get=70,append=20,insertAt=10"),
+            parseMix("queue", "append=45,getFirst=45,getLast=10"),
+            parseMix("snapshot", "get=40,appendImmutable=30,setImmutable=20,subsequence=10"),
+            parseMix("edit", "get=40,set=30,prepend=10,insertAt=10,indexOf=10"),
+        };
+    }
+
+    std::vector<Step> makeTrace(const Mix &mix, const int operations, const unsigned seed)
+    {
+        std::mt19937 random(seed);
+        std::discrete_distribution<int> pick(mix.weights, mix.weights + OPERATION_COUNT);
+        std::vector<Step> trace(operations);
+        for (Step &step : trace)
+        {
+            step.operation = static_cast<Operation>(pick(random));
+            step.position = static_cast<std::uint32_t>(random());
+            step.value = static_cast<int>(random() % 1000000);
+        }
+        return trace;
+    }
+
+    /// Applies steps to one sequence. Immutable operations replace the current
+    /// version and keep the last few versions alive as snapshots.
+    class Replayer
+    {
+    private:
+        std::unique_ptr<Sequence<int>> current;
+        std::vector<std::unique_ptr<Sequence<int>>> snapshots;
+        std::size_t nextSnapshot;
+
+        void advance(Sequence<int> *next)
+        {
+            if (snapshots.size() < SNAPSHOTS)
+            {
+                snapshots.emplace_back(current.release());
+            }
+            else
+            {
+                snapshots[nextSnapshot].reset(current.release());
+                nextSnapshot = (nextSnapshot + 1) % SNAPSHOTS;
+            }
+            current.reset(next);
+        }
+
+    public:
+        long long checksum;
+
+        Replayer(const Factory &factory, const int size, const unsigned seed)
+            : current(factory.create()), snapshots(), nextSnapshot(0), checksum(0)
+        {
+            std::mt19937 random(seed ^ 0x5eed);
+            for (int i = 0; i < size; i++)
+            {
+                current->append(static_cast<int>(random() % 1000000));
+            }
+        }
+
+        void apply(const Step &step)
+        {
+            Sequence<int> &sequence = *current;
+            const Sequence<int> &view = sequence;
+            SequenceIndex length = sequence.getLength();
+            SequenceIndex index = length > 0 ? step.position % length : 0;
+            switch (step.operation)
+            {
+            case Get:
+                checksum += length > 0 ? view.get(index) : 0;
+                break;
+            case Set:
+                if (length > 0)
+                {
+                    sequence.set(index, step.value);
+                }
+                break;
+            case Append:
+                sequence.append(step.value);
+                break;
+            case Prepend:
+                sequence.prepend(step.value);
+                break;
+            case InsertAt:
+                sequence.insertAt(step.value, step.position % (length + 1));
+                break;
+            case GetFirst:
+                checksum += length > 0 ? view.getFirst() : 0;
+                break;
+            case GetLast:
+                checksum += length > 0 ? view.getLast() : 0;
+                break;
+            case IndexOf:
+                checksum += sequence.indexOf(step.value);
+                break;
+            case AppendImmutable:
+                advance(sequence.appendImmutable(step.value));
+                break;
+            case SetImmutable:
+                if (length > 0)
+                {
+                    advance(sequence.setImmutable(index, step.value));
+                }
+                break;
+            case Subsequence:
+                if (length > 0)
+                {
+                    std::unique_ptr<Sequence<int>> slice(sequence.getSubsequence(index, std::min(length - 1, index + SLICE - 1)));
+                    checksum += slice->getLength();
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    };
+
+    unsigned long long percentile(std::vector<unsigned long long> &samples, const int percent)
+    {
+        std::size_t rank = (samples.size() - 1) * percent / 100;
+        std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+        return samples[rank];
+    }
+
+    long long run(const Factory &factory, const Mix &mix, const Options &options)
+    {
+        std::vector<Step> trace = makeTrace(mix, options.operations, options.seed);
+        long long checksum = 0;
+
+        double seconds;
+        unsigned long long allocations;
+        std::size_t peakBytes;
+        {
+            Replayer replayer(factory, options.size, options.seed);
+            heap.allocations = 0;
+            std::size_t baseline = heap.live;
+            heap.peak = baseline;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (const Step &step : trace)
+            {
+                replayer.apply(step);
+            }
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            allocations = heap.allocations;
+            peakBytes = heap.peak - baseline;
+            checksum += replayer.checksum;
+        }
+
+        std::cout << "sequence=" << factory.name << " mix=" << mix.name << " size=" << options.size
+                  << " operations=" << options.operations << " seed=" << options.seed << std::endl;
+        std::cout << std::fixed << std::setprecision(2)
+                  << "  throughput " << std::setw(10) << options.operations / seconds / 1e6 << " Mop/s"
+                  << "   allocations " << allocations
+                  << "   peak heap " << peakBytes / 1024.0 << " KiB" << std::endl;
+
+        if (!options.latency)
+        {
+            return checksum;
+        }
+
+        std::vector<std::vector<unsigned long long>> latencies(OPERATION_COUNT);
+        const double total = mixTotal(mix);
+        for (int op = 0; op < OPERATION_COUNT; op++)
+        {
+            latencies[op].reserve(static_cast<std::size_t>(options.operations * mix.weights[op] / total * 1.2) + 16);
+        }
+        {
+            Replayer replayer(factory, options.size, options.seed);
+            for (const Step &step : trace)
+            {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                replayer.apply(step);
+                std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+                latencies[step.operation].push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+            }
+            checksum += replayer.checksum;
+        }
+
+        for (int op = 0; op < OPERATION_COUNT; op++)
+        {
+            std::vector<unsigned long long> &samples = latencies[op];
+            if (samples.empty())
+            {
+                continue;
+            }
+            std::cout << "  " << std::left << std::setw(16) << OPERATION_NAMES[op] << std::right
+                      << std::setw(10) << samples.size() << " ops"
+                      << "   p50 " << std::setw(10) << percentile(samples, 50) << " ns"
+                      << "   p99 " << std::setw(10) << percentile(samples, 99) << " ns" << std::endl;
+        }
+        return checksum;
+    }
+
+    std::vector<std::string> split(const std::string &text)
+    {
+        std::vector<std::string> parts;
+        std::stringstream stream(text);
+        std::string part;
+        while (std::getline(stream, part, ','))
+        {
+            parts.push_back(part);
+        }
+        return parts;
+    }
+
+    void printUsage()
+    {
+        std::cout << "usage: workload [--sequence array,list,...] [--mix name|op=weight,...]\n"
+                  << "                [--size N] [--operations N] [--seed N] [--latency 0|1] [--list]\n";
+    }
+
+    Options parseOptions(int argc, char **argv)
+    {
+        Options options;
+        std::vector<Mix> builtins = builtinMixes();
+        for (int i = 1; i < argc; i++)
+        {
+            std::string flag = argv[i];
+            if (flag == "--list")
+            {
+                std::cout << "sequences:";
+                for (const Factory &factory : factories())
+                {
+                    std::cout << " " << factory.name;
+                }
+                std::cout << "\nmixes:";
+                for (const Mix &mix : builtins)
+                {
+                    std::cout << " " << mix.name;
+                }
+                std::cout << "\noperations:";
+                for (const char *name : OPERATION_NAMES)
+                {
+                    std::cout << " " << name;
+                }
+                std::cout << std::endl;
+                std::exit(0);
+            }
+            if (i + 1 >= argc)
+            {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            std::string value = argv[++i];
+            if (flag == "--sequence")
+            {
+                options.sequences = split(value);
+            }
+            else if (flag == "--mix")
+            {
+                auto named = std::find_if(builtins.begin(), builtins.end(), [&value](const Mix &mix)
+                                          { return mix.name == value; });
+                options.mixes.push_back(named != builtins.end() ? *named : parseMix(value, value));
+            }
+            else if (flag == "--size")
+            {
+                options.size = std::atoi(value.c_str());
+            }
+            else if (flag == "--operations")
+            {
+                options.operations = std::atoi(value.c_str());
+            }
+            else if (flag == "--seed")
+            {
+                options.seed = static_cast<unsigned>(std::strtoul(value.c_str(), nullptr, 10));
+            }
+            else if (flag == "--latency")
+            {
+                options.latency = value != "0";
+            }
+            else
+            {
+                throw std::invalid_argument("Unknown option " + flag);
+            }
+        }
+        if (options.mixes.empty())
+        {
+            options.mixes = builtins;
+        }
+        if (options.sequences.empty())
+        {
+            for (const Factory &factory : factories())
+            {
+                options.sequences.push_back(factory.name);
+            }
+        }
+        if (options.size < 0 || options.operations <= 0)
+        {
+            throw std::invalid_argument("Size must be non-negative and operations positive");
+        }
+        return options;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch (const std::exception &error)
+    {
+        std::cerr << error.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    long long checksum = 0;
+    for (const std::string &name : options.sequences)
+    {
+        auto factory = std::find_if(factories().begin(), factories().end(), [&name](const Factory &candidate)
+                                    { return candidate.name == name; });
+        if (factory == factories().end())
+        {
+            std::cerr << "Unknown sequence " << name << std::endl;
+            return 1;
+        }
+        for (const Mix &mix : options.mixes)
+        {
+            checksum += run(*factory, mix, options);
+        }
+    }
+
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    std::cout << "peak RSS " << usage.ru_maxrss << " KiB (whole process; run a single --sequence and --mix to isolate one)"
+              << std::endl;
+    std::cout << "checksum " << checksum << std::endl;
+    return 0;
+}
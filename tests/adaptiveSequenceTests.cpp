@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../inc/adaptiveSequence.hpp"
+
+namespace
+{
+    std::string text(const Sequence<int> &seq)
+    {
+        std::ostringstream out;
+        out << seq;
+        return out.str();
+    }
+
+    AdaptiveSequence<int> filled(const int count)
+    {
+        AdaptiveSequence<int> seq;
+        for (int i = 0; i < count; i++)
+        {
+            seq.append(i);
+        }
+        return seq;
+    }
+
+    long long readRandomly(AdaptiveSequence<int> &seq, const int reads)
+    {
+        std::mt19937 random(1);
+        long long sum = 0;
+        for (int i = 0; i < reads; i++)
+        {
+            sum += seq.get(static_cast<SequenceIndex>(random() % seq.getLength()));
+        }
+        return sum;
+    }
+}
+
+TEST(AdaptiveSequenceTest, EveryRepresentationBehavesAlike)
+{
+    const SequenceRepresentation representations[] = {
+        SequenceRepresentation::Contiguous, SequenceRepresentation::Linked, SequenceRepresentation::Chunked};
+    int items[] = {1, 2, 3};
+    for (SequenceRepresentation representation : representations)
+    {
+        AdaptiveSequence<int> seq(items, 3, representation);
+        EXPECT_EQ(seq.getRepresentation(), representation);
+        seq.append(4);
+        seq.prepend(0);
+        seq.insertAt(9, 2);
+        seq.set(1, 7);
+        EXPECT_EQ(text(seq), "[0], [7], [9], [2], [3], [4]");
+        EXPECT_EQ(seq.getFirst(), 0);
+        EXPECT_EQ(seq.getLast(), 4);
+        EXPECT_EQ(seq.indexOf(9), 2);
+        EXPECT_THROW(seq.get(6), std::out_of_range);
+
+        std::unique_ptr<Sequence<int>> slice(seq.getSubsequence(1, 3));
+        EXPECT_EQ(text(*slice), "[7], [9], [2]");
+        std::unique_ptr<Sequence<int>> longer(seq.concatImmutable(&seq));
+        EXPECT_EQ(longer->getLength(), 12);
+        EXPECT_EQ(seq.getLength(), 6);
+
+        seq.concat(&seq);
+        EXPECT_EQ(text(seq), text(*longer));
+        EXPECT_EQ(dynamic_cast<AdaptiveSequence<int> *>(longer.get())->getRepresentation(), representation);
+    }
+    EXPECT_THROW(AdaptiveSequence<int>(nullptr, 2), std::invalid_argument);
+    AdaptiveSequence<int> empty;
+    EXPECT_NO_THROW(empty.concat(nullptr));
+    EXPECT_NO_THROW(empty.insertRange(0, static_cast<const Sequence<int> *>(nullptr)));
+    EXPECT_EQ(empty.getLength(), 0);
+    EXPECT_THROW(empty.insertRange(1, static_cast<const Sequence<int> *>(nullptr)), std::out_of_range);
+}
+
+TEST(AdaptiveSequenceTest, RandomReadsStayContiguous)
+{
+    AdaptiveSequence<int> seq = filled(5000);
+    readRandomly(seq, 20000);
+    EXPECT_EQ(seq.getRepresentation(), SequenceRepresentation::Contiguous);
+    EXPECT_EQ(seq.getMigrationCount(), 0);
+}
+
+TEST(AdaptiveSequenceTest, FrontInsertsMoveToLinked)
+{
+    AdaptiveSequence<int> seq;
+    for (int i = 0; i < 20000; i++)
+    {
+        seq.prepend(i);
+    }
+    EXPECT_EQ(seq.getRepresentation(), SequenceRepresentation::Linked);
+    EXPECT_EQ(seq.getMigrationCount(), 1);
+    EXPECT_EQ(seq.getFirst(), 19999);
+    EXPECT_EQ(seq.getLast(), 0);
+    EXPECT_EQ(seq.get(12345), 19999 - 12345);
+}
+
+TEST(AdaptiveSequenceTest, MiddleInsertsOnLargeSequencesMoveToChunked)
+{
+    std::vector<int> items(200000);
+    std::iota(items.begin(), items.end(), 0);
+    AdaptiveSequence<int> seq(items.data(), static_cast<SequenceIndex>(items.size()));
+    std::mt19937 random(2);
+    for (int i = 0; i < 2000; i++)
+    {
+        seq.insertAt(-i, 1 + static_cast<SequenceIndex>(random() % (seq.getLength() - 1)));
+    }
+    EXPECT_EQ(seq.getRepresentation(), SequenceRepresentation::Chunked);
+    EXPECT_EQ(seq.getLength(), 202000);
+    EXPECT_EQ(seq.getFirst(), 0);
+    EXPECT_EQ(seq.getLast(), 199999);
+}
+
+TEST(AdaptiveSequenceTest, ReadsAfterFrontInsertsMoveBack)
+{
+    AdaptiveSequence<int> seq;
+    for (int i = 0; i < 20000; i++)
+    {
+        seq.prepend(i);
+    }
+    ASSERT_EQ(seq.getRepresentation(), SequenceRepresentation::Linked);
+    long long linkedSum = readRandomly(seq, 5000);
+    EXPECT_NE(seq.getRepresentation(), SequenceRepresentation::Linked);
+    readRandomly(seq, 100000);
+    EXPECT_EQ(seq.getRepresentation(), SequenceRepresentation::Contiguous);
+    EXPECT_EQ(readRandomly(seq, 5000), linkedSum);
+}
+
+TEST(AdaptiveSequenceTest, ConstReadsNeverMigrate)
+{
+    AdaptiveSequence<int> seq;
+    for (int i = 0; i < 20000; i++)
+    {
+        seq.prepend(i);
+    }
+    ASSERT_EQ(seq.getRepresentation(), SequenceRepresentation::Linked);
+
+    const AdaptiveSequence<int> &view = seq;
+    const int &first = view.getFirst();
+    std::mt19937 random(1);
+    for (int i = 0; i < 20000; i++)
+    {
+        view.get(static_cast<SequenceIndex>(random() % view.getLength()));
+    }
+    EXPECT_EQ(seq.getRepresentation(), SequenceRepresentation::Linked);
+    EXPECT_EQ(seq.getMigrationCount(), 1);
+    EXPECT_EQ(&first, &view.getFirst());
+
+    // The counted reads join the mix at the next non-const operation.
+    seq.append(-1);
+    EXPECT_NE(seq.getRepresentation(), SequenceRepresentation::Linked);
+}
+
+TEST(AdaptiveSequenceTest, ShortBurstsDoNotMigrate)
+{
+    AdaptiveSequence<int> seq = filled(10000);
+    for (int round = 0; round < 5; round++)
+    {
+        readRandomly(seq, 5000);
+        for (int i = 0; i < 64; i++)
+        {
+            seq.prepend(i);
+        }
+    }
+    EXPECT_EQ(seq.getRepresentation(), SequenceRepresentation::Contiguous);
+    EXPECT_EQ(seq.getMigrationCount(), 0);
+}
+
+TEST(AdaptiveSequenceTest, CopiesAndManualMigration)
+{
+    AdaptiveSequence<int> seq = filled(100);
+    seq.migrateTo(SequenceRepresentation::Chunked);
+    seq.migrateTo(SequenceRepresentation::Chunked);
+    EXPECT_EQ(seq.getMigrationCount(), 1);
+
+    AdaptiveSequence<int> copy(seq);
+    EXPECT_EQ(copy.getRepresentation(), SequenceRepresentation::Chunked);
+    copy.set(0, -1);
+    EXPECT_EQ(seq.get(0), 0);
+
+    seq.migrateTo(SequenceRepresentation::Linked);
+    copy = seq;
+    EXPECT_EQ(copy.getRepresentation(), SequenceRepresentation::Linked);
+    EXPECT_EQ(text(copy), text(seq));
+
+    std::unique_ptr<Sequence<int>> appended(seq.appendImmutable(100));
+    EXPECT_EQ(appended->getLast(), 100);
+    EXPECT_EQ(seq.getLength(), 100);
+
+    AdaptiveSequence<int> empty;
+    empty.migrateTo(SequenceRepresentation::Linked);
+    empty.append(5);
+    EXPECT_EQ(empty.getFirst(), 5);
+}
@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+
+struct CountingArena
+{
+    char *buffer;
+    std::size_t capacity;
+    std::size_t used;
+    int allocations;
+    int deallocations;
+
+    explicit CountingArena(const std::size_t capacity)
+        : buffer(new char[capacity]), capacity(capacity), used(0), allocations(0), deallocations(0) {}
+    ~CountingArena() { delete[] buffer; }
+};
+
+/// @brief Monotonic allocator: memory is bumped out of the arena and only
+/// returned when the arena itself is destroyed.
+template <class T, bool Propagate = true>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+    typedef std::integral_constant<bool, Propagate> propagate_on_container_copy_assignment;
+    typedef std::integral_constant<bool, Propagate> propagate_on_container_move_assignment;
+    typedef std::integral_constant<bool, Propagate> propagate_on_container_swap;
+
+    template <class U>
+    struct rebind
+    {
+        typedef ArenaAllocator<U, Propagate> other;
+    };
+
+    CountingArena *arena;
+
+    explicit ArenaAllocator(CountingArena *arena) : arena(arena) {}
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U, Propagate> &other) : arena(other.arena) {}
+
+    T *allocate(const std::size_t count)
+    {
+        std::size_t start = (arena->used + alignof(T) - 1) / alignof(T) * alignof(T);
+        if (start + sizeof(T) * count > arena->capacity)
+        {
+            throw std::bad_alloc();
+        }
+        arena->used = start + sizeof(T) * count;
+        arena->allocations++;
+        return reinterpret_cast<T *>(arena->buffer + start);
+    }
+
+    void deallocate(T *, const std::size_t)
+    {
+        arena->deallocations++;
+    }
+};
+
+template <class T, class U, bool Propagate>
+bool operator==(const ArenaAllocator<T, Propagate> &first, const ArenaAllocator<U, Propagate> &second)
+{
+    return first.arena == second.arena;
+}
+
+template <class T, class U, bool Propagate>
+bool operator!=(const ArenaAllocator<T, Propagate> &first, const ArenaAllocator<U, Propagate> &second)
+{
+    return !(first == second);
+}
+
+typedef ArenaAllocator<int> IntArena;
+typedef ArenaAllocator<int, false> FixedIntArena;
+typedef ArraySequence<int, IntArena> ArenaArraySequence;
+typedef ListSequence<int, IntArena> ArenaListSequence;
+
+TEST(AllocatorTest, DynamicArrayAllocatesFromArena)
+{
+    CountingArena arena(1 << 16);
+    {
+        DynamicArray<int, IntArena> array{IntArena(&arena)};
+        for (int i = 0; i < 100; i++)
+        {
+            array.append(i);
+        }
+        EXPECT_EQ(array[99], 99);
+        EXPECT_EQ(arena.allocations, 8);
+        EXPECT_GE(arena.used, sizeof(int) * 128);
+    }
+    EXPECT_EQ(arena.deallocations, arena.allocations);
+}
+
+TEST(AllocatorTest, LinkedListAllocatesNodesFromArena)
+{
+    CountingArena arena(1 << 16);
+    int items[] = {1, 2, 3, 4};
+    {
+        LinkedList<int, IntArena> list(items, 4, IntArena(&arena));
+        list.insertRange(2, items, 4);
+        EXPECT_EQ(list.getLength(), 8);
+        EXPECT_EQ(arena.allocations, 8);
+
+        LinkedList<int, IntArena> copy(list);
+        EXPECT_EQ(copy.getAllocator().arena, &arena);
+        EXPECT_EQ(arena.allocations, 16);
+    }
+    EXPECT_EQ(arena.deallocations, 16);
+}
+
+TEST(AllocatorTest, SequencesKeepTheirAllocatorAcrossOperations)
+{
+    CountingArena arena(1 << 16);
+    int items[] = {5, 3, 1};
+    ArraySequence<int, IntArena> array(items, 3, IntArena(&arena));
+    ListSequence<int, IntArena> list(items, 3, IntArena(&arena));
+
+    Sequence<int> *arrayPart = array.getSubsequence(0, 1);
+    Sequence<int> *listCopy = list.appendImmutable(7);
+    EXPECT_EQ(static_cast<ArenaArraySequence *>(arrayPart)->getAllocator().arena, &arena);
+    EXPECT_EQ(static_cast<ArenaListSequence *>(listCopy)->getAllocator().arena, &arena);
+
+    int used = arena.allocations;
+    array.sort();
+    list.sort();
+    EXPECT_EQ(array[0], 1);
+    EXPECT_EQ(list.get(0), 1);
+    EXPECT_EQ(arena.allocations, used);
+
+    delete arrayPart;
+    delete listCopy;
+}
+
+TEST(AllocatorTest, CopyAssignmentPropagatesAllocator)
+{
+    CountingArena first(1 << 12);
+    CountingArena second(1 << 12);
+    int items[] = {1, 2, 3};
+
+    ArraySequence<int, IntArena> source(items, 3, IntArena(&first));
+    ArraySequence<int, IntArena> target{IntArena(&second)};
+    target = source;
+    EXPECT_EQ(target.getAllocator().arena, &first);
+    EXPECT_EQ(target.getLength(), 3);
+
+    ArraySequence<int, FixedIntArena> fixedSource(items, 3, FixedIntArena(&first));
+    ArraySequence<int, FixedIntArena> fixedTarget{FixedIntArena(&second)};
+    fixedTarget = fixedSource;
+    EXPECT_EQ(fixedTarget.getAllocator().arena, &second);
+    EXPECT_EQ(fixedTarget[2], 3);
+}
+
+TEST(AllocatorTest, MoveStealsStorageWhenAllocatorsAllow)
+{
+    CountingArena first(1 << 12);
+    CountingArena second(1 << 12);
+    int items[] = {1, 2, 3};
+
+    ListSequence<int, IntArena> source(items, 3, IntArena(&first));
+    int allocations = first.allocations;
+    ListSequence<int, IntArena> moved(std::move(source));
+    EXPECT_EQ(first.allocations, allocations);
+    EXPECT_EQ(moved.getLength(), 3);
+    EXPECT_EQ(source.getLength(), 0);
+
+    ArraySequence<int, FixedIntArena> fixedSource(items, 3, FixedIntArena(&first));
+    ArraySequence<int, FixedIntArena> fixedTarget{FixedIntArena(&second)};
+    int secondAllocations = second.allocations;
+    fixedTarget = std::move(fixedSource);
+    EXPECT_EQ(fixedTarget.getAllocator().arena, &second);
+    EXPECT_EQ(fixedTarget.getLength(), 3);
+    EXPECT_GT(second.allocations, secondAllocations);
+
+    fixedSource.append(4);
+    EXPECT_EQ(fixedSource.getLast(), 4);
+}
+
+TEST(AllocatorTest, SwapExchangesContentsAndAllocators)
+{
+    CountingArena first(1 << 12);
+    CountingArena second(1 << 12);
+    int items[] = {1, 2, 3};
+
+    DynamicArray<int, IntArena> left(items, 3, IntArena(&first));
+    DynamicArray<int, IntArena> right(items, 1, IntArena(&second));
+    swap(left, right);
+
+    EXPECT_EQ(left.getSize(), 1);
+    EXPECT_EQ(right.getSize(), 3);
+    EXPECT_EQ(left.getAllocator().arena, &second);
+    EXPECT_EQ(right.getAllocator().arena, &first);
+}
+
+TEST(AllocatorTest, SplicingAcrossArenasIsRejected)
+{
+    CountingArena first(1 << 12);
+    CountingArena second(1 << 12);
+    int items[] = {1, 2};
+
+    LinkedList<int, IntArena> left(items, 2, IntArena(&first));
+    LinkedList<int, IntArena> right(items, 2, IntArena(&second));
+    EXPECT_THROW(left.splice(0, right), std::invalid_argument);
+    EXPECT_THROW(left.merge(right), std::invalid_argument);
+    EXPECT_EQ(left.getLength(), 2);
+}
+
+TEST(AllocatorTest, ArenaExhaustionSurfacesAsBadAlloc)
+{
+    CountingArena arena(64);
+    DynamicArray<int, IntArena> array{IntArena(&arena)};
+    EXPECT_THROW(array.resize(1000), std::bad_alloc);
+    EXPECT_EQ(array.getSize(), 0);
+}
@@ -0,0 +1,243 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+#include "../inc/appendBuffer.hpp"
+
+/// @brief Allocator that refuses requests above a shared element limit.
+template <class T>
+class LimitedAllocator
+{
+public:
+    typedef T value_type;
+
+    std::size_t *limit;
+
+    explicit LimitedAllocator(std::size_t *limit) : limit(limit) {}
+    template <class U>
+    LimitedAllocator(const LimitedAllocator<U> &other) : limit(other.limit) {}
+
+    T *allocate(const std::size_t count)
+    {
+        if (count > *limit)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T *items, const std::size_t) { ::operator delete(items); }
+};
+
+template <class T, class U>
+bool operator==(const LimitedAllocator<T> &first, const LimitedAllocator<U> &second)
+{
+    return first.limit == second.limit;
+}
+
+template <class T, class U>
+bool operator!=(const LimitedAllocator<T> &first, const LimitedAllocator<U> &second)
+{
+    return !(first == second);
+}
+
+TEST(AppendBufferTest, RejectsInvalidChunkSize)
+{
+    EXPECT_THROW(AppendBuffer<int>(0), std::invalid_argument);
+}
+
+TEST(AppendBufferTest, PublishesFullChunksAndFlushedRemainder)
+{
+    AppendBuffer<int> buffer(4);
+    AppendBuffer<int>::Producer producer(buffer);
+    EXPECT_TRUE(buffer.isEmpty());
+
+    for (int i = 0; i < 6; i++)
+    {
+        producer.append(i);
+    }
+    EXPECT_FALSE(buffer.isEmpty());
+
+    ArraySequence<int> target;
+    EXPECT_EQ(buffer.drainInto(target), 4);
+    EXPECT_EQ(target.getLength(), 4);
+
+    producer.flush();
+    EXPECT_EQ(buffer.drainInto(target), 2);
+    EXPECT_EQ(target.getLength(), 6);
+    for (int i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(target[i], i);
+    }
+    EXPECT_TRUE(buffer.isEmpty());
+}
+
+TEST(AppendBufferTest, DrainAppendsAfterExistingItems)
+{
+    AppendBuffer<int> buffer(2);
+    DynamicArray<int> target;
+    target.append(-1);
+    {
+        AppendBuffer<int>::Producer producer(buffer);
+        producer.append(1);
+        producer.append(2);
+        producer.append(3);
+    }
+
+    EXPECT_EQ(buffer.drainInto(target), 3);
+    EXPECT_EQ(target.getSize(), 4);
+    EXPECT_EQ(target[0], -1);
+    EXPECT_EQ(target[1], 1);
+    EXPECT_EQ(target[3], 3);
+    EXPECT_EQ(buffer.drainInto(target), 0);
+}
+
+TEST(AppendBufferTest, FailedDrainKeepsChunksInOrder)
+{
+    std::size_t limit = 2;
+    DynamicArray<int, LimitedAllocator<int>> target((LimitedAllocator<int>(&limit)));
+    AppendBuffer<int> buffer(2);
+    AppendBuffer<int>::Producer producer(buffer);
+    for (int i = 0; i < 5; i++)
+    {
+        producer.append(i);
+    }
+
+    EXPECT_THROW(buffer.drainInto(target), std::bad_alloc);
+    EXPECT_EQ(target.getSize(), 0);
+    EXPECT_FALSE(buffer.isEmpty());
+
+    producer.append(5);
+    limit = 64;
+    EXPECT_EQ(buffer.drainInto(target), 6);
+    for (int i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(target[i], i);
+    }
+}
+
+TEST(AppendBufferTest, FailedDrainsKeepConcurrentProducerInOrder)
+{
+    const int count = 1000000;
+    std::size_t limit = 64;
+    DynamicArray<int, LimitedAllocator<int>> target((LimitedAllocator<int>(&limit)));
+    limit = 0;
+    AppendBuffer<int> buffer(2);
+    std::atomic<bool> done(false);
+    std::thread writer([&buffer, &done, count]()
+                       {
+        AppendBuffer<int>::Producer producer(buffer);
+        for (int i = 0; i < count; i++)
+        {
+            producer.append(i);
+        }
+        producer.flush();
+        done = true; });
+
+    while (!done)
+    {
+        try
+        {
+            buffer.drainInto(target);
+        }
+        catch (const std::bad_alloc &)
+        {
+        }
+    }
+    writer.join();
+
+    limit = 2 * count;
+    EXPECT_EQ(buffer.drainInto(target), count);
+    for (int i = 0; i < count; i++)
+    {
+        ASSERT_EQ(target[i], i);
+    }
+}
+
+TEST(AppendBufferTest, DrainKeepsAttachedIndexCurrent)
+{
+    AppendBuffer<int> buffer(64);
+    {
+        AppendBuffer<int>::Producer producer(buffer);
+        for (int i = 100; i <= 1000; i++)
+        {
+            producer.append(i);
+        }
+    }
+
+    ArraySequence<int> target;
+    target.append(1);
+    target.attachIndex();
+    EXPECT_EQ(buffer.drainInto(target), 901);
+    EXPECT_TRUE(target.contains(500));
+    EXPECT_FALSE(target.contains(0));
+    EXPECT_EQ(target.indexOf(1000), 901);
+}
+
+TEST(AppendBufferTest, DrainKeepsAttachedSummaryCurrent)
+{
+    AppendBuffer<int> buffer(256);
+    {
+        AppendBuffer<int>::Producer producer(buffer);
+        for (int i = 100; i < 10100; i++)
+        {
+            producer.append(i);
+        }
+    }
+
+    ArraySequence<int> target;
+    target.attachSummary();
+    buffer.drainInto(target);
+    EXPECT_TRUE(target.contains(5000));
+    EXPECT_FALSE(target.contains(0));
+    std::unique_ptr<ArraySequence<int>> range(target.filterRange(9000, 9999));
+    EXPECT_EQ(range->getLength(), 1000);
+}
+
+TEST(AppendBufferTest, ConcurrentProducersKeepPerProducerOrder)
+{
+    const int producers = 8;
+    const int perProducer = 10000;
+    AppendBuffer<int> buffer(64);
+    ArraySequence<int> target;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++)
+    {
+        threads.push_back(std::thread([&buffer, p, perProducer]()
+                                      {
+            AppendBuffer<int>::Producer producer(buffer);
+            for (int i = 0; i < perProducer; i++)
+            {
+                producer.append(p * perProducer + i);
+            } }));
+    }
+
+    std::thread drainer([&buffer, &target]()
+                        {
+        for (int i = 0; i < 100; i++)
+        {
+            buffer.drainInto(target);
+            std::this_thread::yield();
+        } });
+
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+    drainer.join();
+    buffer.drainInto(target);
+
+    ASSERT_EQ(target.getLength(), producers * perProducer);
+    std::vector<int> last(producers, -1);
+    for (int i = 0; i < target.getLength(); i++)
+    {
+        int producer = target[i] / perProducer;
+        int value = target[i] % perProducer;
+        EXPECT_EQ(value, last[producer] + 1);
+        last[producer] = value;
+    }
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
 
 TEST(ArraySequenceTest, DefaultConstructorCreatesEmptySequence)
 {
@@ -310,3 +311,78 @@ TEST(ArraySequenceTest, ConcatImmutableWithNullDoesNotThrow)
     ArraySequence<int> seq;
     EXPECT_NO_THROW(seq.concatImmutable(nullptr));
 }
+
+TEST(ArraySequenceTest, RangeInsertionWalksLinkedSourcesInOrder)
+{
+    ListSequence<int> list;
+    for (int i = 0; i < 1000; i++)
+    {
+        list.append(i);
+    }
+    int items[] = {-2, -1};
+    ArraySequence<int> seq(items, 2);
+    seq.insertRange(1, &list);
+    ASSERT_EQ(seq.getLength(), 1002);
+    EXPECT_EQ(seq[0], -2);
+    EXPECT_EQ(seq[1], 0);
+    EXPECT_EQ(seq[1000], 999);
+    EXPECT_EQ(seq[1001], -1);
+
+    list.insertRange(500, &seq);
+    list.concat(&list);
+    ASSERT_EQ(list.getLength(), 4004);
+    EXPECT_EQ(list.get(499), 499);
+    EXPECT_EQ(list.get(500), -2);
+    EXPECT_EQ(list.get(1502), 500);
+    EXPECT_EQ(list.get(2002 + 501), 0);
+}
+
+TEST(ArraySequenceTest, RangeInsertionFromArrayAndSequence)
+{
+    int items[] = {1, 6};
+    int middle[] = {2, 3};
+    ArraySequence<int> seq(items, 2);
+
+    seq.insertRange(1, middle, 2);
+    ArraySequence<int> tail;
+    tail.append(4);
+    tail.append(5);
+    seq.insertRange(3, &tail);
+
+    ASSERT_EQ(seq.getLength(), 6);
+    for (int i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(seq[i], i + 1);
+    }
+
+    Sequence<int> &generic = seq;
+    int zero = 0;
+    generic.prependRange(&zero, 1);
+    generic.appendRange(&tail);
+    EXPECT_EQ(seq.getFirst(), 0);
+    EXPECT_EQ(seq.getLength(), 9);
+    EXPECT_EQ(seq.getLast(), 5);
+
+    EXPECT_THROW(seq.insertRange(20, middle, 2), std::out_of_range);
+    const Sequence<int> *none = nullptr;
+    EXPECT_NO_THROW(seq.insertRange(0, none));
+    EXPECT_EQ(seq.getLength(), 9);
+    EXPECT_THROW(seq.insertRange(20, none), std::out_of_range);
+    ListSequence<int> list;
+    EXPECT_NO_THROW(list.insertRange(0, none));
+    EXPECT_NO_THROW(list.concat(none));
+    EXPECT_EQ(list.getLength(), 0);
+    EXPECT_NO_THROW(generic.Sequence<int>::insertRange(9, none));
+    EXPECT_EQ(seq.getLength(), 9);
+}
+
+TEST(ArraySequenceTest, AppendRangeOfItself)
+{
+    int items[] = {1, 2, 3};
+    ArraySequence<int> seq(items, 3);
+
+    seq.appendRange(&seq);
+    ASSERT_EQ(seq.getLength(), 6);
+    EXPECT_EQ(seq[3], 1);
+    EXPECT_EQ(seq[5], 3);
+}
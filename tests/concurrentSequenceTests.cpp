@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "../inc/concurrentSequence.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+
+TEST(ConcurrentSequenceTest, ForwardsOperationsToWrappedSequence)
+{
+    ConcurrentSequence<int> seq(new ArraySequence<int>());
+    seq.append(2);
+    seq.prepend(1);
+    seq.insertAt(3, 2);
+    seq.set(0, 10);
+
+    EXPECT_EQ(seq.getLength(), 3);
+    EXPECT_EQ(seq.getFirst(), 10);
+    EXPECT_EQ(seq.get(1), 2);
+    EXPECT_EQ(seq.getLast(), 3);
+    EXPECT_THROW(seq.get(3), std::out_of_range);
+}
+
+TEST(ConcurrentSequenceTest, RejectsNullSequence)
+{
+    EXPECT_THROW(ConcurrentSequence<int>(nullptr), std::invalid_argument);
+}
+
+TEST(ConcurrentSequenceTest, BatchOperationsAppendInOrder)
+{
+    ConcurrentSequence<int> seq(new ListSequence<int>());
+    int items[] = {1, 2, 3};
+    seq.appendAll(items, 3);
+
+    ArraySequence<int> more(items, 2);
+    seq.appendAll(more);
+    seq.concat(&more);
+
+    EXPECT_EQ(seq.getLength(), 7);
+    EXPECT_EQ(seq.get(3), 1);
+    EXPECT_EQ(seq.getLast(), 2);
+    EXPECT_THROW(seq.appendAll(nullptr, 1), std::invalid_argument);
+}
+
+TEST(ConcurrentSequenceTest, AppendAllWalksLinkedSourcesAndItself)
+{
+    std::vector<int> items(20000);
+    for (int i = 0; i < 20000; i++)
+    {
+        items[i] = i;
+    }
+    ListSequence<int> source(items.data(), 20000);
+    ArraySequence<int> *wrapped = new ArraySequence<int>();
+    ConcurrentSequence<int> seq(wrapped);
+    seq.appendAll(source);
+    EXPECT_EQ(seq.getLength(), 20000);
+    EXPECT_EQ(seq.get(12345), 12345);
+
+    seq.appendAll(*wrapped);
+    EXPECT_EQ(seq.getLength(), 40000);
+    EXPECT_EQ(seq.get(20000), 0);
+    EXPECT_EQ(seq.getLast(), 19999);
+}
+
+TEST(ConcurrentSequenceTest, WithLockRunsAtomically)
+{
+    ConcurrentSequence<int> seq(new ArraySequence<int>());
+    int length = seq.withLock([](Sequence<int> &inner)
+                              {
+        inner.append(1);
+        inner.append(2);
+        return inner.getLength(); });
+    EXPECT_EQ(length, 2);
+
+    int sum = seq.withSharedLock([](const Sequence<int> &inner)
+                                 { return inner.get(0) + inner.get(1); });
+    EXPECT_EQ(sum, 3);
+}
+
+TEST(ConcurrentSequenceTest, ConcurrentWritersAndReadersStayConsistent)
+{
+    const int writers = 4;
+    const int readers = 4;
+    const int perWriter = 2000;
+    ConcurrentSequence<int> seq(new ArraySequence<int>());
+
+    std::vector<std::thread> threads;
+    for (int w = 0; w < writers; w++)
+    {
+        threads.push_back(std::thread([&seq, w, perWriter]()
+                                      {
+            int batch[10];
+            for (int i = 0; i < perWriter; i += 10)
+            {
+                for (int j = 0; j < 10; j++)
+                {
+                    batch[j] = w;
+                }
+                if (i % 20 == 0)
+                {
+                    seq.appendAll(batch, 10);
+                }
+                else
+                {
+                    for (int j = 0; j < 10; j++)
+                    {
+                        seq.append(batch[j]);
+                    }
+                }
+            } }));
+    }
+
+    bool readerFailed = false;
+    std::vector<char> readerResults(readers, 0);
+    for (int r = 0; r < readers; r++)
+    {
+        threads.push_back(std::thread([&seq, &readerResults, r, writers]()
+                                      {
+            bool ok = true;
+            for (int i = 0; i < 2000; i++)
+            {
+                ok = seq.withSharedLock([writers](const Sequence<int> &inner)
+                                        {
+                    int length = inner.getLength();
+                    return length == 0 || (inner.get(length - 1) >= 0 && inner.get(length - 1) < writers); }) && ok;
+            }
+            readerResults[r] = ok ? 1 : 0; }));
+    }
+
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+    for (int r = 0; r < readers; r++)
+    {
+        readerFailed = readerFailed || !readerResults[r];
+    }
+
+    EXPECT_FALSE(readerFailed);
+    EXPECT_EQ(seq.getLength(), writers * perWriter);
+
+    std::vector<int> counts(writers, 0);
+    for (int i = 0; i < seq.getLength(); i++)
+    {
+        counts[seq.get(i)]++;
+    }
+    for (int w = 0; w < writers; w++)
+    {
+        EXPECT_EQ(counts[w], perWriter);
+    }
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+#include "../inc/segmentedArraySequence.hpp"
+
+TEST(ContainerStatsTest, DynamicArrayCountsAllocationsAndReallocations)
+{
+    resetAllStats();
+    {
+        DynamicArray<int> array;
+        for (int i = 0; i < 100; i++)
+        {
+            array.append(i);
+        }
+
+        StatsSnapshot stats = snapshotStats<DynamicArray<int>>();
+        EXPECT_EQ(stats.reallocations, 7u);
+        EXPECT_EQ(stats.allocations, 8u);
+        EXPECT_EQ(stats.frees, 7u);
+        EXPECT_EQ(stats.bytesAllocated, sizeof(int) * 255);
+        EXPECT_EQ(stats.elementCopies, 127u);
+        EXPECT_EQ(stats.bytesCopied, sizeof(int) * 127);
+    }
+    EXPECT_EQ(snapshotStats<DynamicArray<int>>().frees, 8u);
+}
+
+TEST(ContainerStatsTest, ShiftsAreCountedAsMoves)
+{
+    int items[] = {1, 2, 3, 4, 5};
+    ArraySequence<int> seq(items, 5);
+    resetStats<DynamicArray<int>>();
+
+    seq.prepend(0);
+    seq.insertAt(9, 3);
+    StatsSnapshot stats = snapshotStats<DynamicArray<int>>();
+    EXPECT_EQ(stats.elementMoves, 5u + 3u);
+    EXPECT_EQ(stats.reallocations, 1u);
+}
+
+TEST(ContainerStatsTest, ListCountsNodesAndTraversalSteps)
+{
+    resetAllStats();
+    {
+        ListSequence<double> seq;
+        for (int i = 0; i < 10; i++)
+        {
+            seq.prepend(i);
+        }
+        seq.get(7);
+        seq.set(4, 1.5);
+
+        StatsSnapshot stats = snapshotStats<LinkedList<double>>();
+        EXPECT_EQ(stats.allocations, 10u);
+        EXPECT_EQ(stats.frees, 0u);
+        EXPECT_EQ(stats.traversalSteps, 11u);
+        EXPECT_GE(stats.bytesAllocated, sizeof(double) * 10);
+    }
+    EXPECT_EQ(snapshotStats<LinkedList<double>>().frees, 10u);
+}
+
+TEST(ContainerStatsTest, ResetClearsCounters)
+{
+    DynamicArray<int> array(100);
+    EXPECT_GT(snapshotStats<DynamicArray<int>>().allocations, 0u);
+
+    resetAllStats();
+    StatsSnapshot stats = snapshotStats<DynamicArray<int>>();
+    EXPECT_EQ(stats.allocations, 0u);
+    EXPECT_EQ(stats.bytesAllocated, 0u);
+}
+
+TEST(ContainerStatsTest, JsonReportListsEveryContainerType)
+{
+    SegmentedArraySequence<char> segmented;
+    segmented.append('a');
+    DynamicArray<long> array;
+    array.append(1);
+
+    std::ostringstream out;
+    writeStatsJson(out);
+    std::string json = out.str();
+
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_NE(json.find("\"DynamicArray<long"), std::string::npos);
+    EXPECT_NE(json.find("{\"allocations\": "), std::string::npos);
+    EXPECT_NE(json.find("\"SegmentedArraySequence<char>\""), std::string::npos);
+    EXPECT_NE(json.find("\"traversalSteps\": "), std::string::npos);
+}
+
+TEST(ContainerStatsTest, TransientCopiesOnceForABatch)
+{
+    ArraySequence<int> seq;
+    for (int i = 0; i < 1000; i++)
+    {
+        seq.append(i);
+    }
+
+    resetStats<DynamicArray<int>>();
+    Sequence<int> *current = seq.clone();
+    for (int i = 0; i < 10; i++)
+    {
+        Sequence<int> *next = current->setImmutable(i, -i);
+        delete current;
+        current = next;
+    }
+    delete current;
+    std::size_t chainedCopies = snapshotStats<DynamicArray<int>>().elementCopies;
+
+    resetStats<DynamicArray<int>>();
+    Transient<int> transient = seq.transient();
+    for (int i = 0; i < 10; i++)
+    {
+        transient.set(i, -i);
+    }
+    delete transient.freeze();
+    EXPECT_EQ(snapshotStats<DynamicArray<int>>().elementCopies, 1000u);
+    EXPECT_EQ(chainedCopies, 11000u);
+}
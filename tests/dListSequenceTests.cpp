@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "../inc/dListSequence.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+#include "../inc/poolListSequence.hpp"
+
+TEST(DListSequenceTest, ImplementsSequenceInterface)
+{
+    int items[] = {1, 2, 3};
+    DListSequence<int> seq(items, 3);
+    Sequence<int> *base = &seq;
+
+    base->append(4);
+    base->prepend(0);
+    base->insertAt(9, 2);
+    base->set(0, -1);
+
+    ASSERT_EQ(base->getLength(), 6);
+    EXPECT_EQ(base->getFirst(), -1);
+    EXPECT_EQ(base->getLast(), 4);
+    EXPECT_EQ(base->get(2), 9);
+    EXPECT_EQ(base->get(4), 3);
+    EXPECT_THROW(base->get(6), std::out_of_range);
+    EXPECT_THROW(base->insertAt(0, 7), std::out_of_range);
+}
+
+TEST(DListSequenceTest, RemovesAtBothEnds)
+{
+    int items[] = {1, 2, 3, 4};
+    DListSequence<int> seq(items, 4);
+    seq.removeFirst();
+    seq.removeLast();
+    seq.removeAt(1);
+
+    ASSERT_EQ(seq.getLength(), 1);
+    EXPECT_EQ(seq.getFirst(), 2);
+    EXPECT_EQ(seq.getLast(), 2);
+}
+
+TEST(DListSequenceTest, ReverseIterationAndConcat)
+{
+    int items[] = {1, 2, 3};
+    DListSequence<int> seq(items, 3);
+    ArraySequence<int> other(items, 3);
+
+    seq.concat(&other);
+    seq.concat(&seq);
+    ASSERT_EQ(seq.getLength(), 12);
+
+    std::vector<int> backwards(seq.rbegin(), seq.rend());
+    EXPECT_EQ(backwards.front(), 3);
+    EXPECT_EQ(backwards.back(), 1);
+    EXPECT_EQ(backwards.size(), 12u);
+}
+
+TEST(DListSequenceTest, RangeInsertionWalksLinkedSourcesInOrder)
+{
+    ListSequence<int> list;
+    PoolListSequence<int> pool;
+    for (int i = 0; i < 1000; i++)
+    {
+        list.append(i);
+        pool.append(-i);
+    }
+    int items[] = {7, 8};
+    DListSequence<int> seq(items, 2);
+    seq.insertRange(1, &list);
+    seq.insertRange(seq.getLength(), &pool);
+
+    ASSERT_EQ(seq.getLength(), 2002);
+    EXPECT_EQ(seq.get(0), 7);
+    EXPECT_EQ(seq.get(1), 0);
+    EXPECT_EQ(seq.get(1000), 999);
+    EXPECT_EQ(seq.get(1001), 8);
+    EXPECT_EQ(seq.getLast(), -999);
+
+    EXPECT_NO_THROW(seq.concat(nullptr));
+    EXPECT_EQ(seq.getLength(), 2002);
+    EXPECT_THROW(seq.insertRange(-1, static_cast<const Sequence<int> *>(nullptr)), std::out_of_range);
+}
+
+TEST(DListSequenceTest, ImmutableOperationsLeaveOriginalUntouched)
+{
+    int items[] = {1, 2, 3};
+    DListSequence<int> seq(items, 3);
+
+    Sequence<int> *appended = seq.appendImmutable(4);
+    Sequence<int> *changed = seq.setImmutable(2, 30);
+    Sequence<int> *sub = seq.getSubsequence(1, 2);
+
+    EXPECT_EQ(seq.getLast(), 3);
+    EXPECT_EQ(appended->getLast(), 4);
+    EXPECT_EQ(changed->getLast(), 30);
+    ASSERT_EQ(sub->getLength(), 2);
+    EXPECT_EQ(sub->getFirst(), 2);
+
+    delete appended;
+    delete changed;
+    delete sub;
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../inc/doublyLinkedList.hpp"
+
+TEST(DoublyLinkedListTest, DefaultConstructorCreatesEmptyList)
+{
+    DoublyLinkedList<int> list;
+    EXPECT_EQ(list.getLength(), 0);
+    EXPECT_TRUE(list.begin() == list.end());
+    EXPECT_THROW(list.getFirst(), std::out_of_range);
+    EXPECT_THROW(list.getLast(), std::out_of_range);
+    EXPECT_THROW(list.removeFirst(), std::out_of_range);
+    EXPECT_THROW(list.removeLast(), std::out_of_range);
+}
+
+TEST(DoublyLinkedListTest, PushAndPopAtBothEnds)
+{
+    DoublyLinkedList<int> list;
+    list.append(2);
+    list.append(3);
+    list.prepend(1);
+    list.prepend(0);
+
+    EXPECT_EQ(list.getFirst(), 0);
+    EXPECT_EQ(list.getLast(), 3);
+    ASSERT_EQ(list.getLength(), 4);
+
+    list.removeLast();
+    list.removeFirst();
+    EXPECT_EQ(list.getFirst(), 1);
+    EXPECT_EQ(list.getLast(), 2);
+
+    list.removeLast();
+    list.removeLast();
+    EXPECT_EQ(list.getLength(), 0);
+    list.append(5);
+    EXPECT_EQ(list.getFirst(), 5);
+    EXPECT_EQ(list.getLast(), 5);
+}
+
+TEST(DoublyLinkedListTest, GetAndSetReachBothHalves)
+{
+    int items[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    DoublyLinkedList<int> list(items, 9);
+    for (int i = 0; i < 9; i++)
+    {
+        EXPECT_EQ(list.get(i), i);
+    }
+
+    list.set(1, 10);
+    list.set(7, 70);
+    EXPECT_EQ(list.get(1), 10);
+    EXPECT_EQ(list.get(7), 70);
+    EXPECT_THROW(list.get(9), std::out_of_range);
+    EXPECT_THROW(list.set(-1, 0), std::out_of_range);
+    EXPECT_THROW(DoublyLinkedList<int>(nullptr, 1), std::invalid_argument);
+}
+
+TEST(DoublyLinkedListTest, IteratorsMoveInBothDirections)
+{
+    int items[] = {1, 2, 3, 4};
+    DoublyLinkedList<int> list(items, 4);
+
+    std::vector<int> backwards;
+    for (DoublyLinkedList<int>::ReverseIterator it = list.rbegin(); it != list.rend(); ++it)
+    {
+        backwards.push_back(*it);
+    }
+    EXPECT_EQ(backwards, std::vector<int>({4, 3, 2, 1}));
+
+    DoublyLinkedList<int>::Iterator it = list.end();
+    --it;
+    EXPECT_EQ(*it, 4);
+    it--;
+    EXPECT_EQ(*it, 3);
+
+    const DoublyLinkedList<int> &view = list;
+    DoublyLinkedList<int>::ConstIterator last = view.end();
+    --last;
+    EXPECT_EQ(*last, 4);
+    EXPECT_EQ(*view.rbegin(), 4);
+}
+
+TEST(DoublyLinkedListTest, InsertAndEraseThroughIterators)
+{
+    int items[] = {1, 2, 3, 4, 5, 6};
+    DoublyLinkedList<int> list(items, 6);
+
+    for (DoublyLinkedList<int>::Iterator it = list.begin(); it != list.end();)
+    {
+        if (*it % 2 == 0)
+        {
+            it = list.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    ASSERT_EQ(list.getLength(), 3);
+    EXPECT_EQ(list.getLast(), 5);
+
+    DoublyLinkedList<int>::Iterator inserted = list.insert(list.end(), 7);
+    EXPECT_EQ(*inserted, 7);
+    list.insert(list.begin(), 0);
+
+    std::ostringstream out;
+    out << list;
+    EXPECT_EQ(out.str(), "[0], [1], [3], [5], [7]");
+
+    DoublyLinkedList<int> other;
+    EXPECT_THROW(other.erase(list.begin()), std::invalid_argument);
+    EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+}
+
+TEST(DoublyLinkedListTest, InsertAtAndRemoveAtKeepLinksConsistent)
+{
+    DoublyLinkedList<std::string> list;
+    list.insertAt("b", 0);
+    list.insertAt("d", 1);
+    list.insertAt("a", 0);
+    list.insertAt("c", 2);
+    list.insertAt("e", 4);
+    EXPECT_THROW(list.insertAt("x", 6), std::out_of_range);
+
+    list.removeAt(2);
+    list.removeAt(3);
+    ASSERT_EQ(list.getLength(), 3);
+    EXPECT_EQ(list.get(0), "a");
+    EXPECT_EQ(list.get(1), "b");
+    EXPECT_EQ(list.get(2), "d");
+    EXPECT_EQ(list.getLast(), "d");
+    EXPECT_EQ(*list.rbegin(), "d");
+}
+
+TEST(DoublyLinkedListTest, RangesSpliceAndConcat)
+{
+    int items[] = {1, 5};
+    int middle[] = {2, 3, 4};
+    DoublyLinkedList<int> list(items, 2);
+    list.insertRange(1, middle, 3);
+    list.appendRange(middle, 1);
+    list.prependRange(middle, 1);
+    EXPECT_THROW(list.insertRange(10, middle, 1), std::out_of_range);
+
+    int expected[] = {2, 1, 2, 3, 4, 5, 2};
+    ASSERT_EQ(list.getLength(), 7);
+    for (int i = 0; i < 7; i++)
+    {
+        EXPECT_EQ(list.get(i), expected[i]);
+    }
+
+    DoublyLinkedList<int> tail(middle, 3);
+    list.concat(tail);
+    EXPECT_EQ(tail.getLength(), 3);
+    EXPECT_EQ(list.getLast(), 4);
+    EXPECT_THROW(list.concat(list), std::invalid_argument);
+
+    list.splice(list.getLength(), tail);
+    EXPECT_EQ(tail.getLength(), 0);
+    EXPECT_EQ(list.getLength(), 13);
+    EXPECT_EQ(list.getLast(), 4);
+}
+
+TEST(DoublyLinkedListTest, ReverseSwapsEnds)
+{
+    int items[] = {1, 2, 3};
+    DoublyLinkedList<int> list(items, 3);
+    list.reverse();
+
+    EXPECT_EQ(list.getFirst(), 3);
+    EXPECT_EQ(list.getLast(), 1);
+    EXPECT_EQ(list.get(1), 2);
+    list.append(0);
+    EXPECT_EQ(*list.rbegin(), 0);
+}
+
+TEST(DoublyLinkedListTest, CopyMoveAndSubList)
+{
+    int items[] = {1, 2, 3, 4};
+    DoublyLinkedList<int> original(items, 4);
+    DoublyLinkedList<int> copy(original);
+    copy.set(0, 10);
+    EXPECT_EQ(original.getFirst(), 1);
+
+    DoublyLinkedList<int> moved(std::move(copy));
+    EXPECT_EQ(copy.getLength(), 0);
+    EXPECT_EQ(moved.getFirst(), 10);
+
+    DoublyLinkedList<int> assigned;
+    assigned = original;
+    EXPECT_EQ(assigned.getLast(), 4);
+
+    DoublyLinkedList<int> *sub = original.getSubList(1, 2);
+    ASSERT_EQ(sub->getLength(), 2);
+    EXPECT_EQ(sub->getFirst(), 2);
+    EXPECT_EQ(sub->getLast(), 3);
+    EXPECT_THROW(original.getSubList(2, 1), std::out_of_range);
+    delete sub;
+}
@@ -282,4 +282,41 @@ TEST(DynamicArrayTest, PrintDoesNotCrash)
 
     // Just verify it doesn't crash
     arr.print();
-}
\ No newline at end of file
+}
+TEST(DynamicArrayTest, InsertRangeShiftsTailOnce)
+{
+    int items[] = {1, 2, 5, 6};
+    int middle[] = {3, 4};
+    DynamicArray<int> array(items, 4);
+
+    array.insertRange(2, middle, 2);
+    ASSERT_EQ(array.getSize(), 6);
+    for (int i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(array[i], i + 1);
+    }
+
+    int edges[] = {0, 7};
+    array.prependRange(edges, 1);
+    array.appendRange(edges + 1, 1);
+    EXPECT_EQ(array.getFirst(), 0);
+    EXPECT_EQ(array.getLast(), 7);
+
+    EXPECT_THROW(array.insertRange(9, middle, 2), std::out_of_range);
+    EXPECT_THROW(array.insertRange(0, nullptr, 2), std::invalid_argument);
+    EXPECT_NO_THROW(array.insertRange(0, nullptr, 0));
+}
+
+TEST(DynamicArrayTest, InsertRangeFromOwnStorage)
+{
+    int items[] = {1, 2, 3};
+    DynamicArray<int> array(items, 3);
+
+    array.insertRange(1, array.getData(), array.getSize());
+    ASSERT_EQ(array.getSize(), 6);
+    int expected[] = {1, 1, 2, 3, 2, 3};
+    for (int i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(array[i], expected[i]);
+    }
+}
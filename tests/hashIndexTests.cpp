@@ -0,0 +1,276 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include "../inc/hashIndex.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+#include "../inc/dListSequence.hpp"
+#include "../inc/poolListSequence.hpp"
+#include "../inc/ropeSequence.hpp"
+#include "../inc/segmentedArraySequence.hpp"
+
+namespace
+{
+    template <class S>
+    void expectScanLookups(S &seq)
+    {
+        EXPECT_EQ(seq.indexOf(3), -1);
+        EXPECT_FALSE(seq.contains(3));
+        int items[] = {5, 3, 7, 3, 9};
+        for (int item : items)
+        {
+            seq.append(item);
+        }
+        EXPECT_EQ(seq.indexOf(3), 1);
+        EXPECT_EQ(seq.lastIndexOf(3), 3);
+        EXPECT_EQ(seq.indexOf(9), 4);
+        EXPECT_TRUE(seq.contains(5));
+        EXPECT_FALSE(seq.contains(4));
+        EXPECT_EQ(seq.lastIndexOf(4), -1);
+    }
+
+    struct Mod10Hash
+    {
+        std::size_t operator()(const int value) const { return static_cast<std::size_t>(value % 10); }
+    };
+
+    struct Mod10Equal
+    {
+        bool operator()(const int a, const int b) const { return a % 10 == b % 10; }
+    };
+
+    template <class S>
+    void expectIndexMatchesScan(const S &seq, const int values)
+    {
+        for (int v = 0; v < values; v++)
+        {
+            SequenceIndex first = -1;
+            SequenceIndex last = -1;
+            for (SequenceIndex i = 0; i < seq.getLength(); i++)
+            {
+                if (seq.get(i) == v)
+                {
+                    if (first < 0)
+                    {
+                        first = i;
+                    }
+                    last = i;
+                }
+            }
+            ASSERT_EQ(seq.indexOf(v), first) << "value " << v;
+            ASSERT_EQ(seq.lastIndexOf(v), last) << "value " << v;
+        }
+    }
+
+    template <class S>
+    void runRandomEdits(S &seq)
+    {
+        std::mt19937 random(7);
+        for (int step = 0; step < 2000; step++)
+        {
+            int value = static_cast<int>(random() % 40);
+            SequenceIndex length = seq.getLength();
+            switch (random() % 4)
+            {
+            case 0:
+                seq.append(value);
+                break;
+            case 1:
+                seq.prepend(value);
+                break;
+            case 2:
+                seq.insertAt(value, static_cast<SequenceIndex>(random() % (length + 1)));
+                break;
+            default:
+                if (length > 0)
+                {
+                    seq.set(static_cast<SequenceIndex>(random() % length), value);
+                }
+                break;
+            }
+            if (step % 100 == 0)
+            {
+                expectIndexMatchesScan(seq, 40);
+            }
+        }
+        expectIndexMatchesScan(seq, 40);
+    }
+}
+
+TEST(SequenceSearchTest, LinearScanOnEverySequence)
+{
+    ArraySequence<int> array;
+    ListSequence<int> list;
+    DListSequence<int> dlist;
+    PoolListSequence<int> pool;
+    PoolListSequence<int, true> xorPool;
+    RopeSequence<int> rope;
+    SegmentedArraySequence<int> segmented;
+    expectScanLookups(array);
+    expectScanLookups(list);
+    expectScanLookups(dlist);
+    expectScanLookups(pool);
+    expectScanLookups(xorPool);
+    expectScanLookups(rope);
+    expectScanLookups(segmented);
+}
+
+TEST(SequenceSearchTest, ScanCrossesSegmentedBlocks)
+{
+    SegmentedArraySequence<int> seq;
+    for (int i = 0; i < 100; i++)
+    {
+        seq.append(i);
+    }
+    EXPECT_EQ(seq.indexOf(7), 7);
+    EXPECT_EQ(seq.indexOf(8), 8);
+    EXPECT_EQ(seq.indexOf(99), 99);
+    EXPECT_EQ(seq.indexOf(100), -1);
+}
+
+TEST(HashIndexTest, TracksFirstLastAndCount)
+{
+    int items[] = {4, 1, 4, 2, 4};
+    ArraySequence<int> seq(items, 5);
+    HashIndex<int> index;
+    index.rebuild(seq);
+    EXPECT_EQ(index.getDistinct(), 3);
+    EXPECT_EQ(index.first(4), 0);
+    EXPECT_EQ(index.last(4), 4);
+    EXPECT_EQ(index.count(4), 3);
+    EXPECT_EQ(index.first(3), -1);
+    EXPECT_EQ(index.count(3), 0);
+
+    index.shift(0, 2);
+    EXPECT_EQ(index.first(1), 3);
+    index.shift(4, 10);
+    EXPECT_EQ(index.first(4), 2);
+    EXPECT_EQ(index.last(4), 16);
+}
+
+TEST(HashIndexTest, GrowsAndStaysAtMostHalfFull)
+{
+    HashIndex<int> index;
+    for (int i = 0; i < 10000; i++)
+    {
+        index.add(i * 7919, i);
+    }
+    EXPECT_EQ(index.getDistinct(), 10000);
+    EXPECT_LE(index.getDistinct() * 2, index.getCapacity());
+    for (int i = 0; i < 10000; i++)
+    {
+        ASSERT_EQ(index.first(i * 7919), i);
+    }
+    index.clear();
+    EXPECT_EQ(index.getDistinct(), 0);
+    EXPECT_EQ(index.first(0), -1);
+}
+
+TEST(HashIndexTest, CustomHashAndEqual)
+{
+    ArraySequence<int> seq;
+    seq.attachIndex(Mod10Hash(), Mod10Equal());
+    seq.append(13);
+    seq.append(25);
+    EXPECT_EQ(seq.indexOf(3), 0);
+    EXPECT_EQ(seq.indexOf(105), 1);
+    EXPECT_FALSE(seq.contains(7));
+}
+
+TEST(HashIndexTest, ArraySequenceStaysConsistentThroughEdits)
+{
+    ArraySequence<int> seq;
+    seq.attachIndex();
+    EXPECT_TRUE(seq.hasIndex());
+    runRandomEdits(seq);
+}
+
+TEST(HashIndexTest, ListSequenceStaysConsistentThroughEdits)
+{
+    ListSequence<int> seq;
+    seq.attachIndex();
+    runRandomEdits(seq);
+}
+
+TEST(HashIndexTest, SetMovesFirstAndLastOccurrence)
+{
+    int items[] = {1, 2, 1, 2, 1};
+    ListSequence<int> seq(items, 5);
+    seq.attachIndex();
+    seq.set(0, 2);
+    EXPECT_EQ(seq.indexOf(1), 2);
+    EXPECT_EQ(seq.indexOf(2), 0);
+    seq.set(4, 3);
+    EXPECT_EQ(seq.lastIndexOf(1), 2);
+    seq.set(2, 3);
+    EXPECT_FALSE(seq.contains(1));
+    EXPECT_EQ(seq.indexOf(3), 2);
+    EXPECT_EQ(seq.lastIndexOf(3), 4);
+}
+
+TEST(HashIndexTest, BulkOperationsRebuild)
+{
+    int items[] = {5, 4, 3, 2, 1};
+    ArraySequence<int> seq(items, 5);
+    seq.attachIndex();
+    seq.sort();
+    EXPECT_EQ(seq.indexOf(1), 0);
+    seq.insertRange(0, items, 2);
+    EXPECT_EQ(seq.indexOf(5), 0);
+    EXPECT_EQ(seq.lastIndexOf(5), 6);
+    seq.concat(&seq);
+    EXPECT_EQ(seq.lastIndexOf(5), 13);
+    seq.resize(3);
+    EXPECT_FALSE(seq.contains(3));
+    seq.resize(4);
+    EXPECT_EQ(seq.lastIndexOf(seq.get(3)), 3);
+    seq.clear();
+    EXPECT_FALSE(seq.contains(5));
+
+    ListSequence<int> list(items, 5);
+    list.attachIndex();
+    list.reverse();
+    EXPECT_EQ(list.indexOf(5), 4);
+    list.sort();
+    EXPECT_EQ(list.indexOf(5), 4);
+    list.concat(&list);
+    EXPECT_EQ(list.lastIndexOf(1), 5);
+}
+
+TEST(HashIndexTest, CopiesCarryTheirOwnIndex)
+{
+    int items[] = {1, 2, 3};
+    ArraySequence<int> seq(items, 3);
+    seq.attachIndex();
+    ArraySequence<int> copy(seq);
+    copy.set(0, 9);
+    EXPECT_EQ(seq.indexOf(1), 0);
+    EXPECT_EQ(copy.indexOf(1), -1);
+    EXPECT_EQ(copy.indexOf(9), 0);
+
+    Sequence<int> *appended = seq.appendImmutable(1);
+    EXPECT_EQ(appended->lastIndexOf(1), 3);
+    EXPECT_EQ(seq.lastIndexOf(1), 0);
+    delete appended;
+
+    ArraySequence<int> moved(std::move(copy));
+    EXPECT_TRUE(moved.hasIndex());
+    EXPECT_EQ(moved.indexOf(9), 0);
+
+    moved.detachIndex();
+    EXPECT_FALSE(moved.hasIndex());
+    EXPECT_EQ(moved.indexOf(9), 0);
+}
+
+TEST(HashIndexTest, DirectWritesNeedRebuild)
+{
+    ArraySequence<std::string> seq;
+    seq.attachIndex();
+    seq.append("a");
+    seq.append("b");
+    seq[1] = "c";
+    EXPECT_EQ(seq.indexOf("c"), -1);
+    seq.rebuildIndex();
+    EXPECT_EQ(seq.indexOf("c"), 1);
+    EXPECT_FALSE(seq.contains("b"));
+}
@@ -339,4 +339,61 @@ TEST(LinkedListTest, IteratorEqualityComparison)
     auto end1 = list.end();
     auto end2 = list.end();
     EXPECT_TRUE(end1 == end2);
-}
\ No newline at end of file
+}
+TEST(LinkedListTest, ReverseRelinksNodes)
+{
+    int items[] = {1, 2, 3, 4};
+    LinkedList<int> list(items, 4);
+    list.reverse();
+
+    EXPECT_EQ(list.getLength(), 4);
+    EXPECT_EQ(list.getFirst(), 4);
+    EXPECT_EQ(list.get(1), 3);
+    EXPECT_EQ(list.getLast(), 1);
+
+    LinkedList<int> empty;
+    empty.reverse();
+    EXPECT_EQ(empty.getLength(), 0);
+}
+
+TEST(LinkedListTest, InsertRangeLinksAllNodes)
+{
+    int items[] = {1, 2, 5, 6};
+    int middle[] = {3, 4};
+    LinkedList<int> list(items, 4);
+
+    list.insertRange(2, middle, 2);
+    ASSERT_EQ(list.getLength(), 6);
+    for (int i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(list.get(i), i + 1);
+    }
+
+    int edges[] = {0, 7};
+    list.prependRange(edges, 1);
+    list.appendRange(edges + 1, 1);
+    EXPECT_EQ(list.getFirst(), 0);
+    EXPECT_EQ(list.getLast(), 7);
+    EXPECT_EQ(list.getLength(), 8);
+
+    EXPECT_THROW(list.insertRange(-1, middle, 2), std::out_of_range);
+    EXPECT_THROW(list.insertRange(0, nullptr, 1), std::invalid_argument);
+}
+
+TEST(LinkedListTest, SpliceMovesNodes)
+{
+    int items[] = {1, 4};
+    int middle[] = {2, 3};
+    LinkedList<int> list(items, 2);
+    LinkedList<int> other(middle, 2);
+
+    list.splice(1, other);
+    EXPECT_EQ(other.getLength(), 0);
+    ASSERT_EQ(list.getLength(), 4);
+    EXPECT_EQ(list.get(1), 2);
+    EXPECT_EQ(list.get(2), 3);
+    EXPECT_EQ(list.getLast(), 4);
+
+    EXPECT_THROW(list.splice(0, list), std::invalid_argument);
+    EXPECT_THROW(list.splice(5, other), std::out_of_range);
+}
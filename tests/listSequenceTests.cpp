@@ -330,4 +330,42 @@ TEST(ListSequenceTest, PrintOutputIsCorrect)
     EXPECT_EQ(output, "1 2 3 ");
 }
 
-// Удален тест OperatorBracketsProvidesAccess, так как operator[] не реализован в ListSequence
\ No newline at end of file
+// Удален тест OperatorBracketsProvidesAccess, так как operator[] не реализован в ListSequence
+TEST(ListSequenceTest, RangeInsertionFromArrayAndSequence)
+{
+    int items[] = {1, 6};
+    int middle[] = {2, 3};
+    ListSequence<int> seq(items, 2);
+
+    seq.insertRange(1, middle, 2);
+    ListSequence<int> tail;
+    tail.append(4);
+    tail.append(5);
+    seq.insertRange(3, &tail);
+
+    ASSERT_EQ(seq.getLength(), 6);
+    for (int i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(seq.get(i), i + 1);
+    }
+    EXPECT_EQ(tail.getLength(), 2);
+
+    Sequence<int> &generic = seq;
+    generic.prependRange(&tail);
+    EXPECT_EQ(seq.getFirst(), 4);
+    EXPECT_EQ(seq.getLength(), 8);
+
+    EXPECT_THROW(seq.insertRange(20, middle, 2), std::out_of_range);
+}
+
+TEST(ListSequenceTest, PrependRangeOfItself)
+{
+    int items[] = {1, 2};
+    ListSequence<int> seq(items, 2);
+
+    seq.prependRange(&seq);
+    ASSERT_EQ(seq.getLength(), 4);
+    EXPECT_EQ(seq.get(0), 1);
+    EXPECT_EQ(seq.get(1), 2);
+    EXPECT_EQ(seq.get(2), 1);
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "../inc/arraySequence.hpp"
+#include "../inc/doublyLinkedList.hpp"
+#include "../inc/listSequence.hpp"
+
+static_assert(SEQUENCE_EXCEPTIONS == 0, "noExceptionsTests must be built with -fno-exceptions");
+
+TEST(NoExceptionsTest, TryAccessorsWorkWithoutExceptions)
+{
+    int items[] = {1, 2, 3};
+    ArraySequence<int> array(items, 3);
+    ListSequence<int> list(items, 3);
+
+    long long sum = 0;
+    for (SequenceIndex i = 0; i < 5; i++)
+    {
+        sum += array.tryGet(i).valueOr(100) + list.tryGet(i).valueOr(1000);
+    }
+    EXPECT_EQ(sum, 2212);
+    EXPECT_EQ(array.tryInsertAt(4, 3), SequenceStatus::Ok);
+    EXPECT_EQ(list.trySet(3, 4), SequenceStatus::OutOfRange);
+}
+
+TEST(NoExceptionsTest, ContainersBuildAndCleanUpWithoutExceptions)
+{
+    int items[] = {1, 2, 3};
+    DoublyLinkedList<int> dlist(items, 3);
+    DoublyLinkedList<int> copy(dlist);
+    ArraySequence<int> array(items, 3);
+    array.insertRange(1, &array);
+    EXPECT_EQ(copy.getLength(), 3);
+    EXPECT_EQ(array.getLength(), 6);
+    EXPECT_EQ(array.get(1), 1);
+}
+
+TEST(NoExceptionsDeathTest, FailedChecksAbortWithTheirMessage)
+{
+    ArraySequence<int> array;
+    EXPECT_DEATH(array.get(0), "Index out of range");
+    ListSequence<int> list;
+    EXPECT_DEATH(list.getFirst(), "empty");
+}
@@ -0,0 +1,273 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "../inc/packedIntSequence.hpp"
+#include "../inc/arraySequence.hpp"
+
+namespace
+{
+    template <class T>
+    void expectSameAs(const PackedIntSequence<T> &packed, const ArraySequence<T> &expected)
+    {
+        ASSERT_EQ(packed.getLength(), expected.getLength());
+        for (SequenceIndex i = 0; i < expected.getLength(); i++)
+        {
+            ASSERT_EQ(packed.get(i), expected.get(i)) << "index " << i;
+        }
+    }
+}
+
+TEST(PackedIntSequenceTest, DefaultConstructorCreatesEmptySequence)
+{
+    PackedIntSequence<int> seq;
+    EXPECT_EQ(seq.getLength(), 0);
+    EXPECT_THROW(seq.getFirst(), std::out_of_range);
+    EXPECT_THROW(seq.getLast(), std::out_of_range);
+    EXPECT_THROW(seq.get(0), std::out_of_range);
+    EXPECT_THROW(PackedIntSequence<int>(-1), std::invalid_argument);
+    EXPECT_THROW(PackedIntSequence<int>(nullptr, 1), std::invalid_argument);
+    EXPECT_NO_THROW(seq.concat(nullptr));
+    EXPECT_EQ(seq.getLength(), 0);
+    EXPECT_EQ(PackedIntSequence<int>(300).getLast(), 0);
+}
+
+TEST(PackedIntSequenceTest, SortedIdsPackToAFewBitsPerElement)
+{
+    const int count = 100000;
+    std::mt19937 random(3);
+    ArraySequence<int> expected;
+    PackedIntSequence<int> packed;
+    int id = 1000;
+    for (int i = 0; i < count; i++)
+    {
+        id += 1 + static_cast<int>(random() % 8);
+        expected.append(id);
+        packed.append(id);
+    }
+    expectSameAs(packed, expected);
+    EXPECT_EQ(packed.getBlockCount(), count / PackedIntSequence<int>::BLOCK_SIZE);
+    EXPECT_LT(packed.getPackedBytes() * 4, count * sizeof(int));
+    EXPECT_EQ(packed.getFirst(), expected.getFirst());
+    EXPECT_EQ(packed.getLast(), expected.getLast());
+}
+
+TEST(PackedIntSequenceTest, ExtremeSixtyFourBitValuesRoundTrip)
+{
+    const std::int64_t low = std::numeric_limits<std::int64_t>::min();
+    const std::int64_t high = std::numeric_limits<std::int64_t>::max();
+    ArraySequence<std::int64_t> expected;
+    for (int i = 0; i < 1000; i++)
+    {
+        expected.append(i % 3 == 0 ? low : (i % 3 == 1 ? high : i - 500));
+    }
+    PackedIntSequence<std::int64_t> packed(expected.getData(), expected.getLength());
+    expectSameAs(packed, expected);
+
+    DynamicArray<std::int64_t> decoded(packed.getLength());
+    packed.decodeTo(decoded.getData());
+    for (SequenceIndex i = 0; i < expected.getLength(); i++)
+    {
+        ASSERT_EQ(decoded[i], expected[i]);
+    }
+}
+
+TEST(PackedIntSequenceTest, ConstantBlocksUseNoPayload)
+{
+    PackedIntSequence<int> seq(1024);
+    EXPECT_EQ(seq.getBlockCount(), 8);
+    EXPECT_LT(seq.getPackedBytes(), 1024u);
+    seq.set(500, 7);
+    EXPECT_EQ(seq.get(500), 7);
+    EXPECT_EQ(seq.get(499), 0);
+    EXPECT_EQ(seq.get(501), 0);
+}
+
+TEST(PackedIntSequenceTest, SetWidensBlocksInTheMiddle)
+{
+    std::mt19937 random(5);
+    ArraySequence<int> expected;
+    for (int i = 0; i < 1000; i++)
+    {
+        expected.append(i);
+    }
+    PackedIntSequence<int> packed(expected.getData(), expected.getLength());
+    for (int step = 0; step < 500; step++)
+    {
+        SequenceIndex index = static_cast<SequenceIndex>(random() % expected.getLength());
+        int value = static_cast<int>(random());
+        expected.set(index, value);
+        packed.set(index, value);
+    }
+    expectSameAs(packed, expected);
+    for (int step = 0; step < 300; step++)
+    {
+        SequenceIndex index = static_cast<SequenceIndex>(random() % expected.getLength());
+        expected.set(index, static_cast<int>(index));
+        packed.set(index, static_cast<int>(index));
+    }
+    expectSameAs(packed, expected);
+}
+
+TEST(PackedIntSequenceTest, WritesThroughReferencesAreKept)
+{
+    ArraySequence<int> expected;
+    for (int i = 0; i < 700; i++)
+    {
+        expected.append(i * 2);
+    }
+    PackedIntSequence<int> packed(expected.getData(), expected.getLength());
+    for (SequenceIndex i = 0; i < packed.getLength(); i += 3)
+    {
+        packed.get(i) += 1000000;
+        expected.get(i) += 1000000;
+    }
+    packed.getFirst() = -5;
+    expected.getFirst() = -5;
+    packed.getLast() = 42;
+    expected.getLast() = 42;
+    expectSameAs(packed, expected);
+
+    const PackedIntSequence<int> &view = packed;
+    EXPECT_EQ(view.indexOf(42), 699);
+    EXPECT_EQ(view.indexOf(1000000 + 6), 3);
+    EXPECT_EQ(view.indexOf(1), -1);
+}
+
+TEST(PackedIntSequenceTest, InsertionsMatchArraySequence)
+{
+    std::mt19937 random(9);
+    ArraySequence<int> expected;
+    PackedIntSequence<int> packed;
+    for (int step = 0; step < 600; step++)
+    {
+        int value = static_cast<int>(random() % 1000);
+        SequenceIndex index = static_cast<SequenceIndex>(random() % (expected.getLength() + 1));
+        switch (step % 4)
+        {
+        case 0:
+            expected.prepend(value);
+            packed.prepend(value);
+            break;
+        case 1:
+            expected.insertAt(value, index);
+            packed.insertAt(value, index);
+            break;
+        default:
+            expected.append(value);
+            packed.append(value);
+            break;
+        }
+    }
+    expectSameAs(packed, expected);
+
+    int items[] = {1, 2, 3};
+    expected.insertRange(10, items, 3);
+    packed.insertRange(10, items, 3);
+    expected.concat(&expected);
+    packed.concat(&packed);
+    expectSameAs(packed, expected);
+    EXPECT_THROW(packed.insertAt(1, -1), std::out_of_range);
+    EXPECT_THROW(packed.insertAt(1, packed.getLength() + 1), std::out_of_range);
+}
+
+TEST(PackedIntSequenceTest, CopiesAndImmutableOperationsAreIndependent)
+{
+    ArraySequence<int> expected;
+    for (int i = 0; i < 300; i++)
+    {
+        expected.append(i);
+    }
+    PackedIntSequence<int> packed(expected.getData(), expected.getLength());
+    packed.get(5) = 99;
+    PackedIntSequence<int> copy(packed);
+    packed.get(5) = 5;
+    EXPECT_EQ(copy.get(5), 99);
+    EXPECT_EQ(packed.get(5), 5);
+
+    Sequence<int> *changed = packed.setImmutable(200, -1);
+    Sequence<int> *prepended = packed.prependImmutable(-2);
+    Sequence<int> *sub = packed.getSubsequence(126, 130);
+    EXPECT_EQ(changed->get(200), -1);
+    EXPECT_EQ(packed.get(200), 200);
+    EXPECT_EQ(prepended->getFirst(), -2);
+    EXPECT_EQ(prepended->getLength(), 301);
+    EXPECT_EQ(sub->getLength(), 5);
+    EXPECT_EQ(sub->get(0), 126);
+    EXPECT_EQ(sub->get(4), 130);
+    EXPECT_THROW(packed.getSubsequence(5, 300), std::out_of_range);
+    delete changed;
+    delete prepended;
+    delete sub;
+
+    copy = packed;
+    EXPECT_EQ(copy.get(5), 5);
+    copy.clear();
+    EXPECT_EQ(copy.getLength(), 0);
+    EXPECT_EQ(packed.getLength(), 300);
+}
+
+TEST(PackedIntSequenceTest, WritesListLikeArraySequence)
+{
+    int items[] = {3, 1, 2};
+    PackedIntSequence<int> packed(items, 3);
+    ArraySequence<int> expected(items, 3);
+    std::ostringstream first;
+    std::ostringstream second;
+    first << packed;
+    second << expected;
+    EXPECT_EQ(first.str(), second.str());
+}
+
+TEST(PackedIntSequenceTest, ConstReferencesSurviveReadsOfOtherBlocks)
+{
+    std::vector<int> items;
+    for (int i = 0; i < 1000; i++)
+    {
+        items.push_back(i * 3);
+    }
+    const PackedIntSequence<int> packed(items.data(), 1000);
+
+    const int &first = packed.get(0);
+    const int &later = packed.get(300);
+    EXPECT_EQ(std::max(packed.get(5), packed.get(300)), 900);
+    packed.get(900);
+    packed.get(999);
+    EXPECT_EQ(first, 0);
+    EXPECT_EQ(later, 900);
+}
+
+TEST(PackedIntSequenceTest, ConcurrentConstReadsAgree)
+{
+    std::vector<int> items;
+    long long expected = 0;
+    for (int i = 0; i < 20000; i++)
+    {
+        items.push_back(i * 7 % 1000);
+        expected += items.back();
+    }
+    const PackedIntSequence<int> packed(items.data(), 20000);
+
+    std::vector<long long> sums(4, 0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; t++)
+    {
+        readers.emplace_back([&packed, &sums, t]()
+                             {
+            for (SequenceIndex i = 0; i < packed.getLength(); i++)
+            {
+                sums[t] += packed.get((i + t * 5000) % packed.getLength());
+            } });
+    }
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+    for (long long sum : sums)
+    {
+        EXPECT_EQ(sum, expected);
+    }
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include <string>
+#include "../inc/poolListSequence.hpp"
+#include "../inc/arraySequence.hpp"
+
+TEST(PoolListSequenceTest, DefaultConstructorCreatesEmptySequence)
+{
+    PoolListSequence<int> seq;
+    EXPECT_EQ(seq.getLength(), 0);
+    EXPECT_THROW(seq.getFirst(), std::out_of_range);
+    EXPECT_THROW(seq.getLast(), std::out_of_range);
+    EXPECT_THROW(seq.get(0), std::out_of_range);
+    EXPECT_THROW(PoolListSequence<int>(-1), std::invalid_argument);
+    EXPECT_THROW(PoolListSequence<int>(nullptr, 1), std::invalid_argument);
+}
+
+TEST(PoolListSequenceTest, NodesAreValuePlusThirtyTwoBitLink)
+{
+    PoolListSequence<int> seq;
+    for (int i = 0; i < 1024; i++)
+    {
+        seq.append(i);
+    }
+    EXPECT_EQ(seq.getPoolBytes(), 1024 * (sizeof(int) + sizeof(std::uint32_t)));
+    EXPECT_EQ(seq.getFirst(), 0);
+    EXPECT_EQ(seq.getLast(), 1023);
+}
+
+template <bool XorLinked>
+void checkAgainstArray()
+{
+    std::mt19937 random(11);
+    PoolListSequence<int, XorLinked> pool;
+    ArraySequence<int> expected;
+
+    for (int i = 0; i < 3000; i++)
+    {
+        int choice = static_cast<int>(random() % 4);
+        if (choice == 0 && expected.getLength() > 0)
+        {
+            int index = static_cast<int>(random() % expected.getLength());
+            pool.removeAt(index);
+            ArraySequence<int> next;
+            for (int j = 0; j < expected.getLength(); j++)
+            {
+                if (j != index)
+                {
+                    next.append(expected.get(j));
+                }
+            }
+            expected = next;
+        }
+        else
+        {
+            int index = static_cast<int>(random() % (expected.getLength() + 1));
+            pool.insertAt(i, index);
+            expected.insertAt(i, index);
+        }
+    }
+
+    ASSERT_EQ(pool.getLength(), expected.getLength());
+    for (int i = 0; i < expected.getLength(); i++)
+    {
+        ASSERT_EQ(pool.get(i), expected.get(i));
+    }
+    EXPECT_EQ(pool.getLast(), expected.getLast());
+
+    pool.compact();
+    int index = 0;
+    for (typename PoolListSequence<int, XorLinked>::ConstIterator it = pool.begin(); it != pool.end(); ++it)
+    {
+        ASSERT_EQ(*it, expected.get(index++));
+    }
+    EXPECT_EQ(index, expected.getLength());
+    pool.append(-1);
+    pool.prepend(-2);
+    EXPECT_EQ(pool.getLast(), -1);
+    EXPECT_EQ(pool.getFirst(), -2);
+}
+
+TEST(PoolListSequenceTest, RandomEditsMatchArraySequence)
+{
+    checkAgainstArray<false>();
+}
+
+TEST(PoolListSequenceTest, XorLinkedRandomEditsMatchArraySequence)
+{
+    checkAgainstArray<true>();
+}
+
+TEST(PoolListSequenceTest, RemovedSlotsAreReused)
+{
+    PoolListSequence<std::string, true> seq;
+    for (int i = 0; i < 8; i++)
+    {
+        seq.append(std::to_string(i));
+    }
+    std::size_t bytes = seq.getPoolBytes();
+
+    seq.removeAt(0);
+    seq.removeAt(6);
+    seq.removeAt(3);
+    seq.append("x");
+    seq.prepend("y");
+    seq.insertAt("z", 4);
+
+    EXPECT_EQ(seq.getPoolBytes(), bytes);
+    std::ostringstream out;
+    out << seq;
+    EXPECT_EQ(out.str(), "[y], [1], [2], [3], [z], [5], [6], [x]");
+    EXPECT_THROW(seq.removeAt(8), std::out_of_range);
+}
+
+TEST(PoolListSequenceTest, RangesAndSelfConcat)
+{
+    int items[] = {1, 2, 3};
+    PoolListSequence<int> seq(items, 3);
+    seq.insertRange(1, &seq.get(2), 1);
+    seq.concat(&seq);
+    ArraySequence<int> tail(items, 2);
+    seq.concat(&tail);
+
+    int expected[] = {1, 3, 2, 3, 1, 3, 2, 3, 1, 2};
+    ASSERT_EQ(seq.getLength(), 10);
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(seq.get(i), expected[i]);
+    }
+    EXPECT_THROW(seq.insertRange(11, items, 1), std::out_of_range);
+    EXPECT_NO_THROW(seq.concat(nullptr));
+    EXPECT_EQ(seq.getLength(), 10);
+}
+
+TEST(PoolListSequenceTest, ImmutableOperationsLeaveOriginalUntouched)
+{
+    int items[] = {1, 2, 3};
+    PoolListSequence<int, true> seq(items, 3);
+
+    Sequence<int> *inserted = seq.insertAtImmutable(9, 1);
+    Sequence<int> *changed = seq.setImmutable(2, 30);
+    Sequence<int> *sub = seq.getSubsequence(1, 2);
+
+    EXPECT_EQ(seq.get(1), 2);
+    EXPECT_EQ(inserted->get(1), 9);
+    EXPECT_EQ(changed->getLast(), 30);
+    ASSERT_EQ(sub->getLength(), 2);
+    EXPECT_EQ(sub->getFirst(), 2);
+    EXPECT_EQ(sub->getLast(), 3);
+    EXPECT_THROW(seq.getSubsequence(2, 1), std::out_of_range);
+
+    delete inserted;
+    delete changed;
+    delete sub;
+}
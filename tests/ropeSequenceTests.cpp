@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../inc/ropeSequence.hpp"
+#include "../inc/arraySequence.hpp"
+
+TEST(RopeSequenceTest, DefaultConstructorCreatesEmptySequence)
+{
+    RopeSequence<int> seq;
+    EXPECT_EQ(seq.getLength(), 0);
+    EXPECT_EQ(seq.getHeight(), 0);
+    EXPECT_THROW(seq.getFirst(), std::out_of_range);
+    EXPECT_THROW(seq.get(0), std::out_of_range);
+}
+
+TEST(RopeSequenceTest, ConstructorBuildsBalancedTree)
+{
+    int items[1000];
+    for (int i = 0; i < 1000; i++)
+    {
+        items[i] = i;
+    }
+    RopeSequence<int> seq(items, 1000);
+
+    ASSERT_EQ(seq.getLength(), 1000);
+    for (int i = 0; i < 1000; i++)
+    {
+        EXPECT_EQ(seq[i], i);
+    }
+    EXPECT_LE(seq.getHeight(), 6);
+    EXPECT_THROW(RopeSequence<int>(nullptr, 3), std::invalid_argument);
+    EXPECT_THROW(RopeSequence<int>(items, -1), std::invalid_argument);
+}
+
+TEST(RopeSequenceTest, RandomInsertionsMatchArraySequence)
+{
+    std::mt19937 random(7);
+    RopeSequence<int> rope;
+    ArraySequence<int> expected;
+
+    for (int i = 0; i < 5000; i++)
+    {
+        int index = static_cast<int>(random() % (expected.getLength() + 1));
+        rope.insertAt(i, index);
+        expected.insertAt(i, index);
+    }
+
+    ASSERT_EQ(rope.getLength(), expected.getLength());
+    for (int i = 0; i < expected.getLength(); i++)
+    {
+        ASSERT_EQ(rope.get(i), expected.get(i));
+    }
+    EXPECT_LE(rope.getHeight(), 20);
+    EXPECT_THROW(rope.insertAt(1, -1), std::out_of_range);
+}
+
+TEST(RopeSequenceTest, ConcatAndSubsequenceShareStructure)
+{
+    std::string text = "the quick brown fox jumps over the lazy dog";
+    RopeSequence<char> rope(text.data(), static_cast<int>(text.size()));
+
+    for (int i = 0; i < 10; i++)
+    {
+        rope.concat(&rope);
+    }
+    ASSERT_EQ(rope.getLength(), static_cast<int>(text.size()) << 10);
+    EXPECT_LE(rope.getHeight(), 12);
+
+    Sequence<char> *word = rope.getSubsequence(4, 8);
+    ASSERT_EQ(word->getLength(), 5);
+    EXPECT_EQ(word->get(0), 'q');
+    EXPECT_EQ(word->get(4), 'k');
+
+    int offset = static_cast<int>(text.size()) * 700;
+    Sequence<char> *far = rope.getSubsequence(offset + 10, offset + 14);
+    EXPECT_EQ(far->get(0), 'b');
+    EXPECT_EQ(far->get(4), 'n');
+
+    EXPECT_THROW(rope.getSubsequence(5, 2), std::out_of_range);
+    delete word;
+    delete far;
+}
+
+TEST(RopeSequenceTest, WritesDoNotLeakIntoSharedCopies)
+{
+    int items[] = {1, 2, 3, 4, 5};
+    RopeSequence<int> original(items, 5);
+    RopeSequence<int> copy(original);
+    Sequence<int> *slice = original.getSubsequence(1, 3);
+
+    copy.set(2, 30);
+    original[1] = 20;
+    slice->set(0, 200);
+
+    EXPECT_EQ(original[1], 20);
+    EXPECT_EQ(original[2], 3);
+    EXPECT_EQ(copy[1], 2);
+    EXPECT_EQ(copy[2], 30);
+    EXPECT_EQ(slice->get(0), 200);
+    EXPECT_EQ(slice->get(1), 3);
+    delete slice;
+}
+
+TEST(RopeSequenceTest, ImmutableOperationsLeaveOriginalUntouched)
+{
+    int items[] = {1, 2, 3};
+    RopeSequence<int> seq(items, 3);
+
+    Sequence<int> *appended = seq.appendImmutable(4);
+    Sequence<int> *prepended = seq.prependImmutable(0);
+    Sequence<int> *inserted = seq.insertAtImmutable(9, 1);
+    Sequence<int> *changed = seq.setImmutable(0, 7);
+    ArraySequence<int> tail(items, 3);
+    Sequence<int> *joined = seq.concatImmutable(&tail);
+
+    EXPECT_EQ(seq.getLength(), 3);
+    EXPECT_EQ(seq.getFirst(), 1);
+    EXPECT_EQ(appended->getLast(), 4);
+    EXPECT_EQ(prepended->getFirst(), 0);
+    EXPECT_EQ(inserted->get(1), 9);
+    EXPECT_EQ(changed->getFirst(), 7);
+    EXPECT_EQ(joined->getLength(), 6);
+    EXPECT_EQ(joined->get(3), 1);
+
+    delete appended;
+    delete prepended;
+    delete inserted;
+    delete changed;
+    delete joined;
+}
+
+TEST(RopeSequenceTest, FlattenAndWriteVisitLeavesInOrder)
+{
+    RopeSequence<int> seq;
+    for (int i = 0; i < 200; i++)
+    {
+        seq.append(i);
+    }
+    seq.prepend(-1);
+
+    DynamicArray<int> *flat = seq.flatten();
+    ASSERT_EQ(flat->getSize(), 201);
+    EXPECT_EQ((*flat)[0], -1);
+    EXPECT_EQ((*flat)[200], 199);
+    delete flat;
+
+    int items[] = {1, 2, 3};
+    RopeSequence<int> small(items, 3);
+    std::ostringstream out;
+    out << small;
+    EXPECT_EQ(out.str(), "[1], [2], [3]");
+
+    small.clear();
+    std::ostringstream empty;
+    empty << small;
+    EXPECT_EQ(empty.str(), "");
+}
+
+namespace
+{
+    class ChunkCounter : public ChunkVisitor<int>
+    {
+    public:
+        int chunks;
+        SequenceIndex next;
+        int limit;
+
+        ChunkCounter(const int limit) : chunks(0), next(0), limit(limit) {}
+
+        bool visit(const int *, const SequenceIndex count, const SequenceIndex offset) override
+        {
+            EXPECT_EQ(offset, next);
+            next = offset + count;
+            return ++chunks < limit;
+        }
+    };
+}
+
+TEST(RopeSequenceTest, VisitChunksStopsWhenTheVisitorDeclines)
+{
+    std::vector<int> items(10000);
+    for (int i = 0; i < 10000; i++)
+    {
+        items[i] = i;
+    }
+    RopeSequence<int> seq(items.data(), 10000);
+
+    ChunkCounter all(1 << 30);
+    seq.visitChunks(all);
+    EXPECT_GT(all.chunks, 2);
+    EXPECT_EQ(all.next, 10000);
+
+    ChunkCounter two(2);
+    seq.visitChunks(two);
+    EXPECT_EQ(two.chunks, 2);
+    EXPECT_TRUE(seq.contains(0));
+    EXPECT_EQ(seq.indexOf(9999), 9999);
+}
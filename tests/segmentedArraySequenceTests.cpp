@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "../inc/segmentedArraySequence.hpp"
+#include "../inc/listSequence.hpp"
+
+TEST(SegmentedArraySequenceTest, DefaultConstructorCreatesEmptySequence)
+{
+    SegmentedArraySequence<int> seq;
+    EXPECT_EQ(seq.getLength(), 0);
+    EXPECT_EQ(seq.getBlockCount(), 0);
+    EXPECT_THROW(seq.getFirst(), std::out_of_range);
+    EXPECT_THROW(seq.getLast(), std::out_of_range);
+}
+
+TEST(SegmentedArraySequenceTest, ConstructorsInitializeItems)
+{
+    SegmentedArraySequence<std::string> defaults(3);
+    EXPECT_EQ(defaults.getLength(), 3);
+    EXPECT_EQ(defaults[2], "");
+
+    double items[] = {1.1, 2.2, 3.3};
+    SegmentedArraySequence<double> seq(items, 3);
+    EXPECT_EQ(seq.getLength(), 3);
+    EXPECT_DOUBLE_EQ(seq[0], 1.1);
+    EXPECT_DOUBLE_EQ(seq[2], 3.3);
+
+    EXPECT_THROW(SegmentedArraySequence<int>(nullptr, 1), std::invalid_argument);
+    EXPECT_THROW(SegmentedArraySequence<int>(-1), std::invalid_argument);
+}
+
+TEST(SegmentedArraySequenceTest, AppendAcrossBlocksKeepsOrder)
+{
+    SegmentedArraySequence<int> seq;
+    for (int i = 0; i < 1000; i++)
+    {
+        seq.append(i);
+    }
+    EXPECT_EQ(seq.getLength(), 1000);
+    EXPECT_GE(seq.getCapacity(), 1000);
+    for (int i = 0; i < 1000; i++)
+    {
+        EXPECT_EQ(seq.get(i), i);
+    }
+    EXPECT_EQ(seq.getFirst(), 0);
+    EXPECT_EQ(seq.getLast(), 999);
+}
+
+TEST(SegmentedArraySequenceTest, AppendDoesNotRelocateElements)
+{
+    SegmentedArraySequence<int> seq;
+    seq.append(42);
+    int *first = &seq.get(0);
+
+    for (int i = 0; i < 10000; i++)
+    {
+        seq.append(i);
+    }
+
+    EXPECT_EQ(first, &seq.get(0));
+    EXPECT_EQ(*first, 42);
+}
+
+TEST(SegmentedArraySequenceTest, CapacityGrowsGeometrically)
+{
+    SegmentedArraySequence<int> seq;
+    for (int i = 0; i < 100000; i++)
+    {
+        seq.append(i);
+    }
+    EXPECT_LE(seq.getCapacity(), 2 * seq.getLength() + 8);
+    EXPECT_LE(seq.getBlockCount(), 14);
+}
+
+TEST(SegmentedArraySequenceTest, PrependAndInsertAtShiftElements)
+{
+    SegmentedArraySequence<int> seq;
+    for (int i = 0; i < 20; i++)
+    {
+        seq.append(i);
+    }
+    seq.prepend(-1);
+    seq.insertAt(100, 10);
+    seq.insertAt(200, seq.getLength());
+
+    EXPECT_EQ(seq.getLength(), 23);
+    EXPECT_EQ(seq[0], -1);
+    EXPECT_EQ(seq[1], 0);
+    EXPECT_EQ(seq[10], 100);
+    EXPECT_EQ(seq[11], 9);
+    EXPECT_EQ(seq.getLast(), 200);
+
+    EXPECT_THROW(seq.insertAt(0, -1), std::out_of_range);
+    EXPECT_THROW(seq.insertAt(0, 24), std::out_of_range);
+}
+
+TEST(SegmentedArraySequenceTest, SetModifiesAndThrowsForInvalidIndices)
+{
+    SegmentedArraySequence<int> seq;
+    seq.append(1);
+    seq.append(2);
+    seq.set(1, 20);
+    EXPECT_EQ(seq[1], 20);
+    EXPECT_THROW(seq.set(2, 0), std::out_of_range);
+    EXPECT_THROW(seq.get(-1), std::out_of_range);
+}
+
+TEST(SegmentedArraySequenceTest, CopyAndAssignmentAreDeep)
+{
+    SegmentedArraySequence<int> seq;
+    for (int i = 0; i < 50; i++)
+    {
+        seq.append(i);
+    }
+
+    SegmentedArraySequence<int> copy(seq);
+    SegmentedArraySequence<int> assigned;
+    assigned.append(7);
+    assigned = seq;
+    seq = seq;
+
+    copy[0] = 100;
+    assigned[0] = 200;
+    EXPECT_EQ(seq[0], 0);
+    EXPECT_EQ(copy.getLength(), 50);
+    EXPECT_EQ(assigned.getLength(), 50);
+    EXPECT_EQ(assigned[49], 49);
+}
+
+TEST(SegmentedArraySequenceTest, SubsequenceAndImmutableOperations)
+{
+    SegmentedArraySequence<int> seq;
+    for (int i = 0; i < 30; i++)
+    {
+        seq.append(i);
+    }
+
+    Sequence<int> *sub = seq.getSubsequence(5, 24);
+    EXPECT_EQ(sub->getLength(), 20);
+    EXPECT_EQ(sub->get(0), 5);
+    EXPECT_EQ(sub->getLast(), 24);
+    EXPECT_THROW(seq.getSubsequence(10, 5), std::out_of_range);
+
+    Sequence<int> *appended = seq.appendImmutable(30);
+    Sequence<int> *prepended = seq.prependImmutable(-1);
+    Sequence<int> *inserted = seq.insertAtImmutable(99, 3);
+    Sequence<int> *changed = seq.setImmutable(0, 50);
+    Sequence<int> *combined = seq.concatImmutable(sub);
+
+    EXPECT_EQ(seq.getLength(), 30);
+    EXPECT_EQ(seq[0], 0);
+    EXPECT_EQ(appended->getLast(), 30);
+    EXPECT_EQ(prepended->getFirst(), -1);
+    EXPECT_EQ(inserted->get(3), 99);
+    EXPECT_EQ(changed->get(0), 50);
+    EXPECT_EQ(combined->getLength(), 50);
+    EXPECT_EQ(combined->get(30), 5);
+
+    delete sub;
+    delete appended;
+    delete prepended;
+    delete inserted;
+    delete changed;
+    delete combined;
+}
+
+TEST(SegmentedArraySequenceTest, ClearReleasesBlocks)
+{
+    SegmentedArraySequence<int> seq;
+    for (int i = 0; i < 100; i++)
+    {
+        seq.append(i);
+    }
+    seq.clear();
+    EXPECT_EQ(seq.getLength(), 0);
+    EXPECT_EQ(seq.getBlockCount(), 0);
+    EXPECT_THROW(seq[0], std::out_of_range);
+
+    seq.append(5);
+    EXPECT_EQ(seq[0], 5);
+}
+
+TEST(SegmentedArraySequenceTest, PrintDoesNotCrash)
+{
+    SegmentedArraySequence<int> seq;
+    seq.append(1);
+    seq.append(2);
+
+    seq.print();
+}
+
+TEST(SegmentedArraySequenceTest, InsertRangeGrowsBlocksOnce)
+{
+    SegmentedArraySequence<int> seq;
+    seq.append(0);
+    seq.append(99);
+
+    int items[40];
+    for (int i = 0; i < 40; i++)
+    {
+        items[i] = i + 1;
+    }
+    seq.insertRange(1, items, 40);
+    ASSERT_EQ(seq.getLength(), 42);
+    for (int i = 0; i < 41; i++)
+    {
+        EXPECT_EQ(seq[i], i);
+    }
+    EXPECT_EQ(seq.getLast(), 99);
+
+    seq.insertRange(0, &seq[1], 2);
+    EXPECT_EQ(seq[0], 1);
+    EXPECT_EQ(seq[1], 2);
+    EXPECT_EQ(seq[2], 0);
+
+    SegmentedArraySequence<int> copy(seq);
+    seq.appendRange(&copy);
+    EXPECT_EQ(seq.getLength(), 88);
+    EXPECT_EQ(seq.getLast(), 99);
+}
+
+TEST(SegmentedArraySequenceTest, ConcatWalksLinkedSourcesAndItself)
+{
+    std::vector<int> items(20000);
+    for (int i = 0; i < 20000; i++)
+    {
+        items[i] = i;
+    }
+    ListSequence<int> source(items.data(), 20000);
+    SegmentedArraySequence<int> seq;
+    seq.append(-1);
+    seq.concat(&source);
+    EXPECT_EQ(seq.getLength(), 20001);
+    EXPECT_EQ(seq.get(12346), 12345);
+
+    seq.concat(&seq);
+    EXPECT_EQ(seq.getLength(), 40002);
+    EXPECT_EQ(seq.get(20001), -1);
+    EXPECT_EQ(seq.getLast(), 19999);
+    seq.concat(nullptr);
+    EXPECT_EQ(seq.getLength(), 40002);
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+#include "../inc/dListSequence.hpp"
+#include "../inc/ropeSequence.hpp"
+#include "../inc/segmentedArraySequence.hpp"
+#include "../inc/packedIntSequence.hpp"
+#include "../inc/adaptiveSequence.hpp"
+
+namespace
+{
+    std::vector<std::unique_ptr<Sequence<int>>> everyKind(const int *items, const SequenceIndex count)
+    {
+        std::vector<std::unique_ptr<Sequence<int>>> sequences;
+        sequences.emplace_back(new ArraySequence<int>(items, count));
+        sequences.emplace_back(new ListSequence<int>(items, count));
+        sequences.emplace_back(new DListSequence<int>(items, count));
+        sequences.emplace_back(new RopeSequence<int>(items, count));
+        sequences.emplace_back(new SegmentedArraySequence<int>(items, count));
+        sequences.emplace_back(new PackedIntSequence<int>(items, count));
+        sequences.emplace_back(new AdaptiveSequence<int>(items, count, SequenceRepresentation::Linked));
+        return sequences;
+    }
+}
+
+TEST(SequenceCompareTest, EqualsAcrossImplementations)
+{
+    int items[] = {3, 1, 4, 1, 5, 9, 2, 6};
+    int changed[] = {3, 1, 4, 1, 5, 9, 2, 7};
+    std::vector<std::unique_ptr<Sequence<int>>> same = everyKind(items, 8);
+    std::vector<std::unique_ptr<Sequence<int>>> different = everyKind(changed, 8);
+    std::vector<std::unique_ptr<Sequence<int>>> shorter = everyKind(items, 7);
+    for (const std::unique_ptr<Sequence<int>> &left : same)
+    {
+        for (std::size_t i = 0; i < same.size(); i++)
+        {
+            EXPECT_TRUE(left->equals(*same[i]));
+            EXPECT_TRUE(*left == *same[i]);
+            EXPECT_FALSE(left->equals(*different[i]));
+            EXPECT_TRUE(*left != *different[i]);
+            EXPECT_FALSE(left->equals(*shorter[i]));
+            EXPECT_EQ(left->hash(), same[i]->hash());
+        }
+    }
+    EXPECT_TRUE(ArraySequence<int>().equals(ListSequence<int>()));
+}
+
+TEST(SequenceCompareTest, CompareIsLexicographic)
+{
+    int items[] = {1, 2, 3};
+    int larger[] = {1, 2, 4};
+    std::vector<std::unique_ptr<Sequence<int>>> base = everyKind(items, 3);
+    std::vector<std::unique_ptr<Sequence<int>>> above = everyKind(larger, 3);
+    std::vector<std::unique_ptr<Sequence<int>>> prefix = everyKind(items, 2);
+    for (const std::unique_ptr<Sequence<int>> &left : base)
+    {
+        for (std::size_t i = 0; i < base.size(); i++)
+        {
+            EXPECT_EQ(left->compare(*base[i]), 0);
+            EXPECT_LT(left->compare(*above[i]), 0);
+            EXPECT_GT(above[i]->compare(*left), 0);
+            EXPECT_GT(left->compare(*prefix[i]), 0);
+            EXPECT_LT(prefix[i]->compare(*left), 0);
+            EXPECT_TRUE(*prefix[i] < *left);
+        }
+    }
+}
+
+TEST(SequenceCompareTest, FloatingPointUsesElementEquality)
+{
+    double zeros[] = {0.0, 1.5};
+    double negativeZeros[] = {-0.0, 1.5};
+    EXPECT_TRUE(ArraySequence<double>(zeros, 2).equals(ArraySequence<double>(negativeZeros, 2)));
+
+    double nan[] = {std::numeric_limits<double>::quiet_NaN()};
+    ArraySequence<double> withNan(nan, 1);
+    EXPECT_FALSE(withNan.equals(ArraySequence<double>(nan, 1)));
+    EXPECT_TRUE(withNan.equals(withNan));
+}
+
+TEST(SequenceCompareTest, CachedHashFollowsMutations)
+{
+    int items[] = {1, 2, 3, 4};
+    ArraySequence<int> array(items, 4);
+    ListSequence<int> list(items, 4);
+    std::size_t original = array.hash();
+    EXPECT_EQ(list.hash(), original);
+
+    array.set(0, 10);
+    list.set(0, 10);
+    EXPECT_NE(array.hash(), original);
+    EXPECT_EQ(array.hash(), list.hash());
+    EXPECT_EQ(array.hash(), ArraySequence<int>(array).hash());
+
+    array.get(1) = 20;
+    array.getData()[2] = 30;
+    array[3] = 40;
+    int written[] = {10, 20, 30, 40};
+    EXPECT_EQ(array.hash(), ListSequence<int>(written, 4).hash());
+    EXPECT_TRUE(array.equals(ListSequence<int>(written, 4)));
+
+    list.append(5);
+    list.prepend(0);
+    int extended[] = {0, 10, 2, 3, 4, 5};
+    EXPECT_EQ(list.hash(), ArraySequence<int>(extended, 6).hash());
+
+    list.reverse();
+    array.clear();
+    EXPECT_EQ(array.hash(), ListSequence<int>().hash());
+    EXPECT_FALSE(list.equals(array));
+
+    ArraySequence<int> other(items, 4);
+    other.hash();
+    array.swap(other);
+    EXPECT_EQ(array.hash(), ArraySequence<int>(items, 4).hash());
+    EXPECT_EQ(other.hash(), ArraySequence<int>().hash());
+}
+
+TEST(SequenceCompareTest, MovedFromSequencesForgetTheCachedHash)
+{
+    int items[] = {1, 2, 3, 4};
+    ArraySequence<int> array(items, 4);
+    ListSequence<int> list(items, 4);
+    array.hash();
+    list.hash();
+
+    ArraySequence<int> movedArray(std::move(array));
+    ListSequence<int> movedList(std::move(list));
+    EXPECT_TRUE(array.equals(ArraySequence<int>()));
+    EXPECT_TRUE(list.equals(ListSequence<int>()));
+    EXPECT_EQ(array.hash(), ArraySequence<int>().hash());
+    EXPECT_EQ(list.hash(), ListSequence<int>().hash());
+
+    array = ArraySequence<int>(items, 4);
+    list = ListSequence<int>(items, 4);
+    array.hash();
+    list.hash();
+    movedArray = std::move(array);
+    movedList = std::move(list);
+    EXPECT_TRUE(array.equals(ArraySequence<int>()));
+    EXPECT_TRUE(list.equals(ListSequence<int>()));
+    EXPECT_EQ(movedArray.hash(), movedList.hash());
+}
+
+TEST(SequenceCompareTest, ConcurrentHashesAgree)
+{
+    std::vector<int> items(20000);
+    for (int i = 0; i < 20000; i++)
+    {
+        items[i] = i * 7 % 1000;
+    }
+    const ArraySequence<int> array(items.data(), 20000);
+    const ListSequence<int> list(items.data(), 20000);
+    std::size_t expected = ArraySequence<int>(items.data(), 20000).hash();
+
+    std::vector<std::size_t> hashes(8, 0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 8; t++)
+    {
+        readers.emplace_back([&array, &list, &hashes, t]()
+                             { hashes[t] = t % 2 == 0 ? array.hash() : list.hash(); });
+    }
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+    for (std::size_t hash : hashes)
+    {
+        EXPECT_EQ(hash, expected);
+    }
+    EXPECT_TRUE(array.equals(list));
+}
+
+TEST(SequenceCompareTest, SequencesWorkAsHashKeys)
+{
+    std::unordered_set<ArraySequence<int>, SequenceHash<int>> seen;
+    for (int i = 0; i < 100; i++)
+    {
+        int items[] = {i, i + 1, i + 2};
+        seen.insert(ArraySequence<int>(items, 3));
+    }
+    int probe[] = {42, 43, 44};
+    EXPECT_EQ(seen.size(), 100u);
+    EXPECT_EQ(seen.count(ArraySequence<int>(probe, 3)), 1u);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include "../inc/arraySequence.hpp"
+#include "../inc/dListSequence.hpp"
+#include "../inc/listSequence.hpp"
+
+TEST(SequenceErrorTest, DynamicArrayTryAccessorsReportBadIndices)
+{
+    int items[] = {1, 2, 3};
+    DynamicArray<int> array(items, 3);
+
+    SequenceResult<int> found = array.tryGet(1);
+    ASSERT_TRUE(found.ok());
+    *found = 20;
+    EXPECT_EQ(array.get(1), 20);
+    EXPECT_EQ(array.tryGet(3).getStatus(), SequenceStatus::OutOfRange);
+    EXPECT_FALSE(array.tryGet(-1));
+
+    EXPECT_EQ(array.trySet(2, 30), SequenceStatus::Ok);
+    EXPECT_EQ(array.trySet(3, 40), SequenceStatus::OutOfRange);
+    EXPECT_EQ(array.tryInsertAt(0, 3), SequenceStatus::Ok);
+    EXPECT_EQ(array.tryInsertAt(0, 5), SequenceStatus::OutOfRange);
+    EXPECT_EQ(array.getSize(), 4);
+    EXPECT_EQ(array.getLast(), 0);
+}
+
+TEST(SequenceErrorTest, LinkedListTryAccessorsReportBadIndices)
+{
+    int items[] = {1, 2, 3};
+    const LinkedList<int> list(items, 3);
+    LinkedList<int> copy(list);
+
+    EXPECT_EQ(list.tryGet(2).value(), 3);
+    EXPECT_EQ(list.tryGet(3).getStatus(), SequenceStatus::OutOfRange);
+    EXPECT_EQ(copy.trySet(-1, 0), SequenceStatus::OutOfRange);
+    EXPECT_EQ(copy.tryInsertAt(9, 1), SequenceStatus::Ok);
+    EXPECT_EQ(copy.tryInsertAt(9, 5), SequenceStatus::OutOfRange);
+    EXPECT_EQ(copy.get(1), 9);
+    EXPECT_EQ(copy.getLength(), 4);
+}
+
+TEST(SequenceErrorTest, SequencesReportBadIndicesAndEmptiness)
+{
+    int items[] = {4, 5, 6};
+    ArraySequence<int> array(items, 3);
+    ListSequence<int> list(items, 3);
+    DListSequence<int> dlist(items, 3);
+    Sequence<int> *sequences[] = {&array, &list, &dlist};
+
+    for (Sequence<int> *sequence : sequences)
+    {
+        EXPECT_EQ(sequence->tryGet(0).value(), 4);
+        EXPECT_EQ(sequence->tryGet(3).getStatus(), SequenceStatus::OutOfRange);
+        EXPECT_EQ(sequence->tryGetFirst().value(), 4);
+        EXPECT_EQ(sequence->tryGetLast().value(), 6);
+        EXPECT_EQ(sequence->trySet(1, 50), SequenceStatus::Ok);
+        EXPECT_EQ(sequence->trySet(3, 50), SequenceStatus::OutOfRange);
+        EXPECT_EQ(sequence->tryInsertAt(7, 3), SequenceStatus::Ok);
+        EXPECT_EQ(sequence->tryInsertAt(7, -1), SequenceStatus::OutOfRange);
+        EXPECT_EQ(sequence->get(1), 50);
+        EXPECT_EQ(sequence->getLast(), 7);
+    }
+
+    const ArraySequence<int> empty;
+    EXPECT_EQ(empty.tryGetFirst().getStatus(), SequenceStatus::Empty);
+    EXPECT_EQ(empty.tryGetLast().getStatus(), SequenceStatus::Empty);
+    EXPECT_EQ(empty.tryGet(0).valueOr(-1), -1);
+    EXPECT_EQ(array.tryGet(0).valueOr(-1), 4);
+}
+
+TEST(SequenceErrorTest, TryGetOnConcreteTypesForgetsTheCachedHash)
+{
+    int items[] = {1, 2, 3};
+    ArraySequence<int> array(items, 3);
+    ArraySequence<int> other(items, 3);
+    EXPECT_TRUE(array.equals(other));
+    array.hash();
+    other.hash();
+
+    *array.tryGet(2) = 9;
+    other.set(2, 9);
+    EXPECT_EQ(array.hash(), other.hash());
+}
+
+TEST(SequenceErrorTest, CheckedAccessorsStillThrow)
+{
+    EXPECT_EQ(SEQUENCE_EXCEPTIONS, 1);
+    ArraySequence<int> array;
+    EXPECT_THROW(array.get(0), std::out_of_range);
+    EXPECT_THROW(sequenceThrow<std::logic_error>(std::string("message")), std::logic_error);
+}
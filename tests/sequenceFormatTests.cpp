@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <iomanip>
+#include <sstream>
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+#include "../inc/segmentedArraySequence.hpp"
+
+TEST(SequenceFormatTest, DynamicArrayUsesBracketsByDefault)
+{
+    int items[] = {1, -2, 3};
+    DynamicArray<int> arr(items, 3);
+
+    std::ostringstream out;
+    out << arr;
+    EXPECT_EQ(out.str(), "[1], [-2], [3]");
+}
+
+TEST(SequenceFormatTest, LinkedListPrintKeepsSpacedLayout)
+{
+    int items[] = {1, 2, 3};
+    LinkedList<int> list(items, 3);
+
+    std::ostringstream spaced;
+    list.writeTo(spaced, SequenceFormat::spaced());
+    EXPECT_EQ(spaced.str(), "1 2 3 ");
+
+    std::ostringstream empty;
+    LinkedList<int>().writeTo(empty, SequenceFormat::spaced());
+    EXPECT_EQ(empty.str(), "Empty list");
+
+    std::ostringstream brackets;
+    brackets << list;
+    EXPECT_EQ(brackets.str(), "[1], [2], [3]");
+}
+
+TEST(SequenceFormatTest, CustomSeparatorsAreApplied)
+{
+    int items[] = {4, 5, 6};
+    ArraySequence<int> seq(items, 3);
+
+    std::ostringstream out;
+    seq.writeTo(out, SequenceFormat("<", ">", "|", "none"));
+    EXPECT_EQ(out.str(), "<4>|<5>|<6>");
+
+    std::ostringstream empty;
+    ArraySequence<int>().writeTo(empty, SequenceFormat("<", ">", "|", "none"));
+    EXPECT_EQ(empty.str(), "none");
+}
+
+TEST(SequenceFormatTest, SequenceStreamOperatorWorksThroughInterface)
+{
+    ListSequence<int> list;
+    list.append(7);
+    list.append(8);
+    SegmentedArraySequence<int> segmented;
+    segmented.append(9);
+
+    const Sequence<int> &asList = list;
+    const Sequence<int> &asSegmented = segmented;
+    std::ostringstream out;
+    out << asList << ";" << asSegmented;
+    EXPECT_EQ(out.str(), "[7], [8];[9]");
+}
+
+TEST(SequenceFormatTest, IntegerFastPathMatchesStream)
+{
+    long long items[] = {0, LLONG_MIN, LLONG_MAX, -1, 1234567890123LL};
+    DynamicArray<long long> arr(items, 5);
+
+    std::ostringstream expected;
+    for (int i = 0; i < 5; i++)
+    {
+        expected << items[i] << ",";
+    }
+
+    std::ostringstream out;
+    arr.writeTo(out, SequenceFormat("", ",", ""));
+    EXPECT_EQ(out.str(), expected.str());
+}
+
+TEST(SequenceFormatTest, FloatingPointMatchesStreamPrecision)
+{
+    double items[] = {1.5, 0.1, 1e300, -2.0 / 3.0};
+    DynamicArray<double> arr(items, 4);
+
+    std::ostringstream expected;
+    expected << std::setprecision(10);
+    for (int i = 0; i < 4; i++)
+    {
+        expected << items[i] << " ";
+    }
+
+    std::ostringstream out;
+    out << std::setprecision(10);
+    arr.writeTo(out, SequenceFormat("", " ", ""));
+    EXPECT_EQ(out.str(), expected.str());
+}
+
+TEST(SequenceFormatTest, StreamFlagsAreRespected)
+{
+    int items[] = {10, 255};
+    DynamicArray<int> arr(items, 2);
+
+    std::ostringstream out;
+    out << std::hex;
+    arr.writeTo(out, SequenceFormat("", "", " "));
+    EXPECT_EQ(out.str(), "a ff");
+}
+
+TEST(SequenceFormatTest, NonArithmeticTypesUseStreamOperator)
+{
+    std::string items[] = {"a", "bc"};
+    char letters[] = {'x', 'y'};
+    DynamicArray<std::string> words(items, 2);
+    DynamicArray<char> chars(letters, 2);
+
+    std::ostringstream out;
+    out << words << " " << chars;
+    EXPECT_EQ(out.str(), "[a], [bc] [x], [y]");
+}
+
+TEST(SequenceFormatTest, LargeOutputIsFlushedCompletely)
+{
+    DynamicArray<int> arr;
+    for (int i = 0; i < 100000; i++)
+    {
+        arr.append(i % 10);
+    }
+
+    std::ostringstream out;
+    arr.writeTo(out, SequenceFormat("", "", ""));
+    EXPECT_EQ(out.str().size(), 100000u);
+}
@@ -0,0 +1,267 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include "../inc/sequenceIO.hpp"
+#include "../inc/mappedArraySequence.hpp"
+
+static std::string tempPath(const std::string &name)
+{
+    return ::testing::TempDir() + "sequenceIO_" + name + ".bin";
+}
+
+TEST(SequenceIOTest, DynamicArrayRoundTrip)
+{
+    std::string path = tempPath("dynamicArray");
+    DynamicArray<int> source;
+    for (int i = 0; i < 1000; i++)
+    {
+        source.append(i * 3);
+    }
+    saveBinary(source, path);
+
+    DynamicArray<int> loaded;
+    loaded.append(7);
+    loadBinary(path, loaded);
+    EXPECT_EQ(loaded.getSize(), 1000);
+    for (int i = 0; i < 1000; i++)
+    {
+        EXPECT_EQ(loaded[i], i * 3);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(SequenceIOTest, ArraySequenceRoundTrip)
+{
+    std::string path = tempPath("arraySequence");
+    double items[] = {1.5, -2.25, 3.125};
+    ArraySequence<double> source(items, 3);
+    saveBinary(source, path);
+
+    ArraySequence<double> loaded;
+    loadBinary(path, loaded);
+    EXPECT_EQ(loaded.getLength(), 3);
+    EXPECT_DOUBLE_EQ(loaded[0], 1.5);
+    EXPECT_DOUBLE_EQ(loaded[1], -2.25);
+    EXPECT_DOUBLE_EQ(loaded[2], 3.125);
+    std::remove(path.c_str());
+}
+
+TEST(SequenceIOTest, LoadRebuildsIndexAndSummary)
+{
+    std::string path = tempPath("indexed");
+    ArraySequence<int> source;
+    for (int i = 100; i < 10000; i++)
+    {
+        source.append(i);
+    }
+    saveBinary(source, path);
+
+    ArraySequence<int> loaded;
+    loaded.attachIndex();
+    loadBinary(path, loaded);
+    EXPECT_TRUE(loaded.contains(500));
+    EXPECT_FALSE(loaded.contains(0));
+    EXPECT_EQ(loaded.indexOf(9999), 9899);
+
+    ArraySequence<int> summarized;
+    summarized.attachSummary();
+    loadBinary(path, summarized);
+    EXPECT_TRUE(summarized.contains(5000));
+    EXPECT_FALSE(summarized.contains(0));
+    std::unique_ptr<ArraySequence<int>> range(summarized.filterRange(200, 299));
+    EXPECT_EQ(range->getLength(), 100);
+    std::remove(path.c_str());
+}
+
+TEST(SequenceIOTest, EmptySequenceRoundTrip)
+{
+    std::string path = tempPath("empty");
+    ArraySequence<int> source;
+    saveBinary(source, path);
+
+    ArraySequence<int> loaded;
+    loaded.append(1);
+    loadBinary(path, loaded);
+    EXPECT_EQ(loaded.getLength(), 0);
+    std::remove(path.c_str());
+}
+
+TEST(SequenceIOTest, ListSequenceIsStreamedToFile)
+{
+    std::string path = tempPath("list");
+    ListSequence<int> source;
+    for (int i = 0; i < 50000; i++)
+    {
+        source.prepend(i);
+    }
+    saveBinary(source, path);
+
+    ArraySequence<int> loaded;
+    loadBinary(path, loaded);
+    EXPECT_EQ(loaded.getLength(), 50000);
+    EXPECT_EQ(loaded[0], 49999);
+    EXPECT_EQ(loaded[49999], 0);
+    std::remove(path.c_str());
+}
+
+TEST(SequenceIOTest, WriterCountsBufferedAndBulkWrites)
+{
+    std::string path = tempPath("writer");
+    int bulk[] = {10, 11, 12};
+    {
+        BinarySequenceWriter<int> writer(path);
+        writer.write(1);
+        writer.write(bulk, 3);
+        writer.write(2);
+        EXPECT_EQ(writer.getCount(), 5u);
+    }
+
+    DynamicArray<int> loaded;
+    loadBinary(path, loaded);
+    EXPECT_EQ(loaded.getSize(), 5);
+    EXPECT_EQ(loaded[0], 1);
+    EXPECT_EQ(loaded[1], 10);
+    EXPECT_EQ(loaded[3], 12);
+    EXPECT_EQ(loaded[4], 2);
+    std::remove(path.c_str());
+}
+
+TEST(SequenceIOTest, LoadRejectsTypeMismatchAndMissingFiles)
+{
+    std::string path = tempPath("mismatch");
+    ArraySequence<int> source;
+    source.append(1);
+    saveBinary(source, path);
+
+    DynamicArray<double> wrongType;
+    EXPECT_THROW(loadBinary(path, wrongType), std::runtime_error);
+    EXPECT_THROW(loadBinary(tempPath("missing"), wrongType), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(SequenceIOTest, LoadConvertsForeignByteOrder)
+{
+    std::string path = tempPath("foreign");
+    BinarySequenceHeader header = makeBinaryHeader(BinaryTypeTag<int>::value, sizeof(int), 2);
+    swapBytes(&header.version, sizeof(header.version));
+    swapBytes(&header.byteOrder, sizeof(header.byteOrder));
+    swapBytes(&header.typeTag, sizeof(header.typeTag));
+    swapBytes(&header.elementSize, sizeof(header.elementSize));
+    swapBytes(&header.count, sizeof(header.count));
+    int items[] = {1, 0x01020304};
+    swapBytes(&items[0], sizeof(int));
+    swapBytes(&items[1], sizeof(int));
+    {
+        std::ofstream file(path.c_str(), std::ios::binary);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(items), sizeof(items));
+    }
+
+    DynamicArray<int> loaded;
+    loadBinary(path, loaded);
+    EXPECT_EQ(loaded.getSize(), 2);
+    EXPECT_EQ(loaded[0], 1);
+    EXPECT_EQ(loaded[1], 0x01020304);
+    EXPECT_THROW(MappedArraySequence<int> mapped(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(SequenceIOTest, CountsBeyondIntAreOnlyLimitedByTheIndexType)
+{
+    std::string path = tempPath("huge");
+    int items[] = {1, 2};
+    BinarySequenceHeader header = makeBinaryHeader(BinaryTypeTag<int>::value, sizeof(int), uint64_t(1) << 31);
+    {
+        std::ofstream file(path.c_str(), std::ios::binary);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(items), sizeof(items));
+    }
+    DynamicArray<int> loaded;
+    EXPECT_THROW(loadBinary(path, loaded), std::runtime_error);
+    try
+    {
+        MappedArraySequence<int> mapped(path);
+        FAIL();
+    }
+    catch (const std::length_error &)
+    {
+        FAIL() << "2^31 elements fit a SequenceIndex";
+    }
+    catch (const std::runtime_error &error)
+    {
+        EXPECT_NE(std::string(error.what()).find("Truncated"), std::string::npos);
+    }
+
+    header.count = uint64_t(1) << 63;
+    {
+        std::ofstream file(path.c_str(), std::ios::binary);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+    EXPECT_THROW(loadBinary(path, loaded), std::length_error);
+    EXPECT_THROW(MappedArraySequence<int> mapped(path), std::length_error);
+    std::remove(path.c_str());
+}
+
+TEST(MappedArraySequenceTest, MapsSavedFileWithoutCopying)
+{
+    std::string path = tempPath("mapped");
+    ArraySequence<int> source;
+    for (int i = 0; i < 100; i++)
+    {
+        source.append(i);
+    }
+    saveBinary(source, path);
+
+    MappedArraySequence<int> mapped(path);
+    EXPECT_EQ(mapped.getLength(), 100);
+    EXPECT_EQ(mapped.getFirst(), 0);
+    EXPECT_EQ(mapped.getLast(), 99);
+    EXPECT_EQ(mapped[42], 42);
+    EXPECT_THROW(mapped.get(100), std::out_of_range);
+
+    mapped.set(0, -1);
+    EXPECT_EQ(mapped[0], -1);
+    ArraySequence<int> reloaded;
+    loadBinary(path, reloaded);
+    EXPECT_EQ(reloaded[0], 0);
+    std::remove(path.c_str());
+}
+
+TEST(MappedArraySequenceTest, LengthChangingOperationsThrow)
+{
+    std::string path = tempPath("mappedFixed");
+    ArraySequence<int> source;
+    source.append(1);
+    saveBinary(source, path);
+
+    MappedArraySequence<int> mapped(path);
+    EXPECT_THROW(mapped.append(2), std::logic_error);
+    EXPECT_THROW(mapped.prepend(2), std::logic_error);
+    EXPECT_THROW(mapped.insertAt(2, 0), std::logic_error);
+    EXPECT_THROW(mapped.concat(&source), std::logic_error);
+    std::remove(path.c_str());
+}
+
+TEST(MappedArraySequenceTest, ImmutableOperationsReturnArrayCopies)
+{
+    std::string path = tempPath("mappedImmutable");
+    int items[] = {1, 2, 3, 4};
+    ArraySequence<int> source(items, 4);
+    saveBinary(source, path);
+
+    MappedArraySequence<int> mapped(path);
+    Sequence<int> *sub = mapped.getSubsequence(1, 2);
+    Sequence<int> *appended = mapped.appendImmutable(5);
+    Sequence<int> *combined = mapped.concatImmutable(&source);
+
+    EXPECT_EQ(sub->getLength(), 2);
+    EXPECT_EQ(sub->get(0), 2);
+    EXPECT_EQ(appended->getLast(), 5);
+    EXPECT_EQ(combined->getLength(), 8);
+    EXPECT_EQ(mapped.getLength(), 4);
+    EXPECT_THROW(mapped.setImmutable(4, 0), std::out_of_range);
+
+    delete sub;
+    delete appended;
+    delete combined;
+    std::remove(path.c_str());
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <limits>
+#include "../inc/dynamicArray.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/segmentedArraySequence.hpp"
+
+TEST(SequenceIndexTest, GrowCapacityDoublesUpToRequired)
+{
+    EXPECT_EQ(growCapacity(0, 1, 100), 1);
+    EXPECT_EQ(growCapacity(4, 5, 100), 8);
+    EXPECT_EQ(growCapacity(4, 33, 100), 64);
+    EXPECT_EQ(growCapacity(1, 1, 100), 1);
+}
+
+TEST(SequenceIndexTest, GrowCapacityClampsInsteadOfOverflowing)
+{
+    const SequenceIndex maximum = std::numeric_limits<SequenceIndex>::max();
+    const SequenceIndex large = static_cast<SequenceIndex>(1) << 62;
+
+    EXPECT_EQ(growCapacity(large, large + 1, maximum), maximum);
+    EXPECT_EQ(growCapacity(static_cast<SequenceIndex>(1) << 30, (static_cast<SequenceIndex>(1) << 30) + 1, maximum),
+              static_cast<SequenceIndex>(1) << 31);
+    EXPECT_EQ(growCapacity(60, 90, 100), 100);
+    EXPECT_THROW(growCapacity(60, 101, 100), std::length_error);
+    EXPECT_THROW(growCapacity(1, -1, 100), std::length_error);
+}
+
+TEST(SequenceIndexTest, ResizeBeyondAllocatorLimitThrowsLengthError)
+{
+    DynamicArray<int> array;
+    array.append(7);
+    SequenceIndex limit = maxElements(array.getAllocator());
+    EXPECT_LE(limit, std::numeric_limits<SequenceIndex>::max());
+
+    EXPECT_THROW(array.resize(limit + 1), std::length_error);
+    EXPECT_THROW(array.resize(std::numeric_limits<SequenceIndex>::max()), std::length_error);
+    int item = 1;
+    EXPECT_THROW(array.insertRange(0, &item, std::numeric_limits<SequenceIndex>::max()), std::length_error);
+
+    ASSERT_EQ(array.getSize(), 1);
+    EXPECT_EQ(array[0], 7);
+}
+
+TEST(SequenceIndexTest, IntCallersStillCompileAndWork)
+{
+    int items[] = {1, 2, 3};
+    int count = 3;
+    ArraySequence<int> sequence(items, count);
+    Sequence<int> *base = &sequence;
+
+    int index = 1;
+    base->insertAt(10, index);
+    int length = static_cast<int>(base->getLength());
+    EXPECT_EQ(length, 4);
+    EXPECT_EQ(base->get(index), 10);
+    EXPECT_THROW(base->get(-1), std::out_of_range);
+}
+
+#ifdef SEQUENCE_LARGE_TESTS
+TEST(LargeAllocationTest, DynamicArrayIndexesPastTwoBillion)
+{
+    const SequenceIndex count = static_cast<SequenceIndex>(INT_MAX) + 16;
+    DynamicArray<char> array(count);
+    ASSERT_EQ(array.getSize(), count);
+
+    array[count - 1] = 'z';
+    array[static_cast<SequenceIndex>(INT_MAX) + 1] = 'y';
+    EXPECT_EQ(array.getLast(), 'z');
+    EXPECT_EQ(array.get(static_cast<SequenceIndex>(INT_MAX) + 1), 'y');
+    EXPECT_THROW(array.get(count), std::out_of_range);
+
+    ArraySequence<char> sequence(std::move(array));
+    EXPECT_EQ(sequence.getLength(), count);
+    EXPECT_EQ(sequence.getLast(), 'z');
+}
+#endif
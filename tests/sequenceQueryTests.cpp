@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "../inc/sequenceQuery.hpp"
+#include "../inc/segmentedArraySequence.hpp"
+#include "../inc/dListSequence.hpp"
+
+TEST(SequenceQueryTest, MapFilterCollectIntoArray)
+{
+    int items[] = {1, 2, 3, 4, 5, 6};
+    ArraySequence<int> source(items, 6);
+
+    ArraySequence<int> *result = query(source)
+                                     .filter([](int x)
+                                             { return x % 2 == 0; })
+                                     .map([](int x)
+                                          { return x * 10; })
+                                     .toArraySequence();
+
+    ASSERT_EQ(result->getLength(), 3);
+    EXPECT_EQ(result->get(0), 20);
+    EXPECT_EQ(result->get(1), 40);
+    EXPECT_EQ(result->get(2), 60);
+    delete result;
+}
+
+TEST(SequenceQueryTest, MapCanChangeElementType)
+{
+    int items[] = {1, 22, 333};
+    ListSequence<int> source(items, 3);
+
+    ListSequence<std::string> *result = query(source)
+                                            .map([](int x)
+                                                 { return std::to_string(x); })
+                                            .toListSequence();
+
+    ASSERT_EQ(result->getLength(), 3);
+    EXPECT_EQ(result->get(0), "1");
+    EXPECT_EQ(result->get(2), "333");
+    delete result;
+}
+
+TEST(SequenceQueryTest, SliceTakeAndSkipSelectRanges)
+{
+    int items[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    ArraySequence<int> source(items, 10);
+
+    ArraySequence<int> *sliced = query(source).slice(2, 5).toArraySequence();
+    ASSERT_EQ(sliced->getLength(), 4);
+    EXPECT_EQ(sliced->getFirst(), 2);
+    EXPECT_EQ(sliced->getLast(), 5);
+
+    EXPECT_EQ(query(source).skip(7).count(), 3);
+    EXPECT_EQ(query(source).skip(20).count(), 0);
+    EXPECT_EQ(query(source).take(0).count(), 0);
+    EXPECT_EQ(query(source).take(100).count(), 10);
+    EXPECT_EQ(query(source).skip(3).take(2).getBound(), 2);
+
+    EXPECT_THROW(query(source).slice(5, 2), std::out_of_range);
+    EXPECT_THROW(query(source).take(-1), std::invalid_argument);
+    delete sliced;
+}
+
+TEST(SequenceQueryTest, ConcatChainsSourcesAndRespectsTake)
+{
+    int first[] = {1, 2, 3};
+    int second[] = {4, 5};
+    ArraySequence<int> left(first, 3);
+    ListSequence<int> right(second, 2);
+
+    SequenceQuery<int> both = query(left).concat(query(right));
+    EXPECT_EQ(both.getBound(), 5);
+
+    ListSequence<int> *all = both.toListSequence();
+    ASSERT_EQ(all->getLength(), 5);
+    EXPECT_EQ(all->get(3), 4);
+
+    ArraySequence<int> *limited = both.take(2).concat(query(right)).toArraySequence();
+    ASSERT_EQ(limited->getLength(), 4);
+    EXPECT_EQ(limited->get(1), 2);
+    EXPECT_EQ(limited->get(2), 4);
+
+    delete all;
+    delete limited;
+}
+
+TEST(SequenceQueryTest, EvaluationIsLazyAndSinglePass)
+{
+    int items[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    ArraySequence<int> source(items, 8);
+
+    int calls = 0;
+    SequenceQuery<int> pipeline = query(source)
+                                      .map([&calls](int x)
+                                           {
+                                               calls++;
+                                               return x + 1; })
+                                      .take(3);
+    EXPECT_EQ(calls, 0);
+
+    ArraySequence<int> *result = pipeline.toArraySequence();
+    EXPECT_EQ(calls, 3);
+    EXPECT_EQ(result->getLength(), 3);
+    EXPECT_EQ(result->getLast(), 4);
+    delete result;
+}
+
+TEST(SequenceQueryTest, GenericSourceAndAppendTo)
+{
+    SegmentedArraySequence<int> source;
+    for (int i = 0; i < 20; i++)
+    {
+        source.append(i);
+    }
+    const Sequence<int> &generic = source;
+
+    ListSequence<int> target;
+    target.append(-1);
+    query(generic).filter([](int x)
+                          { return x >= 18; })
+        .appendTo(target);
+
+    ASSERT_EQ(target.getLength(), 3);
+    EXPECT_EQ(target.get(1), 18);
+    EXPECT_EQ(target.get(2), 19);
+
+    int items[] = {1, 2, 3};
+    int sum = 0;
+    SequenceQuery<int>::from(items, 3).forEach([&sum](int x)
+                                               { sum += x; });
+    EXPECT_EQ(sum, 6);
+    EXPECT_THROW(SequenceQuery<int>::from(nullptr, 1), std::invalid_argument);
+}
+
+namespace
+{
+    struct Tracked
+    {
+        static int defaults;
+        int value;
+
+        Tracked() : value(0) { defaults++; }
+        Tracked(const int value) : value(value) {}
+    };
+
+    int Tracked::defaults = 0;
+
+    std::ostream &operator<<(std::ostream &out, const Tracked &item)
+    {
+        return out << item.value;
+    }
+}
+
+TEST(SequenceQueryTest, GenericLinkedSourceIsWalkedOnce)
+{
+    DListSequence<int> source;
+    for (int i = 0; i < 100000; i++)
+    {
+        source.append(i);
+    }
+    const Sequence<int> &generic = source;
+
+    long long sum = 0;
+    query(generic).forEach([&sum](int x)
+                           { sum += x; });
+    EXPECT_EQ(sum, 4999950000LL);
+
+    int calls = 0;
+    ArraySequence<int> *head = query(generic)
+                                   .map([&calls](int x)
+                                        {
+                                            calls++;
+                                            return x; })
+                                   .take(3)
+                                   .toArraySequence();
+    EXPECT_EQ(calls, 3);
+    EXPECT_EQ(head->getLast(), 2);
+    delete head;
+}
+
+TEST(SequenceQueryTest, SelectiveFilterOnlyBuildsWhatItKeeps)
+{
+    ArraySequence<Tracked> source;
+    for (int i = 0; i < 10000; i++)
+    {
+        source.append(Tracked(i));
+    }
+
+    Tracked::defaults = 0;
+    ArraySequence<Tracked> *result = query(source)
+                                         .filter([](const Tracked &item)
+                                                 { return item.value % 1000 == 0; })
+                                         .toArraySequence();
+    ASSERT_EQ(result->getLength(), 10);
+    EXPECT_EQ(result->get(9).value, 9000);
+    EXPECT_LT(Tracked::defaults, 100);
+    delete result;
+}
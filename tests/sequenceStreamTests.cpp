@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include "../inc/sequenceStream.hpp"
+
+#ifdef SEQUENCE_HAS_STREAMS
+#include "../inc/dListSequence.hpp"
+
+namespace
+{
+    Generator<int> countTo(const int limit, int &produced)
+    {
+        for (int i = 0; i < limit; i++)
+        {
+            produced++;
+            co_yield i;
+        }
+    }
+
+    Generator<int> failAfter(const int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            co_yield i;
+        }
+        throw std::runtime_error("producer failed");
+    }
+
+    Generator<int> squares(Generator<int> source)
+    {
+        for (int value : source)
+        {
+            co_yield value * value;
+        }
+    }
+}
+
+TEST(SequenceStreamTest, StreamsVisitEveryElementInOrder)
+{
+    int items[] = {1, 2, 3, 4};
+    ArraySequence<int> array(items, 4);
+    ListSequence<int> list(items, 4);
+    DListSequence<int> dlist(items, 4);
+
+    int expected = 1;
+    for (int value : stream(array))
+    {
+        EXPECT_EQ(value, expected++);
+    }
+    expected = 1;
+    for (int value : stream(list))
+    {
+        EXPECT_EQ(value, expected++);
+    }
+    expected = 1;
+    for (int value : stream<int>(dlist))
+    {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 5);
+
+    ArraySequence<int> empty;
+    for (int value : stream(empty))
+    {
+        ADD_FAILURE() << value;
+    }
+}
+
+TEST(SequenceStreamTest, ProducerRunsOnlyAsFarAsConsumed)
+{
+    int produced = 0;
+    Generator<int> numbers = countTo(1000, produced);
+    EXPECT_EQ(produced, 0);
+    for (int value : numbers)
+    {
+        if (value == 9)
+        {
+            break;
+        }
+    }
+    EXPECT_EQ(produced, 10);
+}
+
+TEST(SequenceStreamTest, AppendFromAppendsInBatches)
+{
+    int produced = 0;
+    ArraySequence<int> target;
+    target.append(-1);
+    EXPECT_EQ(appendFrom(target, countTo(10000, produced), 256), 10000);
+    EXPECT_EQ(target.getLength(), 10001);
+    EXPECT_EQ(target.getLast(), 9999);
+
+    ListSequence<int> squared = collect<ListSequence<int>>(squares(stream(target)), 7);
+    EXPECT_EQ(squared.getLength(), 10001);
+    EXPECT_EQ(squared.get(3), 4);
+
+    EXPECT_THROW(appendFrom(target, countTo(1, produced), 0), std::invalid_argument);
+}
+
+TEST(SequenceStreamTest, ReadValuesParsesUntilEndOfInput)
+{
+    std::istringstream in("5 6 7\n8 x 9");
+    ArraySequence<int> values = collect<ArraySequence<int>>(readValues<int>(in));
+    EXPECT_EQ(values.getLength(), 4);
+    EXPECT_EQ(values.getLast(), 8);
+}
+
+TEST(SequenceStreamTest, ProducerErrorsReachTheConsumer)
+{
+    ArraySequence<int> target;
+    EXPECT_THROW(appendFrom(target, failAfter(5), 2), std::runtime_error);
+    EXPECT_EQ(target.getLength(), 4);
+
+    Generator<int> first = failAfter(0);
+    Generator<int> second = std::move(first);
+    EXPECT_THROW(second.begin(), std::runtime_error);
+}
+#endif
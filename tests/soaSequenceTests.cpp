@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "../inc/soaSequence.hpp"
+
+typedef SoASequence<int, double, float> Records;
+
+TEST(SoASequenceTest, AppendAndGetWholeRecords)
+{
+    Records records;
+    EXPECT_EQ(records.getLength(), 0);
+    EXPECT_EQ(Records::COLUMN_COUNT, 3u);
+
+    records.append(1, 9.5, 2.0f);
+    records.append(Records::Record(2, 4.25, 1.0f));
+
+    ASSERT_EQ(records.getLength(), 2);
+    EXPECT_EQ(std::get<0>(records.get(0)), 1);
+    EXPECT_DOUBLE_EQ(std::get<1>(records.get(1)), 4.25);
+    EXPECT_FLOAT_EQ(std::get<2>(records[0]), 2.0f);
+    EXPECT_THROW(records.get(2), std::out_of_range);
+}
+
+TEST(SoASequenceTest, SetAndInsertKeepColumnsAligned)
+{
+    SoASequence<int, std::string> records;
+    records.append(1, "one");
+    records.append(3, "three");
+    records.insertAt(SoASequence<int, std::string>::Record(2, "two"), 1);
+    records.set(0, 10, "ten");
+
+    ASSERT_EQ(records.getLength(), 3);
+    EXPECT_EQ(records.at<0>(0), 10);
+    EXPECT_EQ(records.at<1>(0), "ten");
+    EXPECT_EQ(records.at<0>(1), 2);
+    EXPECT_EQ(records.at<1>(1), "two");
+    EXPECT_EQ(records.at<1>(2), "three");
+
+    EXPECT_THROW(records.insertAt(SoASequence<int, std::string>::Record(0, ""), 5), std::out_of_range);
+    EXPECT_THROW(records.set(3, 0, ""), std::out_of_range);
+}
+
+TEST(SoASequenceTest, ColumnSpansAreContiguous)
+{
+    Records records;
+    for (int i = 0; i < 100; i++)
+    {
+        records.append(i, i * 0.5, 1.0f);
+    }
+
+    ColumnSpan<double> prices = records.column<1>();
+    ASSERT_EQ(prices.size(), 100);
+    EXPECT_EQ(prices.end() - prices.begin(), 100);
+    for (double &price : prices)
+    {
+        price *= 2;
+    }
+    EXPECT_DOUBLE_EQ(std::get<1>(records.get(10)), 10.0);
+
+    const Records &view = records;
+    ColumnSpan<const int> ids = view.column<0>();
+    EXPECT_EQ(ids[99], 99);
+    EXPECT_THROW(ids[100], std::out_of_range);
+}
+
+TEST(SoASequenceTest, SumColumnMatchesScalarLoop)
+{
+    Records records;
+    double expected = 0;
+    for (int i = 0; i < 1003; i++)
+    {
+        records.append(i, i * 0.25, static_cast<float>(i % 7));
+        expected += i * 0.25;
+    }
+
+    EXPECT_DOUBLE_EQ(sumColumn(records.column<1>()), expected);
+    EXPECT_EQ(sumColumn(records.column<0>()), 1003 * 1002 / 2);
+
+    records.clear();
+    EXPECT_EQ(records.getLength(), 0);
+    EXPECT_DOUBLE_EQ(sumColumn(records.column<1>()), 0.0);
+}
+
+TEST(SoASequenceTest, ResizeGrowsAllColumns)
+{
+    Records records;
+    records.resize(5);
+    EXPECT_EQ(records.getLength(), 5);
+    EXPECT_EQ(records.column<2>().size(), 5);
+    records.resize(2);
+    EXPECT_EQ(records.column<0>().size(), 2);
+    EXPECT_THROW(records.resize(-1), std::invalid_argument);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <random>
+#include <vector>
+#include "../inc/sortedArraySequence.hpp"
+#include "../inc/listSequence.hpp"
+
+static const SearchLayout layouts[] = {SearchLayout::Binary, SearchLayout::Branchless, SearchLayout::Eytzinger};
+
+TEST(SortedArraySequenceTest, BuildsSortedFromUnsortedInput)
+{
+    int items[] = {5, 1, 4, 1, 3};
+    SortedArraySequence<int> sorted(items, 5);
+    EXPECT_EQ(sorted.getLength(), 5);
+    EXPECT_EQ(sorted.getFirst(), 1);
+    EXPECT_EQ(sorted.getLast(), 5);
+    EXPECT_EQ(sorted[2], 3);
+
+    ListSequence<int> list(items, 5);
+    SortedArraySequence<int> fromSequence(list);
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(fromSequence[i], sorted[i]);
+    }
+
+    EXPECT_THROW(SortedArraySequence<int>(nullptr, 1), std::invalid_argument);
+}
+
+TEST(SortedArraySequenceTest, BuildsFromLinkedSourcesInOnePass)
+{
+    const int count = 100000;
+    std::vector<int> items(count);
+    for (int i = 0; i < count; i++)
+    {
+        items[i] = (i * 7919) % count;
+    }
+    ListSequence<int> list(items.data(), count);
+    SortedArraySequence<int> sorted(list);
+    ASSERT_EQ(sorted.getLength(), count);
+    for (int i = 0; i < count; i++)
+    {
+        ASSERT_EQ(sorted[i], i);
+    }
+}
+
+TEST(SortedArraySequenceTest, EmptySequenceQueries)
+{
+    for (int l = 0; l < 3; l++)
+    {
+        SortedArraySequence<int> sorted;
+        sorted.setSearchLayout(layouts[l]);
+        EXPECT_EQ(sorted.lowerBound(1), 0);
+        EXPECT_EQ(sorted.upperBound(1), 0);
+        EXPECT_EQ(sorted.find(1), -1);
+        EXPECT_FALSE(sorted.contains(1));
+        EXPECT_THROW(sorted.getFirst(), std::out_of_range);
+    }
+}
+
+TEST(SortedArraySequenceTest, BoundsAndRanksAcrossLayouts)
+{
+    int items[] = {10, 20, 20, 20, 30, 40};
+    for (int l = 0; l < 3; l++)
+    {
+        SortedArraySequence<int> sorted(items, 6);
+        sorted.setSearchLayout(layouts[l]);
+        EXPECT_EQ(sorted.getSearchLayout(), layouts[l]);
+
+        EXPECT_EQ(sorted.lowerBound(5), 0);
+        EXPECT_EQ(sorted.lowerBound(20), 1);
+        EXPECT_EQ(sorted.upperBound(20), 4);
+        EXPECT_EQ(sorted.lowerBound(25), 4);
+        EXPECT_EQ(sorted.upperBound(40), 6);
+        EXPECT_EQ(sorted.lowerBound(50), 6);
+        EXPECT_EQ(sorted.rank(30), 4);
+
+        IndexRange range = sorted.equalRange(20);
+        EXPECT_EQ(range.begin, 1);
+        EXPECT_EQ(range.end, 4);
+
+        EXPECT_EQ(sorted.find(20), 1);
+        EXPECT_EQ(sorted.find(40), 5);
+        EXPECT_EQ(sorted.find(25), -1);
+        EXPECT_TRUE(sorted.contains(10));
+        EXPECT_FALSE(sorted.contains(0));
+    }
+}
+
+TEST(SortedArraySequenceTest, LayoutsAgreeOnRandomQueries)
+{
+    std::mt19937 random(3);
+    DynamicArray<int> items;
+    for (int i = 0; i < 1000; i++)
+    {
+        items.append(static_cast<int>(random() % 500));
+    }
+
+    SortedArraySequence<int> binary(items.getData(), items.getSize());
+    SortedArraySequence<int> branchless(items.getData(), items.getSize());
+    SortedArraySequence<int> eytzinger(items.getData(), items.getSize());
+    binary.setSearchLayout(SearchLayout::Binary);
+    eytzinger.setSearchLayout(SearchLayout::Eytzinger);
+
+    for (int value = -1; value <= 501; value++)
+    {
+        ASSERT_EQ(branchless.lowerBound(value), binary.lowerBound(value));
+        ASSERT_EQ(eytzinger.lowerBound(value), binary.lowerBound(value));
+        ASSERT_EQ(branchless.upperBound(value), binary.upperBound(value));
+        ASSERT_EQ(eytzinger.upperBound(value), binary.upperBound(value));
+    }
+}
+
+TEST(SortedArraySequenceTest, InsertKeepsOrderAndIndex)
+{
+    for (int l = 0; l < 3; l++)
+    {
+        SortedArraySequence<int> sorted;
+        sorted.setSearchLayout(layouts[l]);
+        int values[] = {5, 3, 8, 3, 1, 9};
+        for (int i = 0; i < 6; i++)
+        {
+            sorted.insert(values[i]);
+        }
+
+        int expected[] = {1, 3, 3, 5, 8, 9};
+        for (int i = 0; i < 6; i++)
+        {
+            EXPECT_EQ(sorted[i], expected[i]);
+        }
+        EXPECT_EQ(sorted.find(8), 4);
+        EXPECT_EQ(sorted.upperBound(3), 3);
+
+        sorted.clear();
+        EXPECT_EQ(sorted.getLength(), 0);
+        EXPECT_EQ(sorted.find(8), -1);
+    }
+}
+
+TEST(SortedArraySequenceTest, CustomComparatorDefinesOrder)
+{
+    int items[] = {1, 5, 3};
+    SortedArraySequence<int, std::greater<int>> sorted(items, 3);
+    EXPECT_EQ(sorted[0], 5);
+    EXPECT_EQ(sorted[2], 1);
+    EXPECT_EQ(sorted.lowerBound(3), 1);
+    EXPECT_EQ(sorted.find(1), 2);
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <random>
+#include <string>
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+
+struct Keyed
+{
+    int key;
+    int order;
+};
+
+static std::ostream &operator<<(std::ostream &out, const Keyed &item)
+{
+    return out << item.key << ":" << item.order;
+}
+
+static bool byKey(const Keyed &a, const Keyed &b)
+{
+    return a.key < b.key;
+}
+
+static DynamicArray<int> randomArray(const int count, const int range, const unsigned seed)
+{
+    std::mt19937 random(seed);
+    DynamicArray<int> arr;
+    for (int i = 0; i < count; i++)
+    {
+        arr.append(static_cast<int>(random() % range));
+    }
+    return arr;
+}
+
+template <class Container>
+static bool isSorted(const Container &items, const int count)
+{
+    for (int i = 1; i < count; i++)
+    {
+        if (items[i] < items[i - 1])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST(SortingTest, IntroSortHandlesSmallAndDegenerateInputs)
+{
+    DynamicArray<int> empty;
+    empty.sort();
+    EXPECT_EQ(empty.getSize(), 0);
+
+    int same[40];
+    for (int i = 0; i < 40; i++)
+    {
+        same[i] = 7;
+    }
+    introSort(same, 40, std::less<int>());
+    EXPECT_TRUE(isSorted(same, 40));
+
+    int descending[1000];
+    for (int i = 0; i < 1000; i++)
+    {
+        descending[i] = 1000 - i;
+    }
+    introSort(descending, 1000, std::less<int>());
+    EXPECT_TRUE(isSorted(descending, 1000));
+}
+
+TEST(SortingTest, HeapSortSortsRandomInput)
+{
+    DynamicArray<int> arr = randomArray(500, 100, 1);
+    heapSort(arr.getData(), arr.getSize(), std::less<int>());
+    EXPECT_TRUE(isSorted(arr, arr.getSize()));
+}
+
+TEST(SortingTest, ArraySequenceSortWithThreads)
+{
+    for (int threads = 1; threads <= 8; threads *= 2)
+    {
+        DynamicArray<int> source = randomArray(100000, 1000000, threads);
+        ArraySequence<int> seq(source);
+        seq.sort(std::less<int>(), threads);
+        EXPECT_EQ(seq.getLength(), 100000);
+        EXPECT_TRUE(isSorted(seq, seq.getLength()));
+    }
+}
+
+TEST(SortingTest, SortAcceptsCustomComparator)
+{
+    std::string items[] = {"pear", "apple", "fig", "kiwi"};
+    ArraySequence<std::string> seq(items, 4);
+    seq.sort(std::greater<std::string>());
+    EXPECT_EQ(seq[0], "pear");
+    EXPECT_EQ(seq[3], "apple");
+}
+
+TEST(SortingTest, StableSortKeepsEqualKeysInOrder)
+{
+    for (int threads = 1; threads <= 4; threads *= 2)
+    {
+        std::mt19937 random(42);
+        ArraySequence<Keyed> seq;
+        for (int i = 0; i < 50000; i++)
+        {
+            Keyed item = {static_cast<int>(random() % 50), i};
+            seq.append(item);
+        }
+
+        seq.stableSort(byKey, threads);
+        for (int i = 1; i < seq.getLength(); i++)
+        {
+            ASSERT_LE(seq[i - 1].key, seq[i].key);
+            if (seq[i - 1].key == seq[i].key)
+            {
+                ASSERT_LT(seq[i - 1].order, seq[i].order);
+            }
+        }
+    }
+}
+
+TEST(SortingTest, ArrayMergeCombinesSortedSequencesStably)
+{
+    Keyed left[] = {{1, 0}, {3, 1}, {5, 2}};
+    Keyed right[] = {{1, 10}, {2, 11}, {5, 12}, {9, 13}};
+    ArraySequence<Keyed> seq(left, 3);
+    ArraySequence<Keyed> other(right, 4);
+
+    seq.merge(other, byKey);
+    int expectedOrder[] = {0, 10, 11, 1, 2, 12, 13};
+    ASSERT_EQ(seq.getLength(), 7);
+    for (int i = 0; i < 7; i++)
+    {
+        EXPECT_EQ(seq[i].order, expectedOrder[i]);
+    }
+    EXPECT_EQ(other.getLength(), 4);
+    EXPECT_THROW(seq.merge(seq, byKey), std::invalid_argument);
+}
+
+TEST(SortingTest, ListSortRelinksIntoOrder)
+{
+    DynamicArray<int> source = randomArray(20000, 500, 7);
+    ListSequence<int> seq(source.getData(), source.getSize());
+
+    seq.sort();
+    EXPECT_EQ(seq.getLength(), 20000);
+    int previous = seq.getFirst();
+    for (LinkedList<int>::ConstIterator it = seq.begin(); it != seq.end(); ++it)
+    {
+        EXPECT_LE(previous, *it);
+        previous = *it;
+    }
+
+    ListSequence<int> empty;
+    empty.sort();
+    EXPECT_EQ(empty.getLength(), 0);
+}
+
+TEST(SortingTest, ListSortIsStableAndDoesNotMoveValues)
+{
+    Keyed items[] = {{3, 0}, {1, 1}, {3, 2}, {2, 3}, {1, 4}};
+    LinkedList<Keyed> list(items, 5);
+    const Keyed *firstAddress = &list.get(0);
+
+    list.sort(byKey);
+    int expectedOrder[] = {1, 4, 3, 0, 2};
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(list.get(i).order, expectedOrder[i]);
+    }
+    EXPECT_EQ(&list.get(3), firstAddress);
+}
+
+TEST(SortingTest, ListMergeSplicesOtherList)
+{
+    int left[] = {1, 4, 6};
+    int right[] = {2, 3, 7, 8};
+    ListSequence<int> seq(left, 3);
+    ListSequence<int> other(right, 4);
+
+    seq.merge(other);
+    EXPECT_EQ(seq.getLength(), 7);
+    EXPECT_EQ(other.getLength(), 0);
+    int expected[] = {1, 2, 3, 4, 6, 7, 8};
+    for (int i = 0; i < 7; i++)
+    {
+        EXPECT_EQ(seq.get(i), expected[i]);
+    }
+    EXPECT_THROW(seq.merge(seq), std::invalid_argument);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "../inc/transient.hpp"
+#include "../inc/arraySequence.hpp"
+#include "../inc/listSequence.hpp"
+#include "../inc/dListSequence.hpp"
+#include "../inc/poolListSequence.hpp"
+#include "../inc/ropeSequence.hpp"
+#include "../inc/segmentedArraySequence.hpp"
+#include "../inc/packedIntSequence.hpp"
+
+namespace
+{
+    std::string text(const Sequence<int> &seq)
+    {
+        std::ostringstream out;
+        out << seq;
+        return out.str();
+    }
+
+    void expectBatchEdits(const Sequence<int> &original)
+    {
+        std::string before = text(original);
+        Sequence<int> *result = original.transient()
+                                    .append(4)
+                                    .prepend(0)
+                                    .insertAt(9, 2)
+                                    .set(1, 7)
+                                    .freeze();
+        EXPECT_EQ(text(*result), "[0], [7], [9], [2], [3], [4]");
+        EXPECT_EQ(text(original), before);
+        delete result;
+    }
+}
+
+TEST(TransientTest, BatchEditsLeaveTheOriginalUntouched)
+{
+    int items[] = {1, 2, 3};
+    expectBatchEdits(ArraySequence<int>(items, 3));
+    expectBatchEdits(ListSequence<int>(items, 3));
+    expectBatchEdits(DListSequence<int>(items, 3));
+    expectBatchEdits(PoolListSequence<int>(items, 3));
+    expectBatchEdits(RopeSequence<int>(items, 3));
+    expectBatchEdits(SegmentedArraySequence<int>(items, 3));
+    expectBatchEdits(PackedIntSequence<int>(items, 3));
+}
+
+TEST(TransientTest, FreezeKeepsTheConcreteType)
+{
+    int items[] = {1, 2, 3};
+    ListSequence<int> list(items, 3);
+    Sequence<int> *result = list.transient().append(4).freeze();
+    EXPECT_NE(dynamic_cast<ListSequence<int> *>(result), nullptr);
+    delete result;
+}
+
+TEST(TransientTest, ReadsSeeEarlierEdits)
+{
+    ArraySequence<int> seq;
+    Transient<int> transient = seq.transient();
+    for (int i = 0; i < 100; i++)
+    {
+        transient.append(i);
+        EXPECT_EQ(transient.get(i), i);
+    }
+    int more[] = {100, 101};
+    transient.appendRange(more, 2).insertRange(0, more, 1).concat(&seq);
+    EXPECT_EQ(transient.getLength(), 103);
+    EXPECT_EQ(transient.get(0), 100);
+    EXPECT_EQ(seq.getLength(), 0);
+
+    Sequence<int> *result = transient.freeze();
+    EXPECT_EQ(result->getLast(), 101);
+    delete result;
+}
+
+TEST(TransientTest, FrozenTransientRejectsUse)
+{
+    ArraySequence<int> seq;
+    Transient<int> transient = seq.transient();
+    EXPECT_FALSE(transient.isFrozen());
+    delete transient.freeze();
+    EXPECT_TRUE(transient.isFrozen());
+    EXPECT_THROW(transient.append(1), std::logic_error);
+    EXPECT_THROW(transient.getLength(), std::logic_error);
+    EXPECT_THROW(transient.freeze(), std::logic_error);
+    EXPECT_THROW(Transient<int>(nullptr), std::invalid_argument);
+}
+
+TEST(TransientTest, MovedTransientOwnsTheCopy)
+{
+    int items[] = {1, 2};
+    ArraySequence<int> seq(items, 2);
+    Transient<int> first = seq.transient();
+    first.append(3);
+    Transient<int> second(std::move(first));
+    EXPECT_TRUE(first.isFrozen());
+    second.append(4);
+
+    Transient<int> third = seq.transient();
+    third = std::move(second);
+    Sequence<int> *result = third.freeze();
+    EXPECT_EQ(text(*result), "[1], [2], [3], [4]");
+    delete result;
+}
+
+TEST(TransientTest, FailedEditKeepsTheTransientUsable)
+{
+    int items[] = {1, 2};
+    ArraySequence<int> seq(items, 2);
+    Transient<int> transient = seq.transient();
+    EXPECT_THROW(transient.set(5, 0), std::out_of_range);
+    transient.set(1, 5);
+    Sequence<int> *result = transient.freeze();
+    EXPECT_EQ(result->get(1), 5);
+    delete result;
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "../inc/zoneMap.hpp"
+#include "../inc/arraySequence.hpp"
+
+namespace
+{
+    const int CHUNK = ChunkSummary<int>::CHUNK_SIZE;
+
+    ArraySequence<int> randomSequence(const int count, const int range, const unsigned seed)
+    {
+        std::mt19937 random(seed);
+        ArraySequence<int> seq;
+        for (int i = 0; i < count; i++)
+        {
+            seq.append(static_cast<int>(random() % range));
+        }
+        return seq;
+    }
+
+    void expectFilterMatchesScan(const ArraySequence<int> &seq, const int low, const int high)
+    {
+        ArraySequence<int> *filtered = seq.filterRange(low, high);
+        SequenceIndex next = 0;
+        for (SequenceIndex i = 0; i < seq.getLength(); i++)
+        {
+            if (seq[i] >= low && seq[i] <= high)
+            {
+                ASSERT_LT(next, filtered->getLength());
+                ASSERT_EQ((*filtered)[next++], seq[i]);
+            }
+        }
+        EXPECT_EQ(next, filtered->getLength());
+        delete filtered;
+    }
+}
+
+TEST(ZoneMapTest, BoundsAndFilterRejectChunks)
+{
+    ArraySequence<int> seq;
+    for (int i = 0; i < 3 * CHUNK; i++)
+    {
+        seq.append(i * 2);
+    }
+    ZoneMap<int> zones;
+    zones.rebuild(seq.getData(), seq.getLength());
+    EXPECT_EQ(zones.getChunkCount(), 3);
+
+    EXPECT_TRUE(zones.mayContain(0, 10));
+    EXPECT_FALSE(zones.mayContain(1, 10));
+    EXPECT_FALSE(zones.mayContain(0, -1));
+    EXPECT_EQ(zones.overlap(0, 0, 2 * CHUNK), RangeOverlap::Full);
+    EXPECT_EQ(zones.overlap(1, 0, 2 * CHUNK), RangeOverlap::Partial);
+    EXPECT_EQ(zones.overlap(2, 0, 2 * CHUNK), RangeOverlap::None);
+
+    int rejected = 0;
+    for (int odd = 1; odd < 2 * CHUNK; odd += 2)
+    {
+        rejected += zones.mayContain(0, odd) ? 0 : 1;
+    }
+    EXPECT_GT(rejected, CHUNK * 3 / 4);
+}
+
+TEST(ZoneMapTest, LookupsMatchLinearScan)
+{
+    ArraySequence<int> plain = randomSequence(10 * CHUNK + 17, 100000, 1);
+    ArraySequence<int> summarized(plain);
+    summarized.attachSummary();
+    EXPECT_TRUE(summarized.hasSummary());
+
+    std::mt19937 random(2);
+    for (int i = 0; i < 2000; i++)
+    {
+        int value = static_cast<int>(random() % 100000);
+        ASSERT_EQ(summarized.indexOf(value), plain.indexOf(value));
+        ASSERT_EQ(summarized.lastIndexOf(value), plain.lastIndexOf(value));
+        ASSERT_EQ(summarized.contains(value), plain.contains(value));
+    }
+    EXPECT_FALSE(summarized.contains(-5));
+    EXPECT_FALSE(summarized.contains(100000));
+}
+
+TEST(ZoneMapTest, FilterRangeMatchesScan)
+{
+    ArraySequence<int> seq;
+    for (int i = 0; i < 5 * CHUNK + 100; i++)
+    {
+        seq.append(i);
+    }
+    expectFilterMatchesScan(seq, 100, 200);
+    seq.attachSummary();
+    expectFilterMatchesScan(seq, 100, 200);
+    expectFilterMatchesScan(seq, CHUNK - 5, 3 * CHUNK + 5);
+    expectFilterMatchesScan(seq, -10, -1);
+    expectFilterMatchesScan(seq, 0, 10 * CHUNK);
+    expectFilterMatchesScan(seq, 7, 3);
+
+    ArraySequence<int> random = randomSequence(4 * CHUNK, 1000, 3);
+    random.attachSummary();
+    expectFilterMatchesScan(random, 10, 20);
+}
+
+TEST(ZoneMapTest, EditsKeepSummaryConservative)
+{
+    ArraySequence<int> seq;
+    seq.attachSummary();
+    for (int i = 0; i < 3 * CHUNK; i++)
+    {
+        seq.append(i);
+    }
+    seq.set(10, 1000000);
+    EXPECT_EQ(seq.indexOf(1000000), 10);
+    EXPECT_FALSE(seq.contains(10));
+    expectFilterMatchesScan(seq, 5, 20);
+
+    seq.prepend(-7);
+    EXPECT_EQ(seq.indexOf(-7), 0);
+    EXPECT_EQ(seq.indexOf(1000000), 11);
+    seq.insertAt(-8, CHUNK);
+    EXPECT_EQ(seq.indexOf(-8), CHUNK);
+    seq.insertAt(-9, seq.getLength());
+    EXPECT_EQ(seq.lastIndexOf(-9), seq.getLength() - 1);
+
+    seq.sort();
+    EXPECT_EQ(seq.indexOf(-9), 0);
+    EXPECT_EQ(seq.indexOf(1000000), seq.getLength() - 1);
+    expectFilterMatchesScan(seq, -8, 100);
+
+    seq.resize(CHUNK);
+    EXPECT_FALSE(seq.contains(1000000));
+    seq.clear();
+    EXPECT_FALSE(seq.contains(0));
+}
+
+TEST(ZoneMapTest, CopiesCarryTheirOwnSummary)
+{
+    ArraySequence<int> seq;
+    seq.attachSummary();
+    for (int i = 0; i < CHUNK + 1; i++)
+    {
+        seq.append(i);
+    }
+    ArraySequence<int> copy(seq);
+    EXPECT_TRUE(copy.hasSummary());
+    copy.set(0, -1);
+    EXPECT_EQ(copy.indexOf(-1), 0);
+    EXPECT_FALSE(seq.contains(-1));
+
+    copy.detachSummary();
+    EXPECT_FALSE(copy.hasSummary());
+    EXPECT_EQ(copy.indexOf(-1), 0);
+}